@@ -25,6 +25,19 @@ namespace MiiEngine {
 	void Collider::SetLightData(LightInfo light) { object3d_->SetLightData(light); }
 	// IsCollision
 	void Collider::SetIsCollision(bool flag) { isCollision_ = flag; }
+	// IsStatic
+	void Collider::SetIsStatic(bool flag) { isStatic_ = flag; }
+	// IsContinuous
+	void Collider::SetIsContinuous(bool flag) { isContinuous_ = flag; }
+	// Mass
+	void Collider::SetMass(float mass) { mass_ = mass; }
+	// Handle
+	void Collider::SetColliderHandle(ColliderHandle handle) { handle_ = handle; }
+	// Impact
+	void Collider::SetImpact(float timeOfImpact, const Vector3& position) {
+		timeOfImpact_ = timeOfImpact;
+		impactPosition_ = position;
+	}
 
 	///-------------------------------------------/// 
 	/// Getter
@@ -39,7 +52,25 @@ namespace MiiEngine {
 	Vector4 Collider::GetColor() const { return color_; }
 	// IsCollision
 	bool Collider::GetIsCollision() const { return isCollision_; }
+	// IsStatic
+	bool Collider::GetIsStatic() const { return isStatic_; }
+	// IsContinuous
+	bool Collider::GetIsContinuous() const { return isContinuous_; }
+	// Mass
+	float Collider::GetMass() const { return mass_; }
+	// Handle
+	ColliderHandle Collider::GetColliderHandle() const { return handle_; }
+	// Impact
+	float Collider::GetTimeOfImpact() const { return timeOfImpact_; }
+	const Vector3& Collider::GetImpactPosition() const { return impactPosition_; }
+
 
+	///-------------------------------------------/// 
+	/// 衝突イベント
+	///-------------------------------------------///
+	void Collider::OnCollisionEnter(Collider* collider) { OnCollision(collider); }
+	void Collider::OnCollisionStay(Collider* collider) { OnCollision(collider); }
+	void Collider::OnCollisionExit(Collider* collider) { collider; }
 
 	///-------------------------------------------/// 
 	/// 初期化
@@ -7,8 +7,8 @@
 #include "application/Drawing/3d/Object3d.h"
 // Data
 #include "Engine/DataInfo/ColliderData.h"
-// ColliderCollision
-#include "Engine/Collider/Collision/ColliderCollision.h"
+// Math
+#include "Math/sMath.h"
 // Line
 #include "application/Drawing/3d/Line.h"
 
@@ -54,6 +54,24 @@ namespace MiiEngine {
 		/// <param name="collider">衝突した相手のコライダーへのポインタ。該当するコライダー情報を示すオブジェクトへの参照。</param>
 		virtual void OnCollision(Collider* collider) = 0;
 
+		/// <summary>
+		/// 衝突開始時の処理。既定では OnCollision を呼び出します。
+		/// </summary>
+		/// <param name="collider">衝突した相手のコライダーへのポインタ。</param>
+		virtual void OnCollisionEnter(Collider* collider);
+
+		/// <summary>
+		/// 衝突継続中の処理（前フレームから続けて衝突している間、毎フレーム呼ばれる）。既定では OnCollision を呼び出します。
+		/// </summary>
+		/// <param name="collider">衝突している相手のコライダーへのポインタ。</param>
+		virtual void OnCollisionStay(Collider* collider);
+
+		/// <summary>
+		/// 衝突終了時の処理。既定では何もしません。
+		/// </summary>
+		/// <param name="collider">離れた相手のコライダーへのポインタ。</param>
+		virtual void OnCollisionExit(Collider* collider);
+
 	public: /// ===親子関係=== ///
 		// 親の設定
 		void SetParent(ModelCommon* parent);
@@ -74,6 +92,16 @@ namespace MiiEngine {
 		void SetLightData(LightInfo light);
 		// IsCollision
 		void SetIsCollision(bool flag);
+		// IsStatic（AddColliderより前に設定する）
+		void SetIsStatic(bool flag);
+		// IsContinuous（前フレームからの移動を掃引して判定する）
+		void SetIsContinuous(bool flag);
+		// Mass（押し戻しの配分に使用。0 以下は動かない）
+		void SetMass(float mass);
+		// Handle（ColliderManager が登録・削除時に設定する）
+		void SetColliderHandle(ColliderHandle handle);
+		// 連続判定で最初に当たった時刻とその時の中心（ColliderManager が通知前に設定する）
+		void SetImpact(float timeOfImpact, const Vector3& position);
 
 	public: /// ===Getter=== ///
 		// Type
@@ -86,6 +114,18 @@ namespace MiiEngine {
 		Vector4 GetColor() const;
 		// IsCollision
 		bool GetIsCollision() const;
+		// IsStatic
+		bool GetIsStatic() const;
+		// IsContinuous
+		bool GetIsContinuous() const;
+		// Mass
+		float GetMass() const;
+		// Handle（未登録の場合は無効なハンドル）
+		ColliderHandle GetColliderHandle() const;
+		// 今フレームの連続判定で最初に当たった時刻 [0, 1]（掃引で当たっていない場合は 1）
+		float GetTimeOfImpact() const;
+		// その時刻での中心（GetTimeOfImpact() < 1 の時のみ有効）
+		const Vector3& GetImpactPosition() const;
 
 	protected:
 		/// ===Collider=== ///
@@ -105,6 +145,17 @@ namespace MiiEngine {
 		/// ===Collision=== ///
 		// 衝突フラグ
 		bool isCollision_ = false;
+		// 静的フラグ（動かないレベルジオメトリ）
+		bool isStatic_ = false;
+		// 連続判定フラグ（高速で移動し、1フレームで相手をすり抜けるもの）
+		bool isContinuous_ = false;
+		// 質量（押し戻しでは質量の逆数の比で移動量を配分する）
+		float mass_ = 1.0f;
+		// ColliderManager に登録された時のハンドル
+		ColliderHandle handle_{};
+		// 連続判定で最初に当たった時刻とその時の中心
+		float timeOfImpact_ = 1.0f;
+		Vector3 impactPosition_{};
 
 		/// ===Debug=== ///
 	#ifdef _DEBUG
@@ -0,0 +1,485 @@
+#include "CollisionBenchmark.h"
+// BroadPhase
+#include "Engine/Collider/BroadPhase/DynamicAABBTree.h"
+// NarrowPhase
+#include "Engine/Collider/NarrowPhase/ColliderSnapshot.h"
+#include "Engine/Collider/NarrowPhase/NarrowPhaseBatch.h"
+// Math
+#include "Math/sMath.h"
+// c++
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+
+namespace MiiEngine {
+	namespace {
+		using Clock = std::chrono::steady_clock;
+
+		// コマンドラインから "key=値" の値を取得（見つからない場合は空）
+		std::string FindOption(const std::string& commandLine, const std::string& key) {
+			const std::string prefix = key + "=";
+			const size_t begin = commandLine.find(prefix);
+			if (begin == std::string::npos) {
+				return {};
+			}
+			const size_t valueBegin = begin + prefix.size();
+			const size_t valueEnd = commandLine.find(' ', valueBegin);
+			return commandLine.substr(valueBegin, valueEnd == std::string::npos ? std::string::npos : valueEnd - valueBegin);
+		}
+
+		/// ===計測用に動かす球=== ///
+		struct MovingSphere {
+			Vector3 center{};
+			Vector3 velocity{};
+			float radius = 0.0f;
+		};
+
+		// 立方体の中にランダムに配置
+		std::vector<MovingSphere> CreateSpheres(uint32_t count, const CollisionBenchmarkSettings& settings) {
+			std::mt19937 engine(settings.seed);
+			std::uniform_real_distribution<float> position(0.0f, settings.worldSize);
+			std::uniform_real_distribution<float> speed(-settings.maxSpeed, settings.maxSpeed);
+			std::uniform_real_distribution<float> radius(settings.minRadius, settings.maxRadius);
+
+			std::vector<MovingSphere> spheres(count);
+			for (MovingSphere& sphere : spheres) {
+				sphere.center = { position(engine), position(engine), position(engine) };
+				sphere.velocity = { speed(engine), speed(engine), speed(engine) };
+				sphere.radius = radius(engine);
+			}
+			return spheres;
+		}
+
+		// 1フレーム分動かす（立方体の壁で跳ね返る）
+		void StepSpheres(std::vector<MovingSphere>& spheres, float worldSize) {
+			for (MovingSphere& sphere : spheres) {
+				float* center[3] = { &sphere.center.x, &sphere.center.y, &sphere.center.z };
+				float* velocity[3] = { &sphere.velocity.x, &sphere.velocity.y, &sphere.velocity.z };
+				for (int k = 0; k < 3; ++k) {
+					*center[k] += *velocity[k];
+					if (*center[k] < 0.0f || worldSize < *center[k]) {
+						*velocity[k] = -*velocity[k];
+						*center[k] = std::clamp(*center[k], 0.0f, worldSize);
+					}
+				}
+			}
+		}
+
+		// 境界AABB
+		AABB ToAABB(const MovingSphere& sphere) {
+			return { sphere.center - sphere.radius, sphere.center + sphere.radius };
+		}
+
+		// 球・AABB・OBBを順に並べたスナップショットを作成（OBBの姿勢はランダム）
+		void CreateShapes(uint32_t count, const CollisionBenchmarkSettings& settings, ColliderSnapshot& snapshot) {
+			std::mt19937 engine(settings.seed);
+			std::uniform_real_distribution<float> position(0.0f, settings.narrowPhaseWorldSize);
+			std::uniform_real_distribution<float> size(settings.minRadius, settings.maxRadius);
+			std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+
+			snapshot.Clear();
+			for (uint32_t index = 0; index < count; ++index) {
+				const Vector3 center = { position(engine), position(engine), position(engine) };
+				const Vector3 half = { size(engine), size(engine), size(engine) };
+				switch (index % 3) {
+				case 0:
+					snapshot.AddSphere({ center, half.x });
+					break;
+				case 1:
+					snapshot.AddAABB({ center - half, center + half });
+					break;
+				default: {
+					// 2つのランダムな方向から直交する軸を作る
+					OBB obb{};
+					obb.center = center;
+					obb.halfSize = half;
+					const Vector3 forward = Normalize(Vector3{ direction(engine), direction(engine), direction(engine) } + Vector3{ 0.0f, 0.0f, 0.01f });
+					const Vector3 up = Normalize(Math::Cross(forward, Vector3{ direction(engine), direction(engine), direction(engine) } + Vector3{ 0.01f, 0.0f, 0.0f }));
+					obb.axis[0] = Math::Cross(up, forward);
+					obb.axis[1] = up;
+					obb.axis[2] = forward;
+					snapshot.AddOBB(obb);
+					break;
+				}
+				}
+			}
+		}
+
+		/// ===スナップショットから形状を取り出す=== ///
+		Sphere LoadSphere(const ColliderSnapshot& snapshot, int32_t slot) {
+			const ColliderSnapshot::SphereArray& spheres = snapshot.GetSpheres();
+			const int32_t i = snapshot.GetSlot(slot).shapeIndex;
+			return { { spheres.center[0][i], spheres.center[1][i], spheres.center[2][i] }, spheres.radius[i] };
+		}
+		AABB LoadAABB(const ColliderSnapshot& snapshot, int32_t slot) {
+			const ColliderSnapshot::AABBArray& aabbs = snapshot.GetAABBs();
+			const int32_t i = snapshot.GetSlot(slot).shapeIndex;
+			return { { aabbs.min[0][i], aabbs.min[1][i], aabbs.min[2][i] }, { aabbs.max[0][i], aabbs.max[1][i], aabbs.max[2][i] } };
+		}
+		OBB LoadOBB(const ColliderSnapshot& snapshot, int32_t slot) {
+			OBB obb{};
+			if (snapshot.GetSlot(slot).type == ColliderType::AABB) {
+				// AABBは単位軸のOBBとして扱う（ColliderManager::AABBToOBBCollision と同じ）
+				const AABB aabb = LoadAABB(snapshot, slot);
+				obb.center = (aabb.min + aabb.max) * 0.5f;
+				obb.halfSize = (aabb.max - aabb.min) * 0.5f;
+				obb.axis[0] = { 1.0f, 0.0f, 0.0f };
+				obb.axis[1] = { 0.0f, 1.0f, 0.0f };
+				obb.axis[2] = { 0.0f, 0.0f, 1.0f };
+				return obb;
+			}
+			const ColliderSnapshot::OBBArray& obbs = snapshot.GetOBBs();
+			const int32_t i = snapshot.GetSlot(slot).shapeIndex;
+			obb.center = { obbs.center[0][i], obbs.center[1][i], obbs.center[2][i] };
+			obb.halfSize = { obbs.halfSize[0][i], obbs.halfSize[1][i], obbs.halfSize[2][i] };
+			for (int k = 0; k < 3; ++k) {
+				obb.axis[k] = { obbs.axis[k][0][i], obbs.axis[k][1][i], obbs.axis[k][2][i] };
+			}
+			return obb;
+		}
+
+		/// ===ペアごとのスカラー判定（変更前の ColliderManager の判定関数をそのまま移したもの）=== ///
+		bool SphereSphere(const Sphere& a, const Sphere& b) {
+			const float radiusSum = a.radius + b.radius;
+			return Dot(a.center - b.center) <= radiusSum * radiusSum;
+		}
+		bool SphereAABB(const Sphere& sphere, const AABB& aabb) {
+			const Vector3 closest = {
+				std::clamp(sphere.center.x, aabb.min.x, aabb.max.x),
+				std::clamp(sphere.center.y, aabb.min.y, aabb.max.y),
+				std::clamp(sphere.center.z, aabb.min.z, aabb.max.z)
+			};
+			return Dot(sphere.center - closest) <= sphere.radius * sphere.radius;
+		}
+		bool AABBAABB(const AABB& a, const AABB& b) {
+			return AABBUtil::Overlaps(a, b);
+		}
+		bool SphereOBB(const Sphere& sphere, const OBB& obb) {
+			const Vector3 dir = sphere.center - obb.center;
+			const float half[3] = { obb.halfSize.x, obb.halfSize.y, obb.halfSize.z };
+			Vector3 closest = obb.center;
+			for (int i = 0; i < 3; ++i) {
+				const float dist = std::clamp(Dot(dir, obb.axis[i]), -half[i], half[i]);
+				closest += obb.axis[i] * dist;
+			}
+			return Dot(sphere.center - closest) <= sphere.radius * sphere.radius;
+		}
+		// 変更前の ColliderManager::ProjectOBBOntoAxis（軸へ投影した区間）
+		void ProjectOBBOntoAxis(const OBB& obb, const Vector3& axis, float& outMin, float& outMax) {
+			const float centerProjection = Dot(obb.center, axis);
+			const float extents =
+				std::abs(Dot(obb.axis[0] * obb.halfSize.x, axis)) +
+				std::abs(Dot(obb.axis[1] * obb.halfSize.y, axis)) +
+				std::abs(Dot(obb.axis[2] * obb.halfSize.z, axis));
+			outMin = centerProjection - extents;
+			outMax = centerProjection + extents;
+		}
+		// 変更前の ColliderManager::OBBSATCollision（交差軸を正規化する15軸のSAT）
+		bool OBBOBB(const OBB& a, const OBB& b) {
+			const float EPSILON = 1e-6f;
+
+			Vector3 axes[15] = {};
+			int axisCount = 0;
+
+			// 3軸 + 3軸
+			for (int i = 0; i < 3; ++i) {
+				axes[axisCount++] = a.axis[i];
+				axes[axisCount++] = b.axis[i];
+			}
+
+			// 交差軸
+			for (int i = 0; i < 3; ++i) {
+				for (int j = 0; j < 3; ++j) {
+					const Vector3 cross = Math::Cross(a.axis[i], b.axis[j]);
+					if (Dot(cross) > EPSILON) {
+						axes[axisCount++] = Normalize(cross);
+					}
+				}
+			}
+
+			for (int i = 0; i < axisCount; ++i) {
+				float aMin, aMax, bMin, bMax;
+				ProjectOBBOntoAxis(a, axes[i], aMin, aMax);
+				ProjectOBBOntoAxis(b, axes[i], bMin, bMax);
+				if (aMax < bMin || bMax < aMin) {
+					return false; // 分離軸あり → 衝突していない
+				}
+			}
+			return true; // 全軸で重なりあり → 衝突
+		}
+		bool TestScalar(const ColliderSnapshot& snapshot, int32_t slotA, int32_t slotB) {
+			const ColliderType typeA = snapshot.GetSlot(slotA).type;
+			const ColliderType typeB = snapshot.GetSlot(slotB).type;
+			if (typeA == ColliderType::Sphere) {
+				const Sphere a = LoadSphere(snapshot, slotA);
+				switch (typeB) {
+				case ColliderType::Sphere: return SphereSphere(a, LoadSphere(snapshot, slotB));
+				case ColliderType::AABB:   return SphereAABB(a, LoadAABB(snapshot, slotB));
+				case ColliderType::OBB:    return SphereOBB(a, LoadOBB(snapshot, slotB));
+				default:                   return false;
+				}
+			}
+			if (typeB == ColliderType::Sphere) {
+				return TestScalar(snapshot, slotB, slotA);
+			}
+			if (typeA == ColliderType::AABB && typeB == ColliderType::AABB) {
+				return AABBAABB(LoadAABB(snapshot, slotA), LoadAABB(snapshot, slotB));
+			}
+			return OBBOBB(LoadOBB(snapshot, slotA), LoadOBB(snapshot, slotB));
+		}
+	}
+
+	///-------------------------------------------///
+	/// ブロードフェーズの計測
+	///-------------------------------------------///
+	std::vector<CollisionBroadPhaseResult> CollisionBenchmark::RunBroadPhase(const CollisionBenchmarkSettings& settings) {
+		std::vector<CollisionBroadPhaseResult> results;
+		results.reserve(settings.objectCounts.size());
+
+		for (uint32_t objectCount : settings.objectCounts) {
+			CollisionBroadPhaseResult result;
+			result.objectCount = objectCount;
+
+			std::vector<MovingSphere> spheres = CreateSpheres(objectCount, settings);
+			std::vector<AABB> bounds(objectCount);
+			std::vector<int32_t> proxies(objectCount, DynamicAABBTree::kNullNode);
+			std::vector<Vector3> lastCenters(objectCount);
+			std::vector<int32_t> queryBuffer;
+			DynamicAABBTree tree;
+
+			double treeMs = 0.0;
+			double bruteForceMs = 0.0;
+			uint64_t candidatePairs = 0;
+			uint64_t hitPairs = 0;
+
+			for (uint32_t frame = 0; frame < settings.frameCount; ++frame) {
+				StepSpheres(spheres, settings.worldSize);
+				for (uint32_t index = 0; index < objectCount; ++index) {
+					bounds[index] = ToAABB(spheres[index]);
+				}
+
+				/// ===AABB木（ColliderManager::UpdateBroadPhase と同じ手順）=== ///
+				Clock::time_point start = Clock::now();
+				for (uint32_t index = 0; index < objectCount; ++index) {
+					const Vector3 center = spheres[index].center;
+					if (proxies[index] == DynamicAABBTree::kNullNode) {
+						proxies[index] = tree.CreateProxy(bounds[index], reinterpret_cast<void*>(static_cast<uintptr_t>(index)));
+					} else {
+						tree.MoveProxy(proxies[index], bounds[index], center - lastCenters[index]);
+					}
+					lastCenters[index] = center;
+				}
+				uint64_t treeHits = 0;
+				for (uint32_t indexA = 0; indexA < objectCount; ++indexA) {
+					queryBuffer.clear();
+					tree.Query(bounds[indexA], queryBuffer);
+					for (int32_t proxyId : queryBuffer) {
+						const uint32_t indexB = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(tree.GetUserData(proxyId)));
+						// 同じペアを2回数えないよう、番号が大きい相手だけを判定
+						if (indexB <= indexA) {
+							continue;
+						}
+						++candidatePairs;
+						if (AABBUtil::Overlaps(bounds[indexA], bounds[indexB])) {
+							++treeHits;
+						}
+					}
+				}
+				treeMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+				/// ===総当たり=== ///
+				start = Clock::now();
+				uint64_t bruteForceHits = 0;
+				for (uint32_t indexA = 0; indexA < objectCount; ++indexA) {
+					for (uint32_t indexB = indexA + 1; indexB < objectCount; ++indexB) {
+						if (AABBUtil::Overlaps(bounds[indexA], bounds[indexB])) {
+							++bruteForceHits;
+						}
+					}
+				}
+				bruteForceMs += std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+				// AABB木で見つかったペアは総当たりのペアの部分集合なので、数の差が取りこぼしになる
+				hitPairs += bruteForceHits;
+				result.missedPairs += bruteForceHits - treeHits;
+			}
+
+			const double frames = static_cast<double>((std::max)(settings.frameCount, 1u));
+			result.treeMsPerFrame = treeMs / frames;
+			result.bruteForceMsPerFrame = bruteForceMs / frames;
+			result.candidatePairsPerFrame = static_cast<double>(candidatePairs) / frames;
+			result.hitPairsPerFrame = static_cast<double>(hitPairs) / frames;
+			result.treeHeight = tree.GetHeight();
+			results.push_back(result);
+		}
+		return results;
+	}
+
+	///-------------------------------------------///
+	/// 詳細判定の計測
+	///-------------------------------------------///
+	std::vector<CollisionNarrowPhaseResult> CollisionBenchmark::RunNarrowPhase(const CollisionBenchmarkSettings& settings) {
+		std::vector<CollisionNarrowPhaseResult> results;
+		results.reserve(settings.narrowPhaseObjectCounts.size());
+
+		ColliderSnapshot snapshot;
+		NarrowPhaseBatch batch;
+		std::vector<int32_t> candidates;
+		std::vector<uint8_t> hits;
+
+		for (uint32_t objectCount : settings.narrowPhaseObjectCounts) {
+			CollisionNarrowPhaseResult result;
+			result.objectCount = objectCount;
+			result.isAVX2Supported = batch.IsAVX2Supported();
+			CreateShapes(objectCount, settings, snapshot);
+			const int32_t slotCount = snapshot.GetSlotCount();
+
+			/// ===スカラー判定（基準の結果）=== ///
+			std::vector<uint8_t> expected;
+			expected.reserve(static_cast<size_t>(slotCount) * slotCount / 2);
+			Clock::time_point start = Clock::now();
+			for (uint32_t iteration = 0; iteration < settings.narrowPhaseIterationCount; ++iteration) {
+				expected.clear();
+				for (int32_t slotA = 0; slotA < slotCount; ++slotA) {
+					for (int32_t slotB = slotA + 1; slotB < slotCount; ++slotB) {
+						expected.push_back(TestScalar(snapshot, slotA, slotB) ? 1 : 0);
+					}
+				}
+			}
+			const double scalarNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+			result.pairCount = expected.size();
+			result.hitPairs = static_cast<uint64_t>(std::count(expected.begin(), expected.end(), uint8_t(1)));
+
+			/// ===バッチ判定（ColliderManager と同じく1対多で判定）=== ///
+			auto runBatch = [&](bool useAVX2, uint64_t& outMismatches) {
+				batch.SetUseAVX2(useAVX2);
+				const Clock::time_point batchStart = Clock::now();
+				for (uint32_t iteration = 0; iteration < settings.narrowPhaseIterationCount; ++iteration) {
+					size_t pairIndex = 0;
+					outMismatches = 0;
+					for (int32_t slotA = 0; slotA < slotCount; ++slotA) {
+						candidates.clear();
+						for (int32_t slotB = slotA + 1; slotB < slotCount; ++slotB) {
+							candidates.push_back(slotB);
+						}
+						batch.Test(snapshot, slotA, candidates, hits);
+						for (uint8_t hit : hits) {
+							if (hit != expected[pairIndex++]) {
+								++outMismatches;
+							}
+						}
+					}
+				}
+				return std::chrono::duration<double, std::nano>(Clock::now() - batchStart).count();
+			};
+			const double sseNs = runBatch(false, result.sseMismatches);
+			const double avx2Ns = result.isAVX2Supported ? runBatch(true, result.avx2Mismatches) : 0.0;
+
+			const double pairTests = (std::max)(static_cast<double>(result.pairCount) * settings.narrowPhaseIterationCount, 1.0);
+			result.scalarNsPerPair = scalarNs / pairTests;
+			result.sseNsPerPair = sseNs / pairTests;
+			result.avx2NsPerPair = avx2Ns / pairTests;
+			results.push_back(result);
+		}
+		return results;
+	}
+
+	///-------------------------------------------///
+	/// JSONに変換
+	///-------------------------------------------///
+	nlohmann::json CollisionBenchmark::ToJson(const std::vector<CollisionBroadPhaseResult>& broadPhase, const std::vector<CollisionNarrowPhaseResult>& narrowPhase,
+		const CollisionBenchmarkSettings& settings) {
+		nlohmann::json json;
+		json["settings"] = {
+			{"objectCounts", settings.objectCounts},
+			{"frameCount", settings.frameCount},
+			{"worldSize", settings.worldSize},
+			{"minRadius", settings.minRadius},
+			{"maxRadius", settings.maxRadius},
+			{"maxSpeed", settings.maxSpeed},
+			{"seed", settings.seed},
+			{"narrowPhaseObjectCounts", settings.narrowPhaseObjectCounts},
+			{"narrowPhaseWorldSize", settings.narrowPhaseWorldSize},
+			{"narrowPhaseIterationCount", settings.narrowPhaseIterationCount},
+			{"hardwareThreadCount", std::thread::hardware_concurrency()}
+		};
+
+		nlohmann::json entries = nlohmann::json::array();
+		for (const CollisionBroadPhaseResult& result : broadPhase) {
+			entries.push_back({
+				{"objectCount", result.objectCount},
+				{"treeMsPerFrame", result.treeMsPerFrame},
+				{"bruteForceMsPerFrame", result.bruteForceMsPerFrame},
+				{"candidatePairsPerFrame", result.candidatePairsPerFrame},
+				{"hitPairsPerFrame", result.hitPairsPerFrame},
+				{"missedPairs", result.missedPairs},
+				{"treeHeight", result.treeHeight}
+			});
+		}
+		json["broadPhase"] = entries;
+
+		nlohmann::json narrowPhaseEntries = nlohmann::json::array();
+		for (const CollisionNarrowPhaseResult& result : narrowPhase) {
+			narrowPhaseEntries.push_back({
+				{"objectCount", result.objectCount},
+				{"pairCount", result.pairCount},
+				{"hitPairs", result.hitPairs},
+				{"scalarNsPerPair", result.scalarNsPerPair},
+				{"sseNsPerPair", result.sseNsPerPair},
+				{"avx2NsPerPair", result.avx2NsPerPair},
+				{"isAVX2Supported", result.isAVX2Supported},
+				{"sseMismatches", result.sseMismatches},
+				{"avx2Mismatches", result.avx2Mismatches}
+			});
+		}
+		json["narrowPhase"] = narrowPhaseEntries;
+		return json;
+	}
+
+	///-------------------------------------------///
+	/// コマンドラインから実行
+	///-------------------------------------------///
+	int CollisionBenchmark::RunFromCommandLine(const std::string& commandLine) {
+		CollisionBenchmarkSettings settings;
+		std::string outputPath = kDefaultOutputPath;
+
+		/// ===引数の読み取り=== ///
+		if (const std::string value = FindOption(commandLine, "--collision-benchmark-out"); !value.empty()) {
+			outputPath = value;
+		}
+		if (const std::string value = FindOption(commandLine, "--collision-benchmark-frames"); !value.empty()) {
+			settings.frameCount = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+		}
+		if (settings.frameCount == 0) {
+			return 1;
+		}
+
+		/// ===計測して書き込み=== ///
+		const std::vector<CollisionBroadPhaseResult> broadPhase = RunBroadPhase(settings);
+		const std::vector<CollisionNarrowPhaseResult> narrowPhase = RunNarrowPhase(settings);
+		std::ofstream file(outputPath);
+		if (!file.is_open()) {
+			return 1;
+		}
+		file << ToJson(broadPhase, narrowPhase, settings).dump(4);
+
+		// 総当たり・スカラー判定と結果が一致しなければ失敗
+		for (const CollisionBroadPhaseResult& result : broadPhase) {
+			if (result.missedPairs != 0) {
+				return 1;
+			}
+		}
+		for (const CollisionNarrowPhaseResult& result : narrowPhase) {
+			if (result.sseMismatches != 0 || result.avx2Mismatches != 0) {
+				return 1;
+			}
+		}
+		return 0;
+	}
+}
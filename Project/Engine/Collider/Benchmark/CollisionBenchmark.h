@@ -0,0 +1,101 @@
+#pragma once
+/// ===Include=== ///
+// c++
+#include <cstdint>
+#include <string>
+#include <vector>
+// JSON
+#include <json.hpp>
+
+namespace MiiEngine {
+	///=====================================================///
+	/// ベンチマークの設定
+	///=====================================================///
+	struct CollisionBenchmarkSettings {
+		std::vector<uint32_t> objectCounts = { 100, 1000, 10000 }; // 計測するオブジェクト数
+		uint32_t frameCount = 60;                                 // 計測するフレーム数
+		float worldSize = 100.0f;                                 // オブジェクトを動かす立方体の一辺
+		float minRadius = 0.5f;                                   // オブジェクトの半径の最小値
+		float maxRadius = 1.5f;                                   // オブジェクトの半径の最大値
+		float maxSpeed = 0.3f;                                    // 1フレームあたりの最大移動量
+		uint32_t seed = 12345;                                    // 配置と速度の乱数のシード
+		std::vector<uint32_t> narrowPhaseObjectCounts = { 256, 1024 }; // 詳細判定を計測するオブジェクト数（球・AABB・OBBを同数ずつ）
+		float narrowPhaseWorldSize = 20.0f;                       // 詳細判定で形状を置く立方体の一辺（衝突するペアが出るよう狭くする）
+		uint32_t narrowPhaseIterationCount = 5;                   // 詳細判定で全ペアを判定する回数
+	};
+
+	///=====================================================///
+	/// ブロードフェーズの計測結果
+	///=====================================================///
+	struct CollisionBroadPhaseResult {
+		uint32_t objectCount = 0;            // オブジェクト数
+		double treeMsPerFrame = 0.0;         // AABB木の更新・検索・AABB判定の1フレームあたりの時間（ms）
+		double bruteForceMsPerFrame = 0.0;   // 総当たり（従来の方法）の1フレームあたりの時間（ms）
+		double candidatePairsPerFrame = 0.0; // AABB木が返した候補ペア数の平均
+		double hitPairsPerFrame = 0.0;       // 実際に重なっていたペア数の平均
+		uint64_t missedPairs = 0;            // 総当たりでは重なっていたのに候補に入らなかったペアの総数（0 でなければ不具合）
+		int32_t treeHeight = 0;              // 最終フレームの木の高さ
+	};
+
+	///=====================================================///
+	/// 詳細判定の計測結果
+	///=====================================================///
+	struct CollisionNarrowPhaseResult {
+		uint32_t objectCount = 0;      // オブジェクト数
+		uint64_t pairCount = 0;        // 判定したペア数（総当たり）
+		uint64_t hitPairs = 0;         // 衝突していたペア数
+		double scalarNsPerPair = 0.0;  // ペアごとのスカラー判定（変更前の ColliderManager の判定関数、OBBは15軸SAT）の1ペアあたりの時間（ns）
+		double sseNsPerPair = 0.0;     // NarrowPhaseBatch（SSE）の1ペアあたりの時間（ns）
+		double avx2NsPerPair = 0.0;    // NarrowPhaseBatch（AVX2）の1ペアあたりの時間（ns、非対応の場合は 0）
+		bool isAVX2Supported = false;  // CPUがAVX2に対応しているか
+		uint64_t sseMismatches = 0;    // スカラー判定と結果が異なったペア数（SSE、0 でなければ不具合）
+		uint64_t avx2Mismatches = 0;   // スカラー判定と結果が異なったペア数（AVX2、0 でなければ不具合）
+	};
+
+	///=====================================================///
+	/// CollisionBenchmark
+	/// ウィンドウと D3D12 を作らずに、生成した形状で当たり判定の処理を計測する
+	///=====================================================///
+	class CollisionBenchmark {
+	public:
+
+		/// <summary>
+		/// オブジェクト数ごとに、ColliderManager と同じ手順（太らせたAABBの移動・検索・AABB判定）で
+		/// 重なっているペアを求め、総当たりとの時間と結果を比較
+		/// </summary>
+		/// <param name="settings">ベンチマークの設定</param>
+		/// <returns>objectCounts の順の計測結果</returns>
+		static std::vector<CollisionBroadPhaseResult> RunBroadPhase(const CollisionBenchmarkSettings& settings);
+
+		/// <summary>
+		/// オブジェクト数ごとに、ランダムな球・AABB・OBBの全ペアを NarrowPhaseBatch（SSE / AVX2）と
+		/// 変更前の ColliderManager のペアごとのスカラー判定で判定し、時間と結果の一致を比較
+		/// </summary>
+		/// <param name="settings">ベンチマークの設定</param>
+		/// <returns>narrowPhaseObjectCounts の順の計測結果</returns>
+		static std::vector<CollisionNarrowPhaseResult> RunNarrowPhase(const CollisionBenchmarkSettings& settings);
+
+		/// <summary>
+		/// 計測結果を JSON に変換（回帰の比較用）
+		/// </summary>
+		/// <param name="broadPhase">ブロードフェーズの計測結果</param>
+		/// <param name="narrowPhase">詳細判定の計測結果</param>
+		/// <param name="settings">計測時の設定</param>
+		/// <returns>設定と結果をまとめた JSON</returns>
+		static nlohmann::json ToJson(const std::vector<CollisionBroadPhaseResult>& broadPhase, const std::vector<CollisionNarrowPhaseResult>& narrowPhase,
+			const CollisionBenchmarkSettings& settings);
+
+		/// <summary>
+		/// コマンドラインから実行（--collision-benchmark が含まれる場合に main から呼ぶ）
+		/// 指定できる引数: --collision-benchmark-out=パス --collision-benchmark-frames=フレーム数
+		/// </summary>
+		/// <param name="commandLine">コマンドライン引数</param>
+		/// <returns>終了コード（結果を書き込めなかった場合・総当たりと結果が異なった場合は 1）</returns>
+		static int RunFromCommandLine(const std::string& commandLine);
+
+	private:
+
+		// 結果の既定の出力先
+		static constexpr const char* kDefaultOutputPath = "CollisionBenchmark.json";
+	};
+}
@@ -0,0 +1,474 @@
+#include "DynamicAABBTree.h"
+// c++
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace MiiEngine {
+	namespace {
+		// 走査用のスタック（木の高さに上限はないので伸長可能にし、スレッドごとに使い回して毎回の確保を避ける）
+		std::vector<int32_t>& GetTraversalStack() {
+			thread_local std::vector<int32_t> stack;
+			stack.clear();
+			return stack;
+		}
+	}
+
+	///-------------------------------------------///
+	/// AABBのヘルパー
+	///-------------------------------------------///
+	namespace AABBUtil {
+		AABB Union(const AABB& a, const AABB& b) {
+			AABB result;
+			result.min = { (std::min)(a.min.x, b.min.x), (std::min)(a.min.y, b.min.y), (std::min)(a.min.z, b.min.z) };
+			result.max = { (std::max)(a.max.x, b.max.x), (std::max)(a.max.y, b.max.y), (std::max)(a.max.z, b.max.z) };
+			return result;
+		}
+		bool Contains(const AABB& a, const AABB& b) {
+			return a.min.x <= b.min.x && a.min.y <= b.min.y && a.min.z <= b.min.z &&
+				b.max.x <= a.max.x && b.max.y <= a.max.y && b.max.z <= a.max.z;
+		}
+		bool Overlaps(const AABB& a, const AABB& b) {
+			return (a.min.x <= b.max.x && a.max.x >= b.min.x) &&
+				(a.min.y <= b.max.y && a.max.y >= b.min.y) &&
+				(a.min.z <= b.max.z && a.max.z >= b.min.z);
+		}
+		float SurfaceArea(const AABB& a) {
+			float dx = a.max.x - a.min.x;
+			float dy = a.max.y - a.min.y;
+			float dz = a.max.z - a.min.z;
+			return 2.0f * (dx * dy + dy * dz + dz * dx);
+		}
+		Vector3 InverseDirection(const Vector3& direction) {
+			// 0 除算で NaN にならないよう、軸に平行な成分は大きな値にする
+			constexpr float kLarge = 1e30f;
+			return {
+				direction.x != 0.0f ? 1.0f / direction.x : kLarge,
+				direction.y != 0.0f ? 1.0f / direction.y : kLarge,
+				direction.z != 0.0f ? 1.0f / direction.z : kLarge
+			};
+		}
+		bool RayOverlaps(const AABB& a, const Vector3& origin, const Vector3& invDirection, float maxDistance, float radius) {
+			const float mn[3] = { a.min.x - radius, a.min.y - radius, a.min.z - radius };
+			const float mx[3] = { a.max.x + radius, a.max.y + radius, a.max.z + radius };
+			const float o[3] = { origin.x, origin.y, origin.z };
+			const float inv[3] = { invDirection.x, invDirection.y, invDirection.z };
+
+			float tMin = 0.0f;
+			float tMax = maxDistance;
+			for (int k = 0; k < 3; ++k) {
+				float t1 = (mn[k] - o[k]) * inv[k];
+				float t2 = (mx[k] - o[k]) * inv[k];
+				tMin = (std::max)(tMin, (std::min)(t1, t2));
+				tMax = (std::min)(tMax, (std::max)(t1, t2));
+			}
+			return tMin <= tMax;
+		}
+		Vector3 OBBExtent(const Vector3 axis[3], const Vector3& halfSize) {
+			// 各軸の寄与の絶対値和がワールド軸方向の半径になる
+			return {
+				std::abs(axis[0].x) * halfSize.x + std::abs(axis[1].x) * halfSize.y + std::abs(axis[2].x) * halfSize.z,
+				std::abs(axis[0].y) * halfSize.x + std::abs(axis[1].y) * halfSize.y + std::abs(axis[2].y) * halfSize.z,
+				std::abs(axis[0].z) * halfSize.x + std::abs(axis[1].z) * halfSize.y + std::abs(axis[2].z) * halfSize.z
+			};
+		}
+		AABB FromOBB(const OBB& obb) {
+			const Vector3 extent = OBBExtent(obb.axis, obb.halfSize);
+			return { obb.center - extent, obb.center + extent };
+		}
+	}
+
+	///-------------------------------------------///
+	/// Getter
+	///-------------------------------------------///
+	void* DynamicAABBTree::GetUserData(int32_t proxyId) const { return nodes_[proxyId].userData; }
+	const AABB& DynamicAABBTree::GetFatAABB(int32_t proxyId) const { return nodes_[proxyId].aabb; }
+	int32_t DynamicAABBTree::GetHeight() const { return (root_ == kNullNode) ? 0 : nodes_[root_].height; }
+	int32_t DynamicAABBTree::GetProxyCount() const { return proxyCount_; }
+	int32_t DynamicAABBTree::GetNodeCapacity() const { return static_cast<int32_t>(nodes_.size()); }
+
+	///-------------------------------------------///
+	/// プロキシの生成
+	///-------------------------------------------///
+	int32_t DynamicAABBTree::CreateProxy(const AABB& aabb, void* userData) {
+		int32_t proxyId = AllocateNode();
+
+		// マージン分だけ太らせる
+		nodes_[proxyId].aabb.min = aabb.min - kFatMargin;
+		nodes_[proxyId].aabb.max = aabb.max + kFatMargin;
+		nodes_[proxyId].userData = userData;
+		nodes_[proxyId].height = 0;
+
+		InsertLeaf(proxyId);
+		++proxyCount_;
+		return proxyId;
+	}
+
+	///-------------------------------------------///
+	/// プロキシの削除
+	///-------------------------------------------///
+	void DynamicAABBTree::DestroyProxy(int32_t proxyId) {
+		assert(0 <= proxyId && proxyId < GetNodeCapacity());
+		assert(nodes_[proxyId].IsLeaf());
+
+		RemoveLeaf(proxyId);
+		FreeNode(proxyId);
+		--proxyCount_;
+	}
+
+	///-------------------------------------------///
+	/// プロキシの移動
+	///-------------------------------------------///
+	bool DynamicAABBTree::MoveProxy(int32_t proxyId, const AABB& aabb, const Vector3& displacement) {
+		assert(0 <= proxyId && proxyId < GetNodeCapacity());
+		assert(nodes_[proxyId].IsLeaf());
+
+		// 太らせたAABBに収まっている間は何もしない
+		if (AABBUtil::Contains(nodes_[proxyId].aabb, aabb)) {
+			return false;
+		}
+
+		RemoveLeaf(proxyId);
+
+		// マージンと移動方向への先読み分を加えて太らせる
+		AABB fat;
+		fat.min = aabb.min - kFatMargin;
+		fat.max = aabb.max + kFatMargin;
+		Vector3 d = displacement * kDisplacementMultiplier;
+		if (d.x < 0.0f) { fat.min.x += d.x; } else { fat.max.x += d.x; }
+		if (d.y < 0.0f) { fat.min.y += d.y; } else { fat.max.y += d.y; }
+		if (d.z < 0.0f) { fat.min.z += d.z; } else { fat.max.z += d.z; }
+		nodes_[proxyId].aabb = fat;
+
+		InsertLeaf(proxyId);
+		return true;
+	}
+
+	///-------------------------------------------///
+	/// AABBによる検索
+	///-------------------------------------------///
+	void DynamicAABBTree::Query(const AABB& aabb, std::vector<int32_t>& outProxies) const {
+		if (root_ == kNullNode) {
+			return;
+		}
+
+		// 再帰を避けるためスタックで走査
+		std::vector<int32_t>& stack = GetTraversalStack();
+		stack.push_back(root_);
+
+		while (!stack.empty()) {
+			int32_t nodeId = stack.back();
+			stack.pop_back();
+			const TreeNode& node = nodes_[nodeId];
+
+			if (!AABBUtil::Overlaps(node.aabb, aabb)) {
+				continue;
+			}
+
+			if (node.IsLeaf()) {
+				outProxies.push_back(nodeId);
+			} else {
+				stack.push_back(node.child1);
+				stack.push_back(node.child2);
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// 線分による検索
+	///-------------------------------------------///
+	void DynamicAABBTree::RayQuery(const Vector3& origin, const Vector3& direction, float maxDistance, float radius, std::vector<int32_t>& outProxies) const {
+		if (root_ == kNullNode) {
+			return;
+		}
+		const Vector3 invDirection = AABBUtil::InverseDirection(direction);
+
+		std::vector<int32_t>& stack = GetTraversalStack();
+		stack.push_back(root_);
+
+		while (!stack.empty()) {
+			int32_t nodeId = stack.back();
+			stack.pop_back();
+			const TreeNode& node = nodes_[nodeId];
+
+			if (!AABBUtil::RayOverlaps(node.aabb, origin, invDirection, maxDistance, radius)) {
+				continue;
+			}
+
+			if (node.IsLeaf()) {
+				outProxies.push_back(nodeId);
+			} else {
+				stack.push_back(node.child1);
+				stack.push_back(node.child2);
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// クリア
+	///-------------------------------------------///
+	void DynamicAABBTree::Clear() {
+		nodes_.clear();
+		root_ = kNullNode;
+		freeList_ = kNullNode;
+		proxyCount_ = 0;
+	}
+
+	///-------------------------------------------///
+	/// ノードの確保
+	///-------------------------------------------///
+	int32_t DynamicAABBTree::AllocateNode() {
+		// 空きがなければ末尾に追加
+		if (freeList_ == kNullNode) {
+			nodes_.emplace_back();
+			return static_cast<int32_t>(nodes_.size()) - 1;
+		}
+
+		// フリーリストから取り出す
+		int32_t nodeId = freeList_;
+		freeList_ = nodes_[nodeId].parent;
+		nodes_[nodeId] = TreeNode{};
+		return nodeId;
+	}
+
+	///-------------------------------------------///
+	/// ノードの解放
+	///-------------------------------------------///
+	void DynamicAABBTree::FreeNode(int32_t nodeId) {
+		nodes_[nodeId].parent = freeList_;
+		nodes_[nodeId].child1 = kNullNode;
+		nodes_[nodeId].child2 = kNullNode;
+		nodes_[nodeId].userData = nullptr;
+		nodes_[nodeId].height = -1;
+		freeList_ = nodeId;
+	}
+
+	///-------------------------------------------///
+	/// 葉の挿入
+	///-------------------------------------------///
+	void DynamicAABBTree::InsertLeaf(int32_t leaf) {
+		if (root_ == kNullNode) {
+			root_ = leaf;
+			nodes_[root_].parent = kNullNode;
+			return;
+		}
+
+		/// ===表面積ヒューリスティックで兄弟ノードを探す=== ///
+		AABB leafAABB = nodes_[leaf].aabb;
+		int32_t index = root_;
+		while (!nodes_[index].IsLeaf()) {
+			int32_t child1 = nodes_[index].child1;
+			int32_t child2 = nodes_[index].child2;
+
+			float area = AABBUtil::SurfaceArea(nodes_[index].aabb);
+			float combinedArea = AABBUtil::SurfaceArea(AABBUtil::Union(nodes_[index].aabb, leafAABB));
+
+			// このノードを兄弟にして新しい親を作るコスト
+			float cost = 2.0f * combinedArea;
+			// 下位へ降りる場合に祖先が受け持つ増分コスト
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			// 子に降りた場合のコスト
+			auto descendCost = [&](int32_t child) {
+				AABB merged = AABBUtil::Union(leafAABB, nodes_[child].aabb);
+				if (nodes_[child].IsLeaf()) {
+					return AABBUtil::SurfaceArea(merged) + inheritanceCost;
+				}
+				float oldArea = AABBUtil::SurfaceArea(nodes_[child].aabb);
+				float newArea = AABBUtil::SurfaceArea(merged);
+				return (newArea - oldArea) + inheritanceCost;
+			};
+			float cost1 = descendCost(child1);
+			float cost2 = descendCost(child2);
+
+			// ここで兄弟にするのが最も安い
+			if (cost < cost1 && cost < cost2) {
+				break;
+			}
+
+			index = (cost1 < cost2) ? child1 : child2;
+		}
+		int32_t sibling = index;
+
+		/// ===新しい親を作成=== ///
+		int32_t oldParent = nodes_[sibling].parent;
+		int32_t newParent = AllocateNode();
+		nodes_[newParent].parent = oldParent;
+		nodes_[newParent].userData = nullptr;
+		nodes_[newParent].aabb = AABBUtil::Union(leafAABB, nodes_[sibling].aabb);
+		nodes_[newParent].height = nodes_[sibling].height + 1;
+
+		if (oldParent != kNullNode) {
+			// 兄弟がルートでない場合
+			if (nodes_[oldParent].child1 == sibling) {
+				nodes_[oldParent].child1 = newParent;
+			} else {
+				nodes_[oldParent].child2 = newParent;
+			}
+		} else {
+			// 兄弟がルートだった場合
+			root_ = newParent;
+		}
+		nodes_[newParent].child1 = sibling;
+		nodes_[newParent].child2 = leaf;
+		nodes_[sibling].parent = newParent;
+		nodes_[leaf].parent = newParent;
+
+		/// ===祖先のAABBと高さを更新=== ///
+		RefitAncestors(nodes_[leaf].parent);
+	}
+
+	///-------------------------------------------///
+	/// 葉の取り外し
+	///-------------------------------------------///
+	void DynamicAABBTree::RemoveLeaf(int32_t leaf) {
+		if (leaf == root_) {
+			root_ = kNullNode;
+			return;
+		}
+
+		int32_t parent = nodes_[leaf].parent;
+		int32_t grandParent = nodes_[parent].parent;
+		int32_t sibling = (nodes_[parent].child1 == leaf) ? nodes_[parent].child2 : nodes_[parent].child1;
+
+		if (grandParent != kNullNode) {
+			// 親を取り除き、兄弟を祖父に繋ぐ
+			if (nodes_[grandParent].child1 == parent) {
+				nodes_[grandParent].child1 = sibling;
+			} else {
+				nodes_[grandParent].child2 = sibling;
+			}
+			nodes_[sibling].parent = grandParent;
+			FreeNode(parent);
+
+			RefitAncestors(grandParent);
+		} else {
+			root_ = sibling;
+			nodes_[sibling].parent = kNullNode;
+			FreeNode(parent);
+		}
+	}
+
+	///-------------------------------------------///
+	/// 祖先の更新
+	///-------------------------------------------///
+	void DynamicAABBTree::RefitAncestors(int32_t nodeId) {
+		int32_t index = nodeId;
+		while (index != kNullNode) {
+			index = Balance(index);
+
+			int32_t child1 = nodes_[index].child1;
+			int32_t child2 = nodes_[index].child2;
+
+			nodes_[index].height = 1 + (std::max)(nodes_[child1].height, nodes_[child2].height);
+			nodes_[index].aabb = AABBUtil::Union(nodes_[child1].aabb, nodes_[child2].aabb);
+
+			index = nodes_[index].parent;
+		}
+	}
+
+	///-------------------------------------------///
+	/// 回転による平衡化
+	///-------------------------------------------///
+	int32_t DynamicAABBTree::Balance(int32_t iA) {
+		TreeNode* A = &nodes_[iA];
+		if (A->IsLeaf() || A->height < 2) {
+			return iA;
+		}
+
+		int32_t iB = A->child1;
+		int32_t iC = A->child2;
+		TreeNode* B = &nodes_[iB];
+		TreeNode* C = &nodes_[iC];
+
+		int32_t balance = C->height - B->height;
+
+		/// ===Cを持ち上げる=== ///
+		if (balance > 1) {
+			int32_t iF = C->child1;
+			int32_t iG = C->child2;
+			TreeNode* F = &nodes_[iF];
+			TreeNode* G = &nodes_[iG];
+
+			// AとCを入れ替える
+			C->child1 = iA;
+			C->parent = A->parent;
+			A->parent = iC;
+
+			if (C->parent != kNullNode) {
+				if (nodes_[C->parent].child1 == iA) {
+					nodes_[C->parent].child1 = iC;
+				} else {
+					nodes_[C->parent].child2 = iC;
+				}
+			} else {
+				root_ = iC;
+			}
+
+			// 高い方の子をCに残す
+			if (F->height > G->height) {
+				C->child2 = iF;
+				A->child2 = iG;
+				G->parent = iA;
+				A->aabb = AABBUtil::Union(B->aabb, G->aabb);
+				C->aabb = AABBUtil::Union(A->aabb, F->aabb);
+				A->height = 1 + (std::max)(B->height, G->height);
+				C->height = 1 + (std::max)(A->height, F->height);
+			} else {
+				C->child2 = iG;
+				A->child2 = iF;
+				F->parent = iA;
+				A->aabb = AABBUtil::Union(B->aabb, F->aabb);
+				C->aabb = AABBUtil::Union(A->aabb, G->aabb);
+				A->height = 1 + (std::max)(B->height, F->height);
+				C->height = 1 + (std::max)(A->height, G->height);
+			}
+			return iC;
+		}
+
+		/// ===Bを持ち上げる=== ///
+		if (balance < -1) {
+			int32_t iD = B->child1;
+			int32_t iE = B->child2;
+			TreeNode* D = &nodes_[iD];
+			TreeNode* E = &nodes_[iE];
+
+			// AとBを入れ替える
+			B->child1 = iA;
+			B->parent = A->parent;
+			A->parent = iB;
+
+			if (B->parent != kNullNode) {
+				if (nodes_[B->parent].child1 == iA) {
+					nodes_[B->parent].child1 = iB;
+				} else {
+					nodes_[B->parent].child2 = iB;
+				}
+			} else {
+				root_ = iB;
+			}
+
+			// 高い方の子をBに残す
+			if (D->height > E->height) {
+				B->child2 = iD;
+				A->child1 = iE;
+				E->parent = iA;
+				A->aabb = AABBUtil::Union(C->aabb, E->aabb);
+				B->aabb = AABBUtil::Union(A->aabb, D->aabb);
+				A->height = 1 + (std::max)(C->height, E->height);
+				B->height = 1 + (std::max)(A->height, D->height);
+			} else {
+				B->child2 = iE;
+				A->child1 = iD;
+				D->parent = iA;
+				A->aabb = AABBUtil::Union(C->aabb, D->aabb);
+				B->aabb = AABBUtil::Union(A->aabb, E->aabb);
+				A->height = 1 + (std::max)(C->height, D->height);
+				B->height = 1 + (std::max)(A->height, E->height);
+			}
+			return iB;
+		}
+
+		return iA;
+	}
+}
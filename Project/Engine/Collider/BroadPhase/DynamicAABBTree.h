@@ -0,0 +1,163 @@
+#pragma once
+/// ===Include=== ///
+// Data
+#include "Engine/DataInfo/ColliderData.h"
+// c++
+#include <cstdint>
+#include <vector>
+
+namespace MiiEngine {
+	///=====================================================///
+	/// DynamicAABBTree
+	/// 太らせたAABBを葉に持つ動的BVH。移動量が小さい間は再挿入しない
+	///=====================================================///
+	class DynamicAABBTree {
+	public:
+
+		DynamicAABBTree() = default;
+		~DynamicAABBTree() = default;
+
+		// 無効なノード番号
+		static constexpr int32_t kNullNode = -1;
+
+		/// <summary>
+		/// プロキシの生成処理
+		/// </summary>
+		/// <param name="aabb">登録するオブジェクトの境界AABB。内部でマージン分だけ太らせて保持します。</param>
+		/// <param name="userData">プロキシに紐づけるユーザーデータ。</param>
+		/// <returns>生成したプロキシのID。</returns>
+		int32_t CreateProxy(const AABB& aabb, void* userData);
+
+		/// <summary>
+		/// プロキシの削除処理
+		/// </summary>
+		/// <param name="proxyId">削除するプロキシのID。</param>
+		void DestroyProxy(int32_t proxyId);
+
+		/// <summary>
+		/// プロキシの移動処理。太らせたAABBからはみ出した時だけ木を組み替えます。
+		/// </summary>
+		/// <param name="proxyId">移動するプロキシのID。</param>
+		/// <param name="aabb">移動後の境界AABB。</param>
+		/// <param name="displacement">前フレームからの移動量。移動方向にAABBを先読みで広げるために使用します。</param>
+		/// <returns>木の再挿入が行われた場合は true。</returns>
+		bool MoveProxy(int32_t proxyId, const AABB& aabb, const Vector3& displacement);
+
+		/// <summary>
+		/// 指定したAABBと重なる葉を列挙
+		/// </summary>
+		/// <param name="aabb">検索に使用するAABB。</param>
+		/// <param name="outProxies">重なったプロキシIDの出力先。呼び出し側でクリアしてください。</param>
+		void Query(const AABB& aabb, std::vector<int32_t>& outProxies) const;
+
+		/// <summary>
+		/// 線分（半径を持たせた場合はその分太らせた線分）と重なる葉を列挙
+		/// </summary>
+		/// <param name="origin">始点。</param>
+		/// <param name="direction">正規化された方向。</param>
+		/// <param name="maxDistance">最大距離。</param>
+		/// <param name="radius">各ノードのAABBを広げる量（スフィアキャスト用）。</param>
+		/// <param name="outProxies">重なったプロキシIDの出力先。呼び出し側でクリアしてください。</param>
+		void RayQuery(const Vector3& origin, const Vector3& direction, float maxDistance, float radius, std::vector<int32_t>& outProxies) const;
+
+		/// <summary>
+		/// 木を空にする
+		/// </summary>
+		void Clear();
+
+	public: /// ===Getter=== ///
+		// ユーザーデータ
+		void* GetUserData(int32_t proxyId) const;
+		// 太らせたAABB
+		const AABB& GetFatAABB(int32_t proxyId) const;
+		// 木の高さ
+		int32_t GetHeight() const;
+		// 登録されているプロキシ数
+		int32_t GetProxyCount() const;
+		// ノード配列の容量（プロキシIDの上限）
+		int32_t GetNodeCapacity() const;
+
+	private: /// ===定数=== ///
+		// AABBを太らせる量
+		static constexpr float kFatMargin = 0.2f;
+		// 移動量の先読み倍率
+		static constexpr float kDisplacementMultiplier = 2.0f;
+
+	private: /// ===変数=== ///
+
+		/// ===ノード=== ///
+		struct TreeNode {
+			AABB aabb{};                // 太らせたAABB（内部ノードは子の和）
+			void* userData = nullptr;   // ユーザーデータ（葉のみ）
+			int32_t parent = kNullNode; // 親ノード（フリーリスト中は次の空きノード）
+			int32_t child1 = kNullNode; // 子ノード1
+			int32_t child2 = kNullNode; // 子ノード2
+			int32_t height = -1;        // 葉が0、空きノードは-1
+
+			// 葉かどうか
+			bool IsLeaf() const { return child1 == kNullNode; }
+		};
+		std::vector<TreeNode> nodes_;
+		// ルートノード
+		int32_t root_ = kNullNode;
+		// 空きノードの先頭
+		int32_t freeList_ = kNullNode;
+		// プロキシ数
+		int32_t proxyCount_ = 0;
+
+	private: /// ===関数=== ///
+
+		/// <summary>
+		/// ノードの確保処理
+		/// </summary>
+		int32_t AllocateNode();
+
+		/// <summary>
+		/// ノードの解放処理
+		/// </summary>
+		void FreeNode(int32_t nodeId);
+
+		/// <summary>
+		/// 葉を表面積が最小になる位置へ挿入
+		/// </summary>
+		void InsertLeaf(int32_t leaf);
+
+		/// <summary>
+		/// 葉を木から取り外す
+		/// </summary>
+		void RemoveLeaf(int32_t leaf);
+
+		/// <summary>
+		/// 指定ノードを回転させて高さを揃える
+		/// </summary>
+		/// <returns>回転後にそのノードの位置に来たノード。</returns>
+		int32_t Balance(int32_t iA);
+
+		/// <summary>
+		/// 指定ノードから親をさかのぼってAABBと高さを更新
+		/// </summary>
+		void RefitAncestors(int32_t nodeId);
+	};
+
+	///-------------------------------------------///
+	/// AABBのヘルパー
+	///-------------------------------------------///
+	namespace AABBUtil {
+		// 2つのAABBを内包するAABB
+		AABB Union(const AABB& a, const AABB& b);
+		// aがbを完全に内包しているか
+		bool Contains(const AABB& a, const AABB& b);
+		// 2つのAABBが重なっているか
+		bool Overlaps(const AABB& a, const AABB& b);
+		// 表面積（挿入コストの評価に使用）
+		float SurfaceArea(const AABB& a);
+		// 各成分の逆数（0 の成分は十分大きな値にする）
+		Vector3 InverseDirection(const Vector3& direction);
+		// 半径分広げたAABBと線分 [0, maxDistance] が重なっているか（スラブ法）
+		bool RayOverlaps(const AABB& a, const Vector3& origin, const Vector3& invDirection, float maxDistance, float radius);
+		// 姿勢 axis・半径 halfSize の箱のワールド軸方向の半径
+		Vector3 OBBExtent(const Vector3 axis[3], const Vector3& halfSize);
+		// OBBを内包するAABB
+		AABB FromOBB(const OBB& obb);
+	}
+}
@@ -0,0 +1,177 @@
+#include "StaticBVH.h"
+// AABBUtil
+#include "Engine/Collider/BroadPhase/DynamicAABBTree.h"
+// c++
+#include <algorithm>
+#include <cassert>
+
+namespace MiiEngine {
+	///-------------------------------------------///
+	/// Getter
+	///-------------------------------------------///
+	void* StaticBVH::GetUserData(int32_t index) const { return userData_[index]; }
+	const AABB& StaticBVH::GetBounds(int32_t index) const { return bounds_[index]; }
+	int32_t StaticBVH::GetCount() const { return static_cast<int32_t>(bounds_.size()); }
+
+	///-------------------------------------------///
+	/// 構築
+	///-------------------------------------------///
+	void StaticBVH::Build(const std::vector<AABB>& bounds, const std::vector<void*>& userData) {
+		assert(bounds.size() == userData.size());
+		Clear();
+		if (bounds.empty()) {
+			return;
+		}
+
+		bounds_ = bounds;
+		userData_ = userData;
+		order_.resize(bounds_.size());
+		for (size_t i = 0; i < order_.size(); ++i) {
+			order_[i] = static_cast<int32_t>(i);
+		}
+
+		// 要素数Nに対してノードは最大2N-1
+		nodes_.reserve(bounds_.size() * 2);
+		Node root;
+		root.first = 0;
+		root.count = static_cast<int32_t>(bounds_.size());
+		nodes_.push_back(root);
+		Subdivide(0);
+	}
+
+	///-------------------------------------------///
+	/// 分割
+	///-------------------------------------------///
+	void StaticBVH::Subdivide(int32_t nodeIndex) {
+		/// ===ノードの境界と重心の範囲を計算=== ///
+		const int32_t first = nodes_[nodeIndex].first;
+		const int32_t count = nodes_[nodeIndex].count;
+
+		AABB nodeBounds = bounds_[order_[first]];
+		Vector3 centroidMin = (nodeBounds.min + nodeBounds.max) * 0.5f;
+		Vector3 centroidMax = centroidMin;
+		for (int32_t i = first; i < first + count; ++i) {
+			const AABB& b = bounds_[order_[i]];
+			nodeBounds = AABBUtil::Union(nodeBounds, b);
+			Vector3 c = (b.min + b.max) * 0.5f;
+			centroidMin = { (std::min)(centroidMin.x, c.x), (std::min)(centroidMin.y, c.y), (std::min)(centroidMin.z, c.z) };
+			centroidMax = { (std::max)(centroidMax.x, c.x), (std::max)(centroidMax.y, c.y), (std::max)(centroidMax.z, c.z) };
+		}
+		nodes_[nodeIndex].aabb = nodeBounds;
+
+		// 葉にする
+		if (count <= kMaxLeafSize) {
+			return;
+		}
+
+		/// ===重心の広がりが最も大きい軸の中央値で分割=== ///
+		Vector3 extent = centroidMax - centroidMin;
+		int axis = 0;
+		if (extent.y > extent.x) { axis = 1; }
+		if (extent.z > (axis == 0 ? extent.x : extent.y)) { axis = 2; }
+
+		auto centroidOnAxis = [&](int32_t index) {
+			const AABB& b = bounds_[index];
+			if (axis == 0) { return b.min.x + b.max.x; }
+			if (axis == 1) { return b.min.y + b.max.y; }
+			return b.min.z + b.max.z;
+		};
+
+		const int32_t mid = first + count / 2;
+		std::nth_element(order_.begin() + first, order_.begin() + mid, order_.begin() + first + count,
+			[&](int32_t a, int32_t b) { return centroidOnAxis(a) < centroidOnAxis(b); });
+
+		/// ===子ノードを作成=== ///
+		int32_t left = static_cast<int32_t>(nodes_.size());
+		Node leftNode;
+		leftNode.first = first;
+		leftNode.count = mid - first;
+		Node rightNode;
+		rightNode.first = mid;
+		rightNode.count = first + count - mid;
+		nodes_.push_back(leftNode);
+		nodes_.push_back(rightNode);
+
+		nodes_[nodeIndex].left = left;
+		nodes_[nodeIndex].count = 0;
+
+		Subdivide(left);
+		Subdivide(left + 1);
+	}
+
+	///-------------------------------------------///
+	/// AABBによる検索
+	///-------------------------------------------///
+	void StaticBVH::Query(const AABB& aabb, std::vector<int32_t>& outIndices) const {
+		if (nodes_.empty()) {
+			return;
+		}
+
+		int32_t stack[64];
+		int32_t count = 0;
+		stack[count++] = 0;
+
+		while (count > 0) {
+			const Node& node = nodes_[stack[--count]];
+			if (!AABBUtil::Overlaps(node.aabb, aabb)) {
+				continue;
+			}
+
+			if (node.left < 0) {
+				// 葉の要素を個別に判定
+				for (int32_t i = node.first; i < node.first + node.count; ++i) {
+					if (AABBUtil::Overlaps(bounds_[order_[i]], aabb)) {
+						outIndices.push_back(order_[i]);
+					}
+				}
+			} else {
+				assert(count + 2 <= 64);
+				stack[count++] = node.left;
+				stack[count++] = node.left + 1;
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// 線分による検索
+	///-------------------------------------------///
+	void StaticBVH::RayQuery(const Vector3& origin, const Vector3& direction, float maxDistance, float radius, std::vector<int32_t>& outIndices) const {
+		if (nodes_.empty()) {
+			return;
+		}
+		const Vector3 invDirection = AABBUtil::InverseDirection(direction);
+
+		int32_t stack[64];
+		int32_t count = 0;
+		stack[count++] = 0;
+
+		while (count > 0) {
+			const Node& node = nodes_[stack[--count]];
+			if (!AABBUtil::RayOverlaps(node.aabb, origin, invDirection, maxDistance, radius)) {
+				continue;
+			}
+
+			if (node.left < 0) {
+				for (int32_t i = node.first; i < node.first + node.count; ++i) {
+					if (AABBUtil::RayOverlaps(bounds_[order_[i]], origin, invDirection, maxDistance, radius)) {
+						outIndices.push_back(order_[i]);
+					}
+				}
+			} else {
+				assert(count + 2 <= 64);
+				stack[count++] = node.left;
+				stack[count++] = node.left + 1;
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// クリア
+	///-------------------------------------------///
+	void StaticBVH::Clear() {
+		nodes_.clear();
+		order_.clear();
+		bounds_.clear();
+		userData_.clear();
+	}
+}
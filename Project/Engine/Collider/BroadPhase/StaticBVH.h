@@ -0,0 +1,85 @@
+#pragma once
+/// ===Include=== ///
+// Data
+#include "Engine/DataInfo/ColliderData.h"
+// c++
+#include <cstdint>
+#include <vector>
+
+namespace MiiEngine {
+	///=====================================================///
+	/// StaticBVH
+	/// 動かないレベルジオメトリ用のBVH。一度だけ構築し、以降は検索のみ行う
+	///=====================================================///
+	class StaticBVH {
+	public:
+
+		StaticBVH() = default;
+		~StaticBVH() = default;
+
+		/// <summary>
+		/// 構築処理
+		/// </summary>
+		/// <param name="bounds">各要素の境界AABB。</param>
+		/// <param name="userData">各要素に紐づけるユーザーデータ。bounds と同じ要素数であること。</param>
+		void Build(const std::vector<AABB>& bounds, const std::vector<void*>& userData);
+
+		/// <summary>
+		/// 指定したAABBと重なる要素を列挙
+		/// </summary>
+		/// <param name="aabb">検索に使用するAABB。</param>
+		/// <param name="outIndices">重なった要素番号（Build時の順番）の出力先。呼び出し側でクリアしてください。</param>
+		void Query(const AABB& aabb, std::vector<int32_t>& outIndices) const;
+
+		/// <summary>
+		/// 線分（半径を持たせた場合はその分太らせた線分）と重なる要素を列挙
+		/// </summary>
+		/// <param name="origin">始点。</param>
+		/// <param name="direction">正規化された方向。</param>
+		/// <param name="maxDistance">最大距離。</param>
+		/// <param name="radius">各ノードのAABBを広げる量（スフィアキャスト用）。</param>
+		/// <param name="outIndices">重なった要素番号の出力先。呼び出し側でクリアしてください。</param>
+		void RayQuery(const Vector3& origin, const Vector3& direction, float maxDistance, float radius, std::vector<int32_t>& outIndices) const;
+
+		/// <summary>
+		/// 空にする
+		/// </summary>
+		void Clear();
+
+	public: /// ===Getter=== ///
+		// ユーザーデータ
+		void* GetUserData(int32_t index) const;
+		// 要素の境界AABB
+		const AABB& GetBounds(int32_t index) const;
+		// 要素数
+		int32_t GetCount() const;
+
+	private: /// ===定数=== ///
+		// 葉に入れる要素数の上限
+		static constexpr int32_t kMaxLeafSize = 2;
+
+	private: /// ===変数=== ///
+
+		/// ===ノード=== ///
+		struct Node {
+			AABB aabb{};           // ノードの境界
+			int32_t left = -1;     // 左の子（右の子は left + 1）。葉では -1
+			int32_t first = 0;     // 葉の先頭要素（order_ 上の位置）
+			int32_t count = 0;     // 葉の要素数
+		};
+		std::vector<Node> nodes_;
+		// 要素の並び（ノードが参照する要素番号）
+		std::vector<int32_t> order_;
+		// 要素情報
+		std::vector<AABB> bounds_;
+		std::vector<void*> userData_;
+
+	private: /// ===関数=== ///
+
+		/// <summary>
+		/// 再帰的にノードを分割
+		/// </summary>
+		/// <param name="nodeIndex">分割するノード。</param>
+		void Subdivide(int32_t nodeIndex);
+	};
+}
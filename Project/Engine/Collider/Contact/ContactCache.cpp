@@ -0,0 +1,137 @@
+#include "ContactCache.h"
+// Collider
+#include "Engine/Collider/Base/Collider.h"
+// c++
+#include <algorithm>
+
+namespace MiiEngine {
+	///-------------------------------------------///
+	/// Getter
+	///-------------------------------------------///
+	const std::vector<ContactCache::Contact>& ContactCache::GetContacts() const { return current_; }
+
+	///-------------------------------------------///
+	/// フレームの開始
+	///-------------------------------------------///
+	void ContactCache::BeginFrame() {
+		// 今フレームの結果を前フレームへ
+		previous_.swap(current_);
+		current_.clear();
+
+		// 無効化されたペアを取り除く
+		std::erase_if(previous_, [](const Contact& contact) { return !contact.a || !contact.b; });
+
+		// 検索用のテーブルを作り直す
+		previousLookup_.clear();
+		previousLookup_.reserve(previous_.size());
+		for (const Contact& contact : previous_) {
+			previousLookup_.emplace(MakeKey(contact.a, contact.b), false);
+		}
+	}
+
+	///-------------------------------------------///
+	/// 衝突ペアの記録
+	///-------------------------------------------///
+	void ContactCache::AddContact(Collider* a, Collider* b) {
+		current_.push_back({ a, b });
+	}
+	void ContactCache::AddContact(const Contact& contact) {
+		current_.push_back(contact);
+	}
+
+	///-------------------------------------------///
+	/// 通知
+	///-------------------------------------------///
+	void ContactCache::Dispatch() {
+		// 掃引で当たったペアを移動中に当たった順に通知する（通常の判定のペアは時刻 1 なので判定順のまま後ろに並ぶ）
+		std::stable_sort(current_.begin(), current_.end(), [](const Contact& lhs, const Contact& rhs) { return lhs.timeOfImpact < rhs.timeOfImpact; });
+
+		/// ===Enter / Stay（当たった時刻順）=== ///
+		// コールバック内で RemoveCollider が呼ばれても良いように毎回要素を読み直す
+		for (size_t i = 0; i < current_.size(); ++i) {
+			Collider* a = current_[i].a;
+			Collider* b = current_[i].b;
+			if (!a || !b) {
+				continue;
+			}
+
+			auto it = previousLookup_.find(MakeKey(a, b));
+			const bool isStay = (it != previousLookup_.end());
+			if (isStay) {
+				it->second = true;
+				a->OnCollisionStay(b);
+			} else {
+				a->OnCollisionEnter(b);
+			}
+
+			// a の処理中に無効化された場合は b へ通知しない
+			if (!current_[i].a || !current_[i].b) {
+				continue;
+			}
+			if (isStay) {
+				b->OnCollisionStay(a);
+			} else {
+				b->OnCollisionEnter(a);
+			}
+		}
+
+		/// ===Exit（前フレームの判定順）=== ///
+		for (size_t i = 0; i < previous_.size(); ++i) {
+			Collider* a = previous_[i].a;
+			Collider* b = previous_[i].b;
+			if (!a || !b) {
+				continue;
+			}
+
+			auto it = previousLookup_.find(MakeKey(a, b));
+			if (it == previousLookup_.end() || it->second) {
+				// 今フレームも衝突している
+				continue;
+			}
+
+			a->OnCollisionExit(b);
+			if (!previous_[i].a || !previous_[i].b) {
+				continue;
+			}
+			b->OnCollisionExit(a);
+		}
+	}
+
+	///-------------------------------------------///
+	/// コライダーの削除
+	///-------------------------------------------///
+	void ContactCache::RemoveCollider(Collider* collider) {
+		// 通知中でも添字がずれないよう、削除ではなく無効化する
+		for (Contact& contact : current_) {
+			if (contact.a == collider || contact.b == collider) {
+				contact = Contact{};
+			}
+		}
+		for (Contact& contact : previous_) {
+			if (contact.a == collider || contact.b == collider) {
+				// 同じアドレスに再生成されたコライダーを Stay と誤認しないようキーも消す
+				previousLookup_.erase(MakeKey(contact.a, contact.b));
+				contact = Contact{};
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// クリア
+	///-------------------------------------------///
+	void ContactCache::Clear() {
+		current_.clear();
+		previous_.clear();
+		previousLookup_.clear();
+	}
+
+	///-------------------------------------------///
+	/// キーの生成
+	///-------------------------------------------///
+	ContactCache::PairKey ContactCache::MakeKey(Collider* a, Collider* b) {
+		if (std::less<Collider*>()(b, a)) {
+			std::swap(a, b);
+		}
+		return { a, b };
+	}
+}
@@ -0,0 +1,104 @@
+#pragma once
+/// ===Include=== ///
+// Math
+#include "Math/Vector3.h"
+// c++
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace MiiEngine {
+	/// ===前方宣言=== ///
+	class Collider;
+
+	///=====================================================///
+	/// ContactCache
+	/// フレームをまたいで衝突ペアを保持し、Enter/Stay/Exit を判別する
+	///=====================================================///
+	class ContactCache {
+	public:
+
+		ContactCache() = default;
+		~ContactCache() = default;
+
+		/// ===衝突ペア=== ///
+		struct Contact {
+			Collider* a = nullptr;             // 判定時の1番目
+			Collider* b = nullptr;             // 判定時の2番目
+			float timeOfImpact = 1.0f;         // 当たった時刻 [0, 1]（通常の判定で当たった場合は 1）
+			Collider* sweptCollider = nullptr; // 掃引して当たった側（通常の判定で当たった場合は nullptr）
+			Vector3 impactPosition{};          // 当たった時刻での sweptCollider の中心
+		};
+
+		/// <summary>
+		/// フレームの開始処理。前フレームの衝突ペアを保存し、今フレームの記録を空にします。
+		/// </summary>
+		void BeginFrame();
+
+		/// <summary>
+		/// 衝突したペアを記録（判定順に呼び出す）
+		/// </summary>
+		/// <param name="a">判定時の1番目のコライダー。</param>
+		/// <param name="b">判定時の2番目のコライダー。</param>
+		void AddContact(Collider* a, Collider* b);
+
+		/// <summary>
+		/// 衝突したペアを記録（連続判定の結果を含む）
+		/// </summary>
+		/// <param name="contact">記録するペア。</param>
+		void AddContact(const Contact& contact);
+
+		/// <summary>
+		/// 記録したペアをまとめて通知します。
+		/// 今フレームのペアを当たった時刻順（同じ時刻は判定順）に並べて Enter/Stay を、続いて前フレームの順に Exit を呼び出します。
+		/// </summary>
+		void Dispatch();
+
+		/// <summary>
+		/// 指定したコライダーを含むペアを無効化（通知中に呼ばれても安全）
+		/// </summary>
+		/// <param name="collider">削除されるコライダー。</param>
+		void RemoveCollider(Collider* collider);
+
+		/// <summary>
+		/// 全てのペアを破棄
+		/// </summary>
+		void Clear();
+
+	public: /// ===Getter=== ///
+		// 今フレームの衝突ペア
+		const std::vector<Contact>& GetContacts() const;
+
+	private: /// ===変数=== ///
+
+		/// ===ペアのキー（ポインタの大小で正規化）=== ///
+		struct PairKey {
+			Collider* first = nullptr;
+			Collider* second = nullptr;
+			bool operator==(const PairKey& other) const { return first == other.first && second == other.second; }
+		};
+		struct PairKeyHash {
+			size_t operator()(const PairKey& key) const {
+				size_t h1 = std::hash<Collider*>()(key.first);
+				size_t h2 = std::hash<Collider*>()(key.second);
+				return h1 ^ (h2 + 0x9e3779b97f4a7c15ull + (h1 << 6) + (h1 >> 2));
+			}
+		};
+
+		// 今フレームの衝突ペア（判定順）
+		std::vector<Contact> current_;
+		// 前フレームの衝突ペア（判定順）
+		std::vector<Contact> previous_;
+		// 前フレームのペア検索用（値は今フレームで見つかったか）
+		std::unordered_map<PairKey, bool, PairKeyHash> previousLookup_;
+
+	private: /// ===関数=== ///
+
+		/// <summary>
+		/// ペアからキーを生成
+		/// </summary>
+		static PairKey MakeKey(Collider* a, Collider* b);
+	};
+}
@@ -0,0 +1,191 @@
+#include "SweepTest.h"
+// Collider
+#include "Engine/Collider/SphereCollider.h"
+#include "Engine/Collider/AABBCollider.h"
+#include "Engine/Collider/OBBCollider.h"
+// Query
+#include "Engine/Collider/Query/SceneQuery.h"
+// Math
+#include "Math/sMath.h"
+// c++
+#include <algorithm>
+#include <cmath>
+
+namespace MiiEngine::SweepTest {
+	namespace {
+		// 1区間で許容する回転量（ラジアン）
+		constexpr float kMaxStepAngle = 0.1f;
+		// 区間の分割数の上限
+		constexpr int kMaxSteps = 16;
+		// 0 とみなす長さ
+		constexpr float kEpsilon = 1e-6f;
+
+		// 線形補間
+		Vector3 LerpVector(const Vector3& a, const Vector3& b, float t) {
+			return a + (b - a) * t;
+		}
+
+		// 2つのOBBの間の姿勢（軸を補間してから直交化）
+		OBB InterpolateOBB(const OBB& start, const OBB& end, float t) {
+			OBB result = start;
+			result.center = LerpVector(start.center, end.center, t);
+
+			Vector3 x = LerpVector(start.axis[0], end.axis[0], t);
+			Vector3 y = LerpVector(start.axis[1], end.axis[1], t);
+			// ほぼ反転している場合は近い方の姿勢を使う
+			if (Length(x) < kEpsilon || Length(y) < kEpsilon) {
+				return (t < 0.5f) ? start : end;
+			}
+			x = Normalize(x);
+			y = Normalize(y - x * Dot(x, y));
+			result.axis[0] = x;
+			result.axis[1] = y;
+			result.axis[2] = Math::Cross(x, y);
+			return result;
+		}
+
+		// 平行移動するOBBとコライダー
+		bool TranslateOBB(const OBB& moving, const Vector3& displacement, Collider* target, float& outTime) {
+			switch (target->GetColliderType()) {
+			case ColliderType::Sphere: {
+				// 相手の球を逆向きに動かしてOBBへのスフィアキャストとして解く
+				const Sphere sphere = static_cast<SphereCollider*>(target)->GetSphere();
+				const float distance = Length(displacement);
+				if (distance < kEpsilon) {
+					if (!SceneQueryMath::OverlapOBB(moving, target)) {
+						return false;
+					}
+					outTime = 0.0f;
+					return true;
+				}
+				float hitDistance = 0.0f;
+				Vector3 normal{};
+				if (!SceneQueryMath::SphereCastOBB(sphere.center, sphere.radius, -displacement / distance, distance, moving, hitDistance, normal)) {
+					return false;
+				}
+				outTime = hitDistance / distance;
+				return true;
+			}
+			case ColliderType::AABB:
+				return TranslateOBBOBB(moving, displacement, SceneQueryMath::ToOBB(static_cast<AABBCollider*>(target)->GetAABB()), outTime);
+			case ColliderType::OBB:
+				return TranslateOBBOBB(moving, displacement, static_cast<OBBCollider*>(target)->GetOBB(), outTime);
+			default:
+				return false;
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// 移動する球
+	///-------------------------------------------///
+	bool SweptSphere(const Sphere& start, const Vector3& endCenter, Collider* target, float& outTime) {
+		const Vector3 displacement = endCenter - start.center;
+		const float distance = Length(displacement);
+		if (distance < kEpsilon) {
+			if (!SceneQueryMath::OverlapSphere(start, target)) {
+				return false;
+			}
+			outTime = 0.0f;
+			return true;
+		}
+
+		float hitDistance = 0.0f;
+		Vector3 normal{};
+		if (!SceneQueryMath::SphereCast(start.center, start.radius, displacement / distance, distance, target, hitDistance, normal)) {
+			return false;
+		}
+		outTime = hitDistance / distance;
+		return true;
+	}
+
+	///-------------------------------------------///
+	/// 移動・回転するOBB
+	///-------------------------------------------///
+	bool SweptOBB(const OBB& start, const OBB& end, Collider* target, float& outTime) {
+		/// ===回転量から分割数を決める=== ///
+		float maxAngle = 0.0f;
+		for (int i = 0; i < 3; ++i) {
+			const float cosAngle = std::clamp(Dot(start.axis[i], end.axis[i]), -1.0f, 1.0f);
+			maxAngle = (std::max)(maxAngle, std::acos(cosAngle));
+		}
+		const int steps = std::clamp(static_cast<int>(std::ceil(maxAngle / kMaxStepAngle)), 1, kMaxSteps);
+
+		/// ===区間ごとに中間の姿勢で平行移動として判定=== ///
+		for (int step = 0; step < steps; ++step) {
+			const float t0 = static_cast<float>(step) / steps;
+			const float t1 = static_cast<float>(step + 1) / steps;
+
+			OBB box = InterpolateOBB(start, end, (t0 + t1) * 0.5f);
+			box.center = LerpVector(start.center, end.center, t0);
+			const Vector3 displacement = LerpVector(start.center, end.center, t1) - box.center;
+
+			float localTime = 0.0f;
+			if (TranslateOBB(box, displacement, target, localTime)) {
+				outTime = t0 + localTime * (t1 - t0);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	///-------------------------------------------///
+	/// 平行移動するOBB同士（分離軸ごとに重なる時間区間を求めて交差させる）
+	///-------------------------------------------///
+	bool TranslateOBBOBB(const OBB& moving, const Vector3& displacement, const OBB& target, float& outTime) {
+		/// ===分離軸の候補（面法線6本 + 辺の組み合わせ9本）=== ///
+		Vector3 axes[15];
+		int axisCount = 0;
+		for (int i = 0; i < 3; ++i) {
+			axes[axisCount++] = moving.axis[i];
+			axes[axisCount++] = target.axis[i];
+		}
+		for (int i = 0; i < 3; ++i) {
+			for (int j = 0; j < 3; ++j) {
+				const Vector3 axis = Math::Cross(moving.axis[i], target.axis[j]);
+				// 平行な辺の組み合わせは面法線で代用できる
+				if (Dot(axis, axis) > kEpsilon) {
+					axes[axisCount++] = axis;
+				}
+			}
+		}
+
+		const Vector3 offset = target.center - moving.center;
+		const float movingHalf[3] = { moving.halfSize.x, moving.halfSize.y, moving.halfSize.z };
+		const float targetHalf[3] = { target.halfSize.x, target.halfSize.y, target.halfSize.z };
+		float enter = 0.0f;
+		float exit = 1.0f;
+		for (int k = 0; k < axisCount; ++k) {
+			const Vector3& axis = axes[k];
+			// 投影半径の和（軸は正規化しないので距離と同じ倍率になる）
+			float radius = 0.0f;
+			for (int i = 0; i < 3; ++i) {
+				radius += movingHalf[i] * std::abs(Dot(moving.axis[i], axis));
+				radius += targetHalf[i] * std::abs(Dot(target.axis[i], axis));
+			}
+			const float distance = Dot(offset, axis);
+			const float speed = Dot(displacement, axis);
+
+			// 時刻 t の距離は distance - speed * t。|distance - speed * t| <= radius となる区間
+			if (std::abs(speed) < kEpsilon) {
+				if (std::abs(distance) > radius) {
+					return false;
+				}
+				continue;
+			}
+			float t0 = (distance - radius) / speed;
+			float t1 = (distance + radius) / speed;
+			if (t0 > t1) {
+				std::swap(t0, t1);
+			}
+			enter = (std::max)(enter, t0);
+			exit = (std::min)(exit, t1);
+			if (enter > exit) {
+				return false;
+			}
+		}
+
+		outTime = enter;
+		return true;
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+/// ===Include=== ///
+// Data
+#include "Engine/DataInfo/ColliderData.h"
+
+namespace MiiEngine {
+	/// ===前方宣言=== ///
+	class Collider;
+
+	///=====================================================///
+	/// SweepTest
+	/// 前フレームから今フレームまでの移動を掃引し、最初に接触する時刻（0～1）を求める。
+	/// 相手は今フレームの位置で止まっているものとして扱う
+	///=====================================================///
+	namespace SweepTest {
+
+		/// <summary>
+		/// 移動する球とコライダーの掃引判定
+		/// </summary>
+		/// <param name="start">移動開始時の球。</param>
+		/// <param name="endCenter">移動終了時の中心。</param>
+		/// <param name="target">判定する相手のコライダー。</param>
+		/// <param name="outTime">最初に接触する時刻（0～1）の出力先。</param>
+		/// <returns>移動中に接触する場合は true。</returns>
+		bool SweptSphere(const Sphere& start, const Vector3& endCenter, Collider* target, float& outTime);
+
+		/// <summary>
+		/// 移動・回転するOBBとコライダーの掃引判定。回転量に応じて区間を分割し、
+		/// 各区間では向きを固定した平行移動として厳密に判定します。
+		/// </summary>
+		/// <param name="start">移動開始時のOBB。</param>
+		/// <param name="end">移動終了時のOBB（halfSize は start と同じであること）。</param>
+		/// <param name="target">判定する相手のコライダー。</param>
+		/// <param name="outTime">最初に接触する時刻（0～1）の出力先。</param>
+		/// <returns>移動中に接触する場合は true。</returns>
+		bool SweptOBB(const OBB& start, const OBB& end, Collider* target, float& outTime);
+
+		/// <summary>
+		/// 平行移動するOBBと止まっているOBBの分離軸による掃引判定
+		/// </summary>
+		/// <param name="moving">移動開始時のOBB。</param>
+		/// <param name="displacement">移動量。</param>
+		/// <param name="target">止まっているOBB。</param>
+		/// <param name="outTime">最初に接触する時刻（0～1）の出力先。</param>
+		/// <returns>移動中に接触する場合は true。</returns>
+		bool TranslateOBBOBB(const OBB& moving, const Vector3& displacement, const OBB& target, float& outTime);
+	}
+}
@@ -0,0 +1,280 @@
+#include "CollisionLayerMatrix.h"
+// c++
+#include <fstream>
+#include <cassert>
+#include <utility>
+// JSON
+#include <json.hpp>
+// ImGui
+#ifdef USE_IMGUI
+#include <imgui.h>
+#endif // USE_IMGUI
+
+namespace MiiEngine {
+	///-------------------------------------------///
+	/// コンストラクタ
+	///-------------------------------------------///
+	CollisionLayerMatrix::CollisionLayerMatrix() {
+		// 読み込み前は従来通り全ペアを判定する
+		SetAll(true);
+		ResetAllStats();
+	}
+
+	///-------------------------------------------///
+	/// Getter
+	///-------------------------------------------///
+	// ペアの統計
+	const CollisionLayerMatrix::PairStats& CollisionLayerMatrix::GetStats(ColliderName a, ColliderName b) const {
+		int ia = static_cast<int>(a);
+		int ib = static_cast<int>(b);
+		if (ia > ib) { std::swap(ia, ib); }
+		return stats_[ia][ib];
+	}
+	// レイヤー名
+	const char* CollisionLayerMatrix::GetLayerName(ColliderName name) {
+		switch (name) {
+		case ColliderName::Player:       return "Player";
+		case ColliderName::Enemy:        return "Enemy";
+		case ColliderName::PlayerBullet: return "PlayerBullet";
+		case ColliderName::PlayerWeapon: return "PlayerWeapon";
+		case ColliderName::EnemyBullet:  return "EnemyBullet";
+		case ColliderName::Object:       return "Object";
+		case ColliderName::Ground:       return "Ground";
+		case ColliderName::Ceiling:      return "Ceiling";
+		case ColliderName::None:         return "None";
+		}
+		return "Unknown";
+	}
+
+	///-------------------------------------------///
+	/// JSONの読み込み
+	///-------------------------------------------///
+	void CollisionLayerMatrix::LoadFromJson(const std::string& jsonPath) {
+		try {
+			// ファイルを開く
+			std::ifstream file(jsonPath);
+			// ファイルが開けなかった場合のエラーチェック
+			if (!file.is_open()) {
+				assert(false && "Failed to open collision layer file");
+				return;
+			}
+
+			// JSONをパース
+			nlohmann::json j;
+			file >> j;
+			file.close();
+
+			if (!j.contains("Matrix") || !j["Matrix"].is_object()) {
+				assert(false && "Collision layer file has no Matrix");
+				return;
+			}
+
+			// 記載されたペアのみ有効にする
+			SetAll(false);
+			for (auto& [key, targets] : j["Matrix"].items()) {
+				ColliderName a;
+				if (!FromString(key, a)) {
+					assert(false && "Unknown collider name in collision layer file");
+					continue;
+				}
+				for (const auto& target : targets) {
+					ColliderName b;
+					if (!FromString(target.get<std::string>(), b)) {
+						assert(false && "Unknown collider name in collision layer file");
+						continue;
+					}
+					SetPair(a, b, true);
+				}
+			}
+
+		} catch (const std::exception& e) {
+			// 読み込みに失敗した場合は全ペア判定に戻す
+			SetAll(true);
+			assert(false && "Failed to parse collision layer JSON");
+			e;
+		}
+	}
+
+	///-------------------------------------------///
+	/// 判定可否の設定
+	///-------------------------------------------///
+	void CollisionLayerMatrix::SetAll(bool enable) {
+		for (int i = 0; i < kLayerCount; ++i) {
+			for (int j = 0; j < kLayerCount; ++j) {
+				matrix_[i][j] = enable;
+			}
+		}
+	}
+	void CollisionLayerMatrix::SetPair(ColliderName a, ColliderName b, bool enable) {
+		matrix_[static_cast<int>(a)][static_cast<int>(b)] = enable;
+		matrix_[static_cast<int>(b)][static_cast<int>(a)] = enable;
+	}
+
+	///-------------------------------------------///
+	/// 判定を行うかどうか
+	///-------------------------------------------///
+	bool CollisionLayerMatrix::ShouldCollide(ColliderName a, ColliderName b) const {
+		return matrix_[static_cast<int>(a)][static_cast<int>(b)];
+	}
+
+	///-------------------------------------------///
+	/// 統計の記録
+	///-------------------------------------------///
+	void CollisionLayerMatrix::RecordCulled(ColliderName a, ColliderName b) {
+		StatsRef(a, b).culled++;
+	}
+	void CollisionLayerMatrix::RecordTest(ColliderName a, ColliderName b, bool isHit) {
+		PairStats& stats = StatsRef(a, b);
+		stats.tests++;
+		stats.totalTests++;
+		if (isHit) {
+			stats.hits++;
+			stats.totalHits++;
+		}
+	}
+
+	///-------------------------------------------///
+	/// スレッドごとのカウンタ
+	///-------------------------------------------///
+	void CollisionLayerMatrix::FrameCounters::Reset() {
+		*this = FrameCounters{};
+	}
+	void CollisionLayerMatrix::FrameCounters::RecordCulled(ColliderName a, ColliderName b) {
+		int ia = static_cast<int>(a);
+		int ib = static_cast<int>(b);
+		if (ia > ib) { std::swap(ia, ib); }
+		culled[ia][ib]++;
+	}
+	void CollisionLayerMatrix::FrameCounters::RecordTest(ColliderName a, ColliderName b, bool isHit) {
+		int ia = static_cast<int>(a);
+		int ib = static_cast<int>(b);
+		if (ia > ib) { std::swap(ia, ib); }
+		tests[ia][ib]++;
+		if (isHit) {
+			hits[ia][ib]++;
+		}
+	}
+	void CollisionLayerMatrix::Accumulate(const FrameCounters& counters) {
+		for (int i = 0; i < kLayerCount; ++i) {
+			for (int j = i; j < kLayerCount; ++j) {
+				PairStats& stats = stats_[i][j];
+				stats.culled += counters.culled[i][j];
+				stats.tests += counters.tests[i][j];
+				stats.hits += counters.hits[i][j];
+				stats.totalTests += counters.tests[i][j];
+				stats.totalHits += counters.hits[i][j];
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// 統計のリセット
+	///-------------------------------------------///
+	void CollisionLayerMatrix::ResetFrameStats() {
+		for (int i = 0; i < kLayerCount; ++i) {
+			for (int j = i; j < kLayerCount; ++j) {
+				stats_[i][j].culled = 0;
+				stats_[i][j].tests = 0;
+				stats_[i][j].hits = 0;
+			}
+		}
+	}
+	void CollisionLayerMatrix::ResetAllStats() {
+		for (int i = 0; i < kLayerCount; ++i) {
+			for (int j = 0; j < kLayerCount; ++j) {
+				stats_[i][j] = PairStats{};
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// ImGui情報の更新
+	///-------------------------------------------///
+	void CollisionLayerMatrix::Information() {
+	#ifdef USE_IMGUI
+		/// ===マトリクスの編集=== ///
+		if (ImGui::TreeNode("LayerMatrix")) {
+			for (int i = 0; i < kLayerCount; ++i) {
+				ColliderName a = static_cast<ColliderName>(i);
+				if (!ImGui::TreeNode(GetLayerName(a))) {
+					continue;
+				}
+				for (int j = 0; j < kLayerCount; ++j) {
+					ColliderName b = static_cast<ColliderName>(j);
+					bool enable = matrix_[i][j];
+					ImGui::PushID(j);
+					if (ImGui::Checkbox(GetLayerName(b), &enable)) {
+						SetPair(a, b, enable);
+					}
+					ImGui::PopID();
+				}
+				ImGui::TreePop();
+			}
+			ImGui::TreePop();
+		}
+
+		/// ===ペアごとの統計=== ///
+		if (ImGui::TreeNode("PairStats")) {
+			if (ImGui::Button("Reset")) {
+				ResetAllStats();
+			}
+			if (ImGui::BeginTable("CollisionPairStats", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+				ImGui::TableSetupColumn("Pair");
+				ImGui::TableSetupColumn("Culled");
+				ImGui::TableSetupColumn("Tests");
+				ImGui::TableSetupColumn("Hits");
+				ImGui::TableSetupColumn("TotalTests");
+				ImGui::TableSetupColumn("TotalHits");
+				ImGui::TableHeadersRow();
+				for (int i = 0; i < kLayerCount; ++i) {
+					for (int j = i; j < kLayerCount; ++j) {
+						const PairStats& stats = stats_[i][j];
+						// 一度も出てこないペアは表示しない
+						if (stats.culled == 0 && stats.totalTests == 0) {
+							continue;
+						}
+						ImGui::TableNextRow();
+						ImGui::TableNextColumn();
+						ImGui::Text("%s - %s", GetLayerName(static_cast<ColliderName>(i)), GetLayerName(static_cast<ColliderName>(j)));
+						ImGui::TableNextColumn();
+						ImGui::Text("%u", stats.culled);
+						ImGui::TableNextColumn();
+						ImGui::Text("%u", stats.tests);
+						ImGui::TableNextColumn();
+						ImGui::Text("%u", stats.hits);
+						ImGui::TableNextColumn();
+						ImGui::Text("%llu", static_cast<unsigned long long>(stats.totalTests));
+						ImGui::TableNextColumn();
+						ImGui::Text("%llu", static_cast<unsigned long long>(stats.totalHits));
+					}
+				}
+				ImGui::EndTable();
+			}
+			ImGui::TreePop();
+		}
+	#endif // USE_IMGUI
+	}
+
+	///-------------------------------------------///
+	/// 文字列からレイヤーを取得
+	///-------------------------------------------///
+	bool CollisionLayerMatrix::FromString(const std::string& str, ColliderName& outName) {
+		for (int i = 0; i < kLayerCount; ++i) {
+			if (str == GetLayerName(static_cast<ColliderName>(i))) {
+				outName = static_cast<ColliderName>(i);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	///-------------------------------------------///
+	/// ペアの統計への参照を取得
+	///-------------------------------------------///
+	CollisionLayerMatrix::PairStats& CollisionLayerMatrix::StatsRef(ColliderName a, ColliderName b) {
+		int ia = static_cast<int>(a);
+		int ib = static_cast<int>(b);
+		if (ia > ib) { std::swap(ia, ib); }
+		return stats_[ia][ib];
+	}
+}
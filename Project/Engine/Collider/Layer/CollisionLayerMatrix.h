@@ -0,0 +1,136 @@
+#pragma once
+/// ===Include=== ///
+// Data
+#include "Engine/DataInfo/ColliderData.h"
+// c++
+#include <cstdint>
+#include <string>
+
+namespace MiiEngine {
+	///=====================================================///
+	/// CollisionLayerMatrix
+	/// ColliderName 同士の判定可否と、レイヤーペアごとの判定回数を管理する
+	///=====================================================///
+	class CollisionLayerMatrix {
+	public:
+
+		CollisionLayerMatrix();
+		~CollisionLayerMatrix() = default;
+
+		// レイヤー数（None を含む）
+		static constexpr int kLayerCount = static_cast<int>(ColliderName::None) + 1;
+
+		/// ===レイヤーペアごとの統計=== ///
+		struct PairStats {
+			uint32_t culled = 0;      // 今フレームでマトリクスにより除外された回数
+			uint32_t tests = 0;       // 今フレームの形状判定回数
+			uint32_t hits = 0;        // 今フレームの衝突回数
+			uint64_t totalTests = 0;  // 累計の形状判定回数
+			uint64_t totalHits = 0;   // 累計の衝突回数
+		};
+
+		/// ===スレッドごとに集計するフレーム単位のカウンタ（Accumulate で合算）=== ///
+		struct FrameCounters {
+			uint32_t culled[kLayerCount][kLayerCount] = {};
+			uint32_t tests[kLayerCount][kLayerCount] = {};
+			uint32_t hits[kLayerCount][kLayerCount] = {};
+
+			// 全て0にする
+			void Reset();
+			// マトリクスで除外されたことを記録
+			void RecordCulled(ColliderName a, ColliderName b);
+			// 形状判定の結果を記録
+			void RecordTest(ColliderName a, ColliderName b, bool isHit);
+		};
+
+		/// <summary>
+		/// JSONからマトリクスを読み込みます。記載されたペアのみ判定を行い、それ以外は除外します。
+		/// </summary>
+		/// <param name="jsonPath">読み込むJSONファイルのパス。</param>
+		void LoadFromJson(const std::string& jsonPath);
+
+		/// <summary>
+		/// 全てのペアの判定可否を一括で設定
+		/// </summary>
+		/// <param name="enable">判定を行う場合は true。</param>
+		void SetAll(bool enable);
+
+		/// <summary>
+		/// 指定したペアの判定可否を設定（対称に設定されます）
+		/// </summary>
+		/// <param name="a">レイヤーA。</param>
+		/// <param name="b">レイヤーB。</param>
+		/// <param name="enable">判定を行う場合は true。</param>
+		void SetPair(ColliderName a, ColliderName b, bool enable);
+
+		/// <summary>
+		/// 指定したペアの判定を行うかどうか
+		/// </summary>
+		/// <param name="a">レイヤーA。</param>
+		/// <param name="b">レイヤーB。</param>
+		/// <returns>判定を行う場合は true。</returns>
+		bool ShouldCollide(ColliderName a, ColliderName b) const;
+
+		/// <summary>
+		/// マトリクスで除外されたことを記録
+		/// </summary>
+		void RecordCulled(ColliderName a, ColliderName b);
+
+		/// <summary>
+		/// 形状判定の結果を記録
+		/// </summary>
+		/// <param name="a">レイヤーA。</param>
+		/// <param name="b">レイヤーB。</param>
+		/// <param name="isHit">衝突していた場合は true。</param>
+		void RecordTest(ColliderName a, ColliderName b, bool isHit);
+
+		/// <summary>
+		/// スレッドごとに集計したカウンタを統計に合算
+		/// </summary>
+		/// <param name="counters">合算するカウンタ。</param>
+		void Accumulate(const FrameCounters& counters);
+
+		/// <summary>
+		/// フレーム単位の統計をリセット（判定の開始時に呼び出す）
+		/// </summary>
+		void ResetFrameStats();
+
+		/// <summary>
+		/// 累計を含めた全ての統計をリセット
+		/// </summary>
+		void ResetAllStats();
+
+		/// <summary>
+		/// ImGui情報の更新
+		/// </summary>
+		void Information();
+
+	public: /// ===Getter=== ///
+		// ペアの統計
+		const PairStats& GetStats(ColliderName a, ColliderName b) const;
+		// レイヤー名
+		static const char* GetLayerName(ColliderName name);
+
+	private: /// ===変数=== ///
+
+		// 判定可否（対称）
+		bool matrix_[kLayerCount][kLayerCount];
+		// 統計（[小さい方][大きい方] のみ使用）
+		PairStats stats_[kLayerCount][kLayerCount];
+
+	private: /// ===関数=== ///
+
+		/// <summary>
+		/// 文字列からレイヤーを取得
+		/// </summary>
+		/// <param name="str">レイヤー名。</param>
+		/// <param name="outName">変換結果の出力先。</param>
+		/// <returns>変換できた場合は true。</returns>
+		static bool FromString(const std::string& str, ColliderName& outName);
+
+		/// <summary>
+		/// ペアの統計への参照を取得
+		/// </summary>
+		PairStats& StatsRef(ColliderName a, ColliderName b);
+	};
+}
@@ -0,0 +1,106 @@
+#include "ColliderSnapshot.h"
+// Collider
+#include "Engine/Collider/SphereCollider.h"
+#include "Engine/Collider/AABBCollider.h"
+#include "Engine/Collider/OBBCollider.h"
+// BroadPhase
+#include "Engine/Collider/BroadPhase/DynamicAABBTree.h"
+
+namespace MiiEngine {
+	///-------------------------------------------///
+	/// Getter
+	///-------------------------------------------///
+	const ColliderSnapshot::Slot& ColliderSnapshot::GetSlot(int32_t slot) const { return slots_[slot]; }
+	int32_t ColliderSnapshot::GetSlotCount() const { return static_cast<int32_t>(slots_.size()); }
+	const AABB& ColliderSnapshot::GetBounds(int32_t slot) const { return bounds_[slot]; }
+	const ColliderSnapshot::SphereArray& ColliderSnapshot::GetSpheres() const { return spheres_; }
+	const ColliderSnapshot::AABBArray& ColliderSnapshot::GetAABBs() const { return aabbs_; }
+	const ColliderSnapshot::OBBArray& ColliderSnapshot::GetOBBs() const { return obbs_; }
+
+	///-------------------------------------------///
+	/// クリア
+	///-------------------------------------------///
+	void ColliderSnapshot::Clear() {
+		slots_.clear();
+		bounds_.clear();
+		for (int k = 0; k < 3; ++k) {
+			spheres_.center[k].clear();
+			aabbs_.min[k].clear();
+			aabbs_.max[k].clear();
+			obbs_.center[k].clear();
+			obbs_.halfSize[k].clear();
+			for (int c = 0; c < 3; ++c) {
+				obbs_.axis[k][c].clear();
+			}
+		}
+		spheres_.radius.clear();
+		sphereCount_ = 0;
+		aabbCount_ = 0;
+		obbCount_ = 0;
+	}
+
+	///-------------------------------------------///
+	/// 追加
+	///-------------------------------------------///
+	int32_t ColliderSnapshot::Add(Collider* collider) {
+		const ColliderName name = collider->GetColliderName();
+		switch (collider->GetColliderType()) {
+		case ColliderType::Sphere:
+			return AddSphere(static_cast<SphereCollider*>(collider)->GetSphere(), collider, name);
+		case ColliderType::AABB:
+			return AddAABB(static_cast<AABBCollider*>(collider)->GetAABB(), collider, name);
+		case ColliderType::OBB:
+			return AddOBB(static_cast<OBBCollider*>(collider)->GetOBB(), collider, name);
+		default: {
+			const Vector3 translate = collider->GetTransform().translate;
+			return PushSlot({ collider, collider->GetColliderType(), name, -1 }, { translate, translate });
+		}
+		}
+	}
+	int32_t ColliderSnapshot::AddSphere(const Sphere& shape, Collider* collider, ColliderName name) {
+		spheres_.center[0].push_back(shape.center.x);
+		spheres_.center[1].push_back(shape.center.y);
+		spheres_.center[2].push_back(shape.center.z);
+		spheres_.radius.push_back(shape.radius);
+		return PushSlot({ collider, ColliderType::Sphere, name, sphereCount_++ }, { shape.center - shape.radius, shape.center + shape.radius });
+	}
+	int32_t ColliderSnapshot::AddAABB(const AABB& shape, Collider* collider, ColliderName name) {
+		aabbs_.min[0].push_back(shape.min.x);
+		aabbs_.min[1].push_back(shape.min.y);
+		aabbs_.min[2].push_back(shape.min.z);
+		aabbs_.max[0].push_back(shape.max.x);
+		aabbs_.max[1].push_back(shape.max.y);
+		aabbs_.max[2].push_back(shape.max.z);
+		return PushSlot({ collider, ColliderType::AABB, name, aabbCount_++ }, shape);
+	}
+	int32_t ColliderSnapshot::AddOBB(const OBB& shape, Collider* collider, ColliderName name) {
+		obbs_.center[0].push_back(shape.center.x);
+		obbs_.center[1].push_back(shape.center.y);
+		obbs_.center[2].push_back(shape.center.z);
+		for (int i = 0; i < 3; ++i) {
+			obbs_.axis[i][0].push_back(shape.axis[i].x);
+			obbs_.axis[i][1].push_back(shape.axis[i].y);
+			obbs_.axis[i][2].push_back(shape.axis[i].z);
+		}
+		obbs_.halfSize[0].push_back(shape.halfSize.x);
+		obbs_.halfSize[1].push_back(shape.halfSize.y);
+		obbs_.halfSize[2].push_back(shape.halfSize.z);
+		return PushSlot({ collider, ColliderType::OBB, name, obbCount_++ }, AABBUtil::FromOBB(shape));
+	}
+
+	///-------------------------------------------///
+	/// スロットの登録
+	///-------------------------------------------///
+	int32_t ColliderSnapshot::PushSlot(const Slot& slot, const AABB& bounds) {
+		slots_.push_back(slot);
+		bounds_.push_back(bounds);
+		return static_cast<int32_t>(slots_.size()) - 1;
+	}
+
+	///-------------------------------------------///
+	/// 境界の拡張
+	///-------------------------------------------///
+	void ColliderSnapshot::ExpandBounds(int32_t slot, const AABB& aabb) {
+		bounds_[slot] = AABBUtil::Union(bounds_[slot], aabb);
+	}
+}
@@ -0,0 +1,106 @@
+#pragma once
+/// ===Include=== ///
+// Data
+#include "Engine/DataInfo/ColliderData.h"
+// c++
+#include <cstdint>
+#include <vector>
+
+namespace MiiEngine {
+	/// ===前方宣言=== ///
+	class Collider;
+
+	///=====================================================///
+	/// ColliderSnapshot
+	/// 1フレーム分のコライダー形状を形状ごとのSoA配列に書き出したもの。
+	/// 判定中は GetSphere() 等を呼ばずにこの配列だけを参照する
+	///=====================================================///
+	class ColliderSnapshot {
+	public:
+
+		ColliderSnapshot() = default;
+		~ColliderSnapshot() = default;
+
+		/// ===スロット（登録順の番号）=== ///
+		struct Slot {
+			Collider* collider = nullptr;
+			ColliderType type = ColliderType::Count;
+			ColliderName name = ColliderName::None;
+			int32_t shapeIndex = -1; // 形状ごとの配列内の番号
+		};
+
+		/// ===形状ごとのSoA配列=== ///
+		struct SphereArray {
+			std::vector<float> center[3];
+			std::vector<float> radius;
+		};
+		struct AABBArray {
+			std::vector<float> min[3];
+			std::vector<float> max[3];
+		};
+		struct OBBArray {
+			std::vector<float> center[3];
+			std::vector<float> axis[3][3]; // [軸][成分]
+			std::vector<float> halfSize[3];
+		};
+
+		/// <summary>
+		/// 空にする（容量は保持）
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// コライダーの形状を書き出す
+		/// </summary>
+		/// <param name="collider">書き出すコライダー。</param>
+		/// <returns>割り当てたスロット番号。</returns>
+		int32_t Add(Collider* collider);
+
+		/// <summary>
+		/// 形状を直接書き出す（コライダーを持たない計測用にも使用）
+		/// </summary>
+		/// <param name="shape">書き出す形状。</param>
+		/// <param name="collider">スロットに紐づけるコライダー（無い場合は nullptr）。</param>
+		/// <param name="name">スロットに紐づけるコライダー名。</param>
+		/// <returns>割り当てたスロット番号。</returns>
+		int32_t AddSphere(const Sphere& shape, Collider* collider = nullptr, ColliderName name = ColliderName::None);
+		int32_t AddAABB(const AABB& shape, Collider* collider = nullptr, ColliderName name = ColliderName::None);
+		int32_t AddOBB(const OBB& shape, Collider* collider = nullptr, ColliderName name = ColliderName::None);
+
+		/// <summary>
+		/// スロットの境界AABBを広げる（連続判定で移動前の形状を含めるために使用）
+		/// </summary>
+		/// <param name="slot">広げるスロット。</param>
+		/// <param name="aabb">含めるAABB。</param>
+		void ExpandBounds(int32_t slot, const AABB& aabb);
+
+	public: /// ===Getter=== ///
+		// スロット
+		const Slot& GetSlot(int32_t slot) const;
+		int32_t GetSlotCount() const;
+		// スロットの境界AABB
+		const AABB& GetBounds(int32_t slot) const;
+		// 形状ごとの配列
+		const SphereArray& GetSpheres() const;
+		const AABBArray& GetAABBs() const;
+		const OBBArray& GetOBBs() const;
+
+	private: /// ===関数=== ///
+
+		/// <summary>
+		/// スロットと境界AABBを登録
+		/// </summary>
+		int32_t PushSlot(const Slot& slot, const AABB& bounds);
+
+	private: /// ===変数=== ///
+
+		std::vector<Slot> slots_;
+		std::vector<AABB> bounds_;
+		SphereArray spheres_;
+		AABBArray aabbs_;
+		OBBArray obbs_;
+		int32_t sphereCount_ = 0;
+		int32_t aabbCount_ = 0;
+		int32_t obbCount_ = 0;
+	};
+}
@@ -0,0 +1,275 @@
+#include "NarrowPhaseBatch.h"
+// Math
+#include "Engine/Collider/NarrowPhase/NarrowPhaseMath.h"
+
+namespace MiiEngine {
+	namespace {
+		///-------------------------------------------///
+		/// 候補グループの成分の並び
+		///-------------------------------------------///
+		// 球   : [0..2] 中心, [3] 半径
+		constexpr int kSphereRadius = 3;
+		// AABB : [0..2] 最小, [3..5] 最大
+		constexpr int kAABBMax = 3;
+		// OBB  : [0..2] 中心, [3..11] 軸（軸ごとに3成分）, [12..14] 半径
+		constexpr int kBoxAxis = 3;
+		constexpr int kBoxHalf = 12;
+
+		///-------------------------------------------///
+		/// グループにコライダー1つ分の成分を追加
+		///-------------------------------------------///
+		void PushLane(std::vector<float>* data, const float* values, int componentCount) {
+			for (int c = 0; c < componentCount; ++c) {
+				data[c].push_back(values[c]);
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// コンストラクタ
+	///-------------------------------------------///
+	NarrowPhaseBatch::NarrowPhaseBatch() {
+		isAVX2Supported_ = Simd::DetectAVX2();
+		useAVX2_ = isAVX2Supported_;
+	}
+
+	///-------------------------------------------///
+	/// Getter / Setter
+	///-------------------------------------------///
+	bool NarrowPhaseBatch::IsAVX2Supported() const { return isAVX2Supported_; }
+	void NarrowPhaseBatch::SetUseAVX2(bool flag) { useAVX2_ = flag && isAVX2Supported_; }
+	bool NarrowPhaseBatch::GetUseAVX2() const { return useAVX2_; }
+
+	///-------------------------------------------///
+	/// 1対多の判定
+	///-------------------------------------------///
+	void NarrowPhaseBatch::Test(const ColliderSnapshot& snapshot, int32_t slotA, const std::vector<int32_t>& slotsB, std::vector<uint8_t>& outHits) {
+		outHits.assign(slotsB.size(), 0);
+		if (slotsB.empty()) {
+			return;
+		}
+
+		ShapeA a = LoadShapeA(snapshot, slotA);
+		Gather(snapshot, a.type, slotsB);
+
+		if (useAVX2_) {
+			Run<Simd::Float8>(a, outHits);
+			// 以降のSSE命令で遷移ペナルティが出ないよう上位を消去
+			_mm256_zeroupper();
+		} else {
+			Run<Simd::Float4>(a, outHits);
+		}
+	}
+
+	///-------------------------------------------///
+	/// 判定する側の形状を展開
+	///-------------------------------------------///
+	NarrowPhaseBatch::ShapeA NarrowPhaseBatch::LoadShapeA(const ColliderSnapshot& snapshot, int32_t slotA) {
+		const ColliderSnapshot::Slot& slot = snapshot.GetSlot(slotA);
+		const int32_t index = slot.shapeIndex;
+
+		ShapeA a;
+		a.type = slot.type;
+		switch (slot.type) {
+		case ColliderType::Sphere: {
+			const ColliderSnapshot::SphereArray& spheres = snapshot.GetSpheres();
+			for (int k = 0; k < 3; ++k) {
+				a.center[k] = spheres.center[k][index];
+			}
+			a.radius = spheres.radius[index];
+			break;
+		}
+		case ColliderType::AABB: {
+			const ColliderSnapshot::AABBArray& aabbs = snapshot.GetAABBs();
+			for (int k = 0; k < 3; ++k) {
+				a.min[k] = aabbs.min[k][index];
+				a.max[k] = aabbs.max[k][index];
+				// OBBとの判定用に単位軸のOBBとしても展開
+				a.boxCenter[k] = (a.min[k] + a.max[k]) * 0.5f;
+				a.boxHalf[k] = (a.max[k] - a.min[k]) * 0.5f;
+				a.boxAxis[k][k] = 1.0f;
+			}
+			break;
+		}
+		case ColliderType::OBB: {
+			const ColliderSnapshot::OBBArray& obbs = snapshot.GetOBBs();
+			for (int k = 0; k < 3; ++k) {
+				a.boxCenter[k] = obbs.center[k][index];
+				a.boxHalf[k] = obbs.halfSize[k][index];
+				for (int c = 0; c < 3; ++c) {
+					a.boxAxis[k][c] = obbs.axis[k][c][index];
+				}
+			}
+			break;
+		}
+		default:
+			break;
+		}
+		return a;
+	}
+
+	///-------------------------------------------///
+	/// 候補を形状ごとのグループに集める
+	///-------------------------------------------///
+	void NarrowPhaseBatch::Gather(const ColliderSnapshot& snapshot, ColliderType typeA, const std::vector<int32_t>& slotsB) {
+		LaneGroup* groups[] = { &sphereGroup_, &aabbGroup_, &boxGroup_ };
+		for (LaneGroup* group : groups) {
+			for (std::vector<float>& data : group->data) {
+				data.clear();
+			}
+			group->positions.clear();
+			group->count = 0;
+		}
+
+		const ColliderSnapshot::SphereArray& spheres = snapshot.GetSpheres();
+		const ColliderSnapshot::AABBArray& aabbs = snapshot.GetAABBs();
+		const ColliderSnapshot::OBBArray& obbs = snapshot.GetOBBs();
+
+		for (size_t position = 0; position < slotsB.size(); ++position) {
+			const ColliderSnapshot::Slot& slot = snapshot.GetSlot(slotsB[position]);
+			const int32_t index = slot.shapeIndex;
+			float values[kMaxComponents] = {};
+
+			switch (slot.type) {
+			case ColliderType::Sphere:
+				for (int k = 0; k < 3; ++k) {
+					values[k] = spheres.center[k][index];
+				}
+				values[kSphereRadius] = spheres.radius[index];
+				PushLane(sphereGroup_.data, values, 4);
+				sphereGroup_.positions.push_back(static_cast<int32_t>(position));
+				break;
+
+			case ColliderType::AABB:
+				if (typeA != ColliderType::OBB) {
+					for (int k = 0; k < 3; ++k) {
+						values[k] = aabbs.min[k][index];
+						values[kAABBMax + k] = aabbs.max[k][index];
+					}
+					PushLane(aabbGroup_.data, values, 6);
+					aabbGroup_.positions.push_back(static_cast<int32_t>(position));
+				} else {
+					// OBBとの判定では単位軸のOBBとして扱う
+					for (int k = 0; k < 3; ++k) {
+						values[k] = (aabbs.min[k][index] + aabbs.max[k][index]) * 0.5f;
+						values[kBoxHalf + k] = (aabbs.max[k][index] - aabbs.min[k][index]) * 0.5f;
+						values[kBoxAxis + k * 3 + k] = 1.0f;
+					}
+					PushLane(boxGroup_.data, values, kMaxComponents);
+					boxGroup_.positions.push_back(static_cast<int32_t>(position));
+				}
+				break;
+
+			case ColliderType::OBB:
+				for (int k = 0; k < 3; ++k) {
+					values[k] = obbs.center[k][index];
+					values[kBoxHalf + k] = obbs.halfSize[k][index];
+					for (int c = 0; c < 3; ++c) {
+						values[kBoxAxis + k * 3 + c] = obbs.axis[k][c][index];
+					}
+				}
+				PushLane(boxGroup_.data, values, kMaxComponents);
+				boxGroup_.positions.push_back(static_cast<int32_t>(position));
+				break;
+
+			default:
+				break;
+			}
+		}
+
+		/// ===最大レーン数の倍数までパディング（結果は捨てる）=== ///
+		const int componentCounts[] = { 4, 6, kMaxComponents };
+		for (int g = 0; g < 3; ++g) {
+			LaneGroup* group = groups[g];
+			group->count = static_cast<int32_t>(group->positions.size());
+			const size_t padded = (static_cast<size_t>(group->count) + kMaxLanes - 1) / kMaxLanes * kMaxLanes;
+			for (int c = 0; c < componentCounts[g]; ++c) {
+				group->data[c].resize(padded, 0.0f);
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// 判定結果の書き戻し
+	///-------------------------------------------///
+	void NarrowPhaseBatch::Scatter(const LaneGroup& group, std::vector<uint8_t>& outHits) const {
+		for (int32_t i = 0; i < group.count; ++i) {
+			outHits[group.positions[i]] = laneHits_[i];
+		}
+	}
+
+	///-------------------------------------------///
+	/// 各グループの判定
+	///-------------------------------------------///
+	template<class V>
+	void NarrowPhaseBatch::Run(const ShapeA& a, std::vector<uint8_t>& outHits) {
+		namespace NPM = NarrowPhaseMath;
+
+		/// ===判定する側をブロードキャスト=== ///
+		V aCenter[3], aMin[3], aMax[3], aBoxCenter[3], aBoxAxis[3][3], aBoxHalf[3];
+		for (int k = 0; k < 3; ++k) {
+			aCenter[k] = V::Set1(a.center[k]);
+			aMin[k] = V::Set1(a.min[k]);
+			aMax[k] = V::Set1(a.max[k]);
+			aBoxCenter[k] = V::Set1(a.boxCenter[k]);
+			aBoxHalf[k] = V::Set1(a.boxHalf[k]);
+			for (int c = 0; c < 3; ++c) {
+				aBoxAxis[k][c] = V::Set1(a.boxAxis[k][c]);
+			}
+		}
+		const V aRadius = V::Set1(a.radius);
+
+		// 1グループ分を判定して書き戻す
+		auto runGroup = [&](const LaneGroup& group, auto&& kernel) {
+			if (group.count == 0) {
+				return;
+			}
+			laneHits_.resize(group.data[0].size());
+			for (int32_t i = 0; i < group.count; i += V::kWidth) {
+				const uint32_t bits = V::MoveMask(kernel(group, i));
+				for (int lane = 0; lane < V::kWidth; ++lane) {
+					laneHits_[i + lane] = static_cast<uint8_t>((bits >> lane) & 1u);
+				}
+			}
+			Scatter(group, outHits);
+		};
+
+		/// ===候補: 球=== ///
+		runGroup(sphereGroup_, [&](const LaneGroup& g, int32_t i) {
+			V bCenter[3] = { V::Load(&g.data[0][i]), V::Load(&g.data[1][i]), V::Load(&g.data[2][i]) };
+			V bRadius = V::Load(&g.data[kSphereRadius][i]);
+			if (a.type == ColliderType::Sphere) {
+				return NPM::SphereSphere(aCenter, aRadius, bCenter, bRadius);
+			} else if (a.type == ColliderType::AABB) {
+				return NPM::SphereAABB(bCenter, bRadius, aMin, aMax);
+			}
+			return NPM::SphereBox(bCenter, bRadius, aBoxCenter, aBoxAxis, aBoxHalf);
+		});
+
+		/// ===候補: AABB（判定する側が球かAABBの場合のみ）=== ///
+		runGroup(aabbGroup_, [&](const LaneGroup& g, int32_t i) {
+			V bMin[3] = { V::Load(&g.data[0][i]), V::Load(&g.data[1][i]), V::Load(&g.data[2][i]) };
+			V bMax[3] = { V::Load(&g.data[kAABBMax][i]), V::Load(&g.data[kAABBMax + 1][i]), V::Load(&g.data[kAABBMax + 2][i]) };
+			if (a.type == ColliderType::Sphere) {
+				return NPM::SphereAABB(aCenter, aRadius, bMin, bMax);
+			}
+			return NPM::AABBAABB(aMin, aMax, bMin, bMax);
+		});
+
+		/// ===候補: OBB=== ///
+		runGroup(boxGroup_, [&](const LaneGroup& g, int32_t i) {
+			V bCenter[3], bAxis[3][3], bHalf[3];
+			for (int k = 0; k < 3; ++k) {
+				bCenter[k] = V::Load(&g.data[k][i]);
+				bHalf[k] = V::Load(&g.data[kBoxHalf + k][i]);
+				for (int c = 0; c < 3; ++c) {
+					bAxis[k][c] = V::Load(&g.data[kBoxAxis + k * 3 + c][i]);
+				}
+			}
+			if (a.type == ColliderType::Sphere) {
+				return NPM::SphereBox(aCenter, aRadius, bCenter, bAxis, bHalf);
+			}
+			return NPM::BoxBox(aBoxCenter, aBoxAxis, aBoxHalf, bCenter, bAxis, bHalf);
+		});
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+/// ===Include=== ///
+// Snapshot
+#include "Engine/Collider/NarrowPhase/ColliderSnapshot.h"
+// c++
+#include <cstdint>
+#include <vector>
+
+namespace MiiEngine {
+	///=====================================================///
+	/// NarrowPhaseBatch
+	/// 1つの形状と複数の候補をまとめて判定する。候補を形状ごとに連続配列へ集め、
+	/// SSE(4レーン) または AVX2(8レーン) で一度に判定する
+	///=====================================================///
+	class NarrowPhaseBatch {
+	public:
+
+		NarrowPhaseBatch();
+		~NarrowPhaseBatch() = default;
+
+		/// <summary>
+		/// 1対多の判定処理
+		/// </summary>
+		/// <param name="snapshot">今フレームのスナップショット。</param>
+		/// <param name="slotA">判定する側のスロット番号。</param>
+		/// <param name="slotsB">候補のスロット番号。</param>
+		/// <param name="outHits">候補と同じ並びで判定結果（1:衝突 / 0:非衝突）を書き込む出力先。</param>
+		void Test(const ColliderSnapshot& snapshot, int32_t slotA, const std::vector<int32_t>& slotsB, std::vector<uint8_t>& outHits);
+
+	public: /// ===Getter / Setter=== ///
+		// CPUがAVX2に対応しているか
+		bool IsAVX2Supported() const;
+		// AVX2を使用するか（非対応の場合は常にSSE）
+		void SetUseAVX2(bool flag);
+		bool GetUseAVX2() const;
+
+	private: /// ===定数=== ///
+		// 最大レーン数（候補配列はこの倍数に揃える）
+		static constexpr int32_t kMaxLanes = 8;
+		// 1候補あたりの最大要素数（OBB: 中心3 + 軸9 + 半径3）
+		static constexpr int kMaxComponents = 15;
+
+	private: /// ===型=== ///
+
+		/// ===候補を形状ごとに集めた連続配列=== ///
+		struct LaneGroup {
+			std::vector<float> data[kMaxComponents]; // 成分ごとの配列
+			std::vector<int32_t> positions;          // slotsB 上の位置
+			int32_t count = 0;                       // 候補数（パディングを除く）
+		};
+
+		/// ===判定する側の形状（各形状の表現に展開済み）=== ///
+		struct ShapeA {
+			ColliderType type = ColliderType::Count;
+			float center[3] = {};      // 球の中心
+			float radius = 0.0f;       // 球の半径
+			float min[3] = {};         // AABB
+			float max[3] = {};
+			float boxCenter[3] = {};   // OBB（AABBは単位軸のOBBとして扱う）
+			float boxAxis[3][3] = {};
+			float boxHalf[3] = {};
+		};
+
+	private: /// ===変数=== ///
+
+		// 候補の球
+		LaneGroup sphereGroup_;
+		// 候補のAABB（相手がOBBの場合は boxGroup_ に入れる）
+		LaneGroup aabbGroup_;
+		// 候補のOBB
+		LaneGroup boxGroup_;
+		// グループ単位の判定結果
+		std::vector<uint8_t> laneHits_;
+
+		// AVX2
+		bool isAVX2Supported_ = false;
+		bool useAVX2_ = false;
+
+	private: /// ===関数=== ///
+
+		/// <summary>
+		/// 判定する側の形状を展開
+		/// </summary>
+		static ShapeA LoadShapeA(const ColliderSnapshot& snapshot, int32_t slotA);
+
+		/// <summary>
+		/// 候補を形状ごとのグループに集める
+		/// </summary>
+		void Gather(const ColliderSnapshot& snapshot, ColliderType typeA, const std::vector<int32_t>& slotsB);
+
+		/// <summary>
+		/// グループの判定結果を出力先へ書き戻す
+		/// </summary>
+		void Scatter(const LaneGroup& group, std::vector<uint8_t>& outHits) const;
+
+		/// <summary>
+		/// 各グループの判定（V はレーン幅）
+		/// </summary>
+		template<class V>
+		void Run(const ShapeA& a, std::vector<uint8_t>& outHits);
+	};
+}
@@ -0,0 +1,136 @@
+#pragma once
+/// ===Include=== ///
+// SIMD
+#include "Math/SimdFloat.h"
+
+///=====================================================///
+/// NarrowPhaseMath
+/// 形状同士の判定式。V に Simd::Float1 / Float4 / Float8 を渡すことで
+/// スカラー判定とバッチ判定で同じ式を共有する
+///=====================================================///
+namespace MiiEngine::NarrowPhaseMath {
+
+	// 平行に近い軸同士の外積がほぼ0になり誤って分離判定されるのを防ぐ値
+	inline constexpr float kSATEpsilon = 1e-6f;
+
+	///-------------------------------------------///
+	/// 球と球
+	///-------------------------------------------///
+	template<class V>
+	typename V::Mask SphereSphere(const V c1[3], V r1, const V c2[3], V r2) {
+		V dx = c1[0] - c2[0];
+		V dy = c1[1] - c2[1];
+		V dz = c1[2] - c2[2];
+		V distSq = dx * dx + dy * dy + dz * dz;
+		V radiusSum = r1 + r2;
+		return CmpLE(distSq, radiusSum * radiusSum);
+	}
+
+	///-------------------------------------------///
+	/// 球とAABB
+	///-------------------------------------------///
+	template<class V>
+	typename V::Mask SphereAABB(const V c[3], V r, const V mn[3], const V mx[3]) {
+		V distSq = V::Set1(0.0f);
+		for (int k = 0; k < 3; ++k) {
+			// 最近点（clamp）との差
+			V d = c[k] - Min(Max(c[k], mn[k]), mx[k]);
+			distSq = distSq + d * d;
+		}
+		return CmpLE(distSq, r * r);
+	}
+
+	///-------------------------------------------///
+	/// AABBとAABB
+	///-------------------------------------------///
+	template<class V>
+	typename V::Mask AABBAABB(const V mn1[3], const V mx1[3], const V mn2[3], const V mx2[3]) {
+		typename V::Mask result = V::And(CmpLE(mn1[0], mx2[0]), CmpLE(mn2[0], mx1[0]));
+		for (int k = 1; k < 3; ++k) {
+			result = V::And(result, V::And(CmpLE(mn1[k], mx2[k]), CmpLE(mn2[k], mx1[k])));
+		}
+		return result;
+	}
+
+	///-------------------------------------------///
+	/// 球とOBB
+	///-------------------------------------------///
+	template<class V>
+	typename V::Mask SphereBox(const V c[3], V r, const V bc[3], const V axis[3][3], const V h[3]) {
+		V dir[3] = { c[0] - bc[0], c[1] - bc[1], c[2] - bc[2] };
+		V closest[3] = { bc[0], bc[1], bc[2] };
+
+		// OBB空間における最近点を計算
+		for (int i = 0; i < 3; ++i) {
+			V dist = dir[0] * axis[i][0] + dir[1] * axis[i][1] + dir[2] * axis[i][2];
+			dist = Min(Max(dist, V::Set1(0.0f) - h[i]), h[i]);
+			for (int k = 0; k < 3; ++k) {
+				closest[k] = closest[k] + axis[i][k] * dist;
+			}
+		}
+
+		V distSq = V::Set1(0.0f);
+		for (int k = 0; k < 3; ++k) {
+			V d = c[k] - closest[k];
+			distSq = distSq + d * d;
+		}
+		return CmpLE(distSq, r * r);
+	}
+
+	///-------------------------------------------///
+	/// OBBとOBB（15軸SAT）
+	/// 軸は正規化・直交済みである前提のため、交差軸の正規化を行わない
+	///-------------------------------------------///
+	template<class V>
+	typename V::Mask BoxBox(const V ac[3], const V aAxis[3][3], const V ah[3], const V bc[3], const V bAxis[3][3], const V bh[3]) {
+		const V eps = V::Set1(kSATEpsilon);
+
+		/// ===Bの軸をAの座標系で表した回転行列=== ///
+		V R[3][3];
+		V absR[3][3];
+		for (int i = 0; i < 3; ++i) {
+			for (int j = 0; j < 3; ++j) {
+				R[i][j] = aAxis[i][0] * bAxis[j][0] + aAxis[i][1] * bAxis[j][1] + aAxis[i][2] * bAxis[j][2];
+				absR[i][j] = Abs(R[i][j]) + eps;
+			}
+		}
+
+		/// ===中心間のベクトル（Aの座標系）=== ///
+		V tw[3] = { bc[0] - ac[0], bc[1] - ac[1], bc[2] - ac[2] };
+		V t[3];
+		for (int i = 0; i < 3; ++i) {
+			t[i] = tw[0] * aAxis[i][0] + tw[1] * aAxis[i][1] + tw[2] * aAxis[i][2];
+		}
+
+		/// ===Aの3軸=== ///
+		typename V::Mask separated = CmpGT(Abs(t[0]), ah[0] + bh[0] * absR[0][0] + bh[1] * absR[0][1] + bh[2] * absR[0][2]);
+		for (int i = 1; i < 3; ++i) {
+			V rb = bh[0] * absR[i][0] + bh[1] * absR[i][1] + bh[2] * absR[i][2];
+			separated = V::Or(separated, CmpGT(Abs(t[i]), ah[i] + rb));
+		}
+
+		/// ===Bの3軸=== ///
+		for (int j = 0; j < 3; ++j) {
+			V ra = ah[0] * absR[0][j] + ah[1] * absR[1][j] + ah[2] * absR[2][j];
+			V dist = t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j];
+			separated = V::Or(separated, CmpGT(Abs(dist), ra + bh[j]));
+		}
+
+		/// ===交差軸 A[i] x B[j]=== ///
+		for (int i = 0; i < 3; ++i) {
+			const int i0 = (i + 1) % 3;
+			const int i1 = (i + 2) % 3;
+			for (int j = 0; j < 3; ++j) {
+				const int j0 = (j + 1) % 3;
+				const int j1 = (j + 2) % 3;
+				V ra = ah[i0] * absR[i1][j] + ah[i1] * absR[i0][j];
+				V rb = bh[j0] * absR[i][j1] + bh[j1] * absR[i][j0];
+				V dist = t[i1] * R[i0][j] - t[i0] * R[i1][j];
+				separated = V::Or(separated, CmpGT(Abs(dist), ra + rb));
+			}
+		}
+
+		// 全軸で重なりあり → 衝突
+		return V::Not(separated);
+	}
+}
@@ -0,0 +1,359 @@
+#include "SceneQuery.h"
+// Collider
+#include "Engine/Collider/SphereCollider.h"
+#include "Engine/Collider/AABBCollider.h"
+#include "Engine/Collider/OBBCollider.h"
+// NarrowPhase
+#include "Engine/Collider/NarrowPhase/NarrowPhaseMath.h"
+// c++
+#include <algorithm>
+#include <cmath>
+
+namespace MiiEngine::SceneQueryMath {
+	namespace {
+		// 軸に平行とみなす方向成分
+		constexpr float kParallelEpsilon = 1e-8f;
+
+		using V = Simd::Float1;
+
+		// Float1 の配列に展開
+		void LoadVector(const Vector3& v, V out[3]) {
+			out[0] = V::Set1(v.x);
+			out[1] = V::Set1(v.y);
+			out[2] = V::Set1(v.z);
+		}
+		void LoadOBB(const OBB& obb, V center[3], V axis[3][3], V half[3]) {
+			LoadVector(obb.center, center);
+			LoadVector(obb.halfSize, half);
+			for (int i = 0; i < 3; ++i) {
+				LoadVector(obb.axis[i], axis[i]);
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// AABBをOBBに変換
+	///-------------------------------------------///
+	OBB ToOBB(const AABB& aabb) {
+		OBB obb;
+		obb.center = (aabb.min + aabb.max) * 0.5f;
+		obb.halfSize = (aabb.max - aabb.min) * 0.5f;
+		obb.axis[0] = { 1.0f, 0.0f, 0.0f };
+		obb.axis[1] = { 0.0f, 1.0f, 0.0f };
+		obb.axis[2] = { 0.0f, 0.0f, 1.0f };
+		return obb;
+	}
+
+	///-------------------------------------------///
+	/// OBB上の最近点
+	///-------------------------------------------///
+	Vector3 ClosestPointOBB(const OBB& obb, const Vector3& point) {
+		const Vector3 diff = point - obb.center;
+		const float half[3] = { obb.halfSize.x, obb.halfSize.y, obb.halfSize.z };
+		Vector3 result = obb.center;
+		for (int i = 0; i < 3; ++i) {
+			float dist = std::clamp(Dot(diff, obb.axis[i]), -half[i], half[i]);
+			result += obb.axis[i] * dist;
+		}
+		return result;
+	}
+
+	///-------------------------------------------///
+	/// レイと球
+	///-------------------------------------------///
+	bool RaySphere(const Vector3& origin, const Vector3& direction, float maxDistance, const Sphere& sphere, float& outDistance, Vector3& outNormal) {
+		const Vector3 m = origin - sphere.center;
+		const float b = Dot(m, direction);
+		const float c = Dot(m, m) - sphere.radius * sphere.radius;
+
+		// 始点が球の外にあり、球から離れていく
+		if (c > 0.0f && b > 0.0f) {
+			return false;
+		}
+		const float discriminant = b * b - c;
+		if (discriminant < 0.0f) {
+			return false;
+		}
+
+		// 始点が球の中にある場合は 0
+		const float t = (std::max)(-b - std::sqrt(discriminant), 0.0f);
+		if (t > maxDistance) {
+			return false;
+		}
+
+		outDistance = t;
+		const Vector3 offset = origin + direction * t - sphere.center;
+		const float length = Length(offset);
+		outNormal = (t > 0.0f && length > 0.0f) ? offset / length : -direction;
+		return true;
+	}
+
+	///-------------------------------------------///
+	/// レイとOBB（OBB空間でのスラブ法）
+	///-------------------------------------------///
+	bool RayOBB(const Vector3& origin, const Vector3& direction, float maxDistance, const OBB& obb, float& outDistance, Vector3& outNormal) {
+		const Vector3 diff = origin - obb.center;
+		const float half[3] = { obb.halfSize.x, obb.halfSize.y, obb.halfSize.z };
+
+		float tMin = 0.0f;
+		float tMax = maxDistance;
+		int hitAxis = -1;
+		float hitSign = 0.0f;
+		for (int i = 0; i < 3; ++i) {
+			const float o = Dot(diff, obb.axis[i]);
+			const float d = Dot(direction, obb.axis[i]);
+
+			// 面に平行な場合は始点がスラブの内側にあるかだけ見る
+			if (std::abs(d) < kParallelEpsilon) {
+				if (o < -half[i] || o > half[i]) {
+					return false;
+				}
+				continue;
+			}
+
+			const float inv = 1.0f / d;
+			float t1 = (-half[i] - o) * inv;
+			float t2 = (half[i] - o) * inv;
+			// 入る面の向き（-側の面から入る場合は -1）
+			float sign = -1.0f;
+			if (t1 > t2) {
+				std::swap(t1, t2);
+				sign = 1.0f;
+			}
+			if (t1 > tMin) {
+				tMin = t1;
+				hitAxis = i;
+				hitSign = sign;
+			}
+			tMax = (std::min)(tMax, t2);
+			if (tMin > tMax) {
+				return false;
+			}
+		}
+
+		outDistance = tMin;
+		// 始点が内側にある場合は進行方向の逆を法線とする
+		outNormal = (hitAxis >= 0) ? obb.axis[hitAxis] * hitSign : -direction;
+		return true;
+	}
+
+	///-------------------------------------------///
+	/// 移動する球とOBB
+	///-------------------------------------------///
+	bool SphereCastOBB(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, const OBB& obb, float& outDistance, Vector3& outNormal) {
+		// 始点で既に重なっている場合は 0
+		const Vector3 startOffset = origin - ClosestPointOBB(obb, origin);
+		if (Dot(startOffset, startOffset) <= radius * radius) {
+			outDistance = 0.0f;
+			outNormal = -direction;
+			return true;
+		}
+
+		// 半径分広げた箱との交点（箱と球のミンコフスキー和を内包する）
+		OBB inflated = obb;
+		inflated.halfSize = obb.halfSize + radius;
+		float t = 0.0f;
+		Vector3 normal{};
+		if (!RayOBB(origin, direction, maxDistance, inflated, t, normal)) {
+			return false;
+		}
+
+		/// ===交点が元の箱のどの領域の外側にあるかで分類=== ///
+		const float half[3] = { obb.halfSize.x, obb.halfSize.y, obb.halfSize.z };
+		const Vector3 local = origin + direction * t - obb.center;
+		int minMask = 0; // -側の外にある軸
+		int maxMask = 0; // +側の外にある軸
+		for (int i = 0; i < 3; ++i) {
+			const float d = Dot(local, obb.axis[i]);
+			if (d < -half[i]) { minMask |= 1 << i; }
+			if (d > half[i]) { maxMask |= 1 << i; }
+		}
+		const int mask = minMask | maxMask;
+
+		// 箱の角（ビットが立っている軸は +側）
+		auto corner = [&](int bits) {
+			Vector3 result = obb.center;
+			for (int i = 0; i < 3; ++i) {
+				result += obb.axis[i] * ((bits & (1 << i)) ? half[i] : -half[i]);
+			}
+			return result;
+		};
+
+		if ((mask & (mask - 1)) != 0) {
+			float best = maxDistance + 1.0f;
+			float capsuleT = 0.0f;
+			if (mask == 7) {
+				// 角の領域: 角から伸びる3辺のカプセルのうち最も近いもの
+				for (int i = 0; i < 3; ++i) {
+					if (RayCapsule(origin, direction, maxDistance, corner(maxMask), corner(maxMask ^ (1 << i)), radius, capsuleT)) {
+						best = (std::min)(best, capsuleT);
+					}
+				}
+			} else {
+				// 辺の領域: その辺のカプセル
+				if (RayCapsule(origin, direction, maxDistance, corner(maxMask), corner(maxMask | (7 & ~mask)), radius, capsuleT)) {
+					best = capsuleT;
+				}
+			}
+			if (best > maxDistance) {
+				return false;
+			}
+			t = best;
+		}
+
+		// 面の領域はそのまま。法線は接触時の中心と最近点から求める
+		const Vector3 center = origin + direction * t;
+		const Vector3 offset = center - ClosestPointOBB(obb, center);
+		const float dist = Length(offset);
+		outDistance = t;
+		outNormal = (dist > 0.0f) ? offset / dist : -direction;
+		return true;
+	}
+
+	///-------------------------------------------///
+	/// レイとカプセル
+	///-------------------------------------------///
+	bool RayCapsule(const Vector3& origin, const Vector3& direction, float maxDistance, const Vector3& a, const Vector3& b, float radius, float& outDistance) {
+		float best = maxDistance + 1.0f;
+
+		/// ===円柱の側面=== ///
+		const Vector3 ab = b - a;
+		const Vector3 ao = origin - a;
+		const float abLengthSq = Dot(ab, ab);
+		if (abLengthSq > 0.0f) {
+			// 軸に垂直な成分だけで2次方程式を解く
+			const Vector3 dPerp = direction - ab * (Dot(direction, ab) / abLengthSq);
+			const Vector3 oPerp = ao - ab * (Dot(ao, ab) / abLengthSq);
+			const float qa = Dot(dPerp, dPerp);
+			const float qb = Dot(oPerp, dPerp);
+			const float qc = Dot(oPerp, oPerp) - radius * radius;
+			const float discriminant = qb * qb - qa * qc;
+			if (qa > kParallelEpsilon && discriminant >= 0.0f) {
+				const float t = (-qb - std::sqrt(discriminant)) / qa;
+				const float s = Dot(ao + direction * t, ab) / abLengthSq;
+				if (t >= 0.0f && t <= maxDistance && s >= 0.0f && s <= 1.0f) {
+					best = t;
+				}
+			}
+		}
+
+		/// ===両端の球=== ///
+		float t = 0.0f;
+		Vector3 normal{};
+		if (RaySphere(origin, direction, maxDistance, { a, radius }, t, normal)) {
+			best = (std::min)(best, t);
+		}
+		if (RaySphere(origin, direction, maxDistance, { b, radius }, t, normal)) {
+			best = (std::min)(best, t);
+		}
+
+		if (best > maxDistance) {
+			return false;
+		}
+		outDistance = best;
+		return true;
+	}
+
+	///-------------------------------------------///
+	/// レイとコライダー
+	///-------------------------------------------///
+	bool Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, Collider* collider, float& outDistance, Vector3& outNormal) {
+		switch (collider->GetColliderType()) {
+		case ColliderType::Sphere:
+			return RaySphere(origin, direction, maxDistance, static_cast<SphereCollider*>(collider)->GetSphere(), outDistance, outNormal);
+		case ColliderType::AABB:
+			return RayOBB(origin, direction, maxDistance, ToOBB(static_cast<AABBCollider*>(collider)->GetAABB()), outDistance, outNormal);
+		case ColliderType::OBB:
+			return RayOBB(origin, direction, maxDistance, static_cast<OBBCollider*>(collider)->GetOBB(), outDistance, outNormal);
+		default:
+			return false;
+		}
+	}
+
+	///-------------------------------------------///
+	/// スフィアキャストとコライダー
+	///-------------------------------------------///
+	bool SphereCast(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, Collider* collider, float& outDistance, Vector3& outNormal) {
+		switch (collider->GetColliderType()) {
+		case ColliderType::Sphere: {
+			// 半径を足した球とレイの判定と同じ
+			Sphere sphere = static_cast<SphereCollider*>(collider)->GetSphere();
+			sphere.radius += radius;
+			return RaySphere(origin, direction, maxDistance, sphere, outDistance, outNormal);
+		}
+		case ColliderType::AABB:
+			return SphereCastOBB(origin, radius, direction, maxDistance, ToOBB(static_cast<AABBCollider*>(collider)->GetAABB()), outDistance, outNormal);
+		case ColliderType::OBB:
+			return SphereCastOBB(origin, radius, direction, maxDistance, static_cast<OBBCollider*>(collider)->GetOBB(), outDistance, outNormal);
+		default:
+			return false;
+		}
+	}
+
+	///-------------------------------------------///
+	/// 球とコライダーの重なり
+	///-------------------------------------------///
+	bool OverlapSphere(const Sphere& sphere, Collider* collider) {
+		V center[3];
+		LoadVector(sphere.center, center);
+		const V radius = V::Set1(sphere.radius);
+
+		switch (collider->GetColliderType()) {
+		case ColliderType::Sphere: {
+			Sphere other = static_cast<SphereCollider*>(collider)->GetSphere();
+			V otherCenter[3];
+			LoadVector(other.center, otherCenter);
+			return NarrowPhaseMath::SphereSphere(center, radius, otherCenter, V::Set1(other.radius));
+		}
+		case ColliderType::AABB: {
+			AABB aabb = static_cast<AABBCollider*>(collider)->GetAABB();
+			V mn[3];
+			V mx[3];
+			LoadVector(aabb.min, mn);
+			LoadVector(aabb.max, mx);
+			return NarrowPhaseMath::SphereAABB(center, radius, mn, mx);
+		}
+		case ColliderType::OBB: {
+			V boxCenter[3];
+			V boxAxis[3][3];
+			V boxHalf[3];
+			LoadOBB(static_cast<OBBCollider*>(collider)->GetOBB(), boxCenter, boxAxis, boxHalf);
+			return NarrowPhaseMath::SphereBox(center, radius, boxCenter, boxAxis, boxHalf);
+		}
+		default:
+			return false;
+		}
+	}
+
+	///-------------------------------------------///
+	/// OBBとコライダーの重なり
+	///-------------------------------------------///
+	bool OverlapOBB(const OBB& obb, Collider* collider) {
+		V center[3];
+		V axis[3][3];
+		V half[3];
+		LoadOBB(obb, center, axis, half);
+
+		switch (collider->GetColliderType()) {
+		case ColliderType::Sphere: {
+			Sphere sphere = static_cast<SphereCollider*>(collider)->GetSphere();
+			V sphereCenter[3];
+			LoadVector(sphere.center, sphereCenter);
+			return NarrowPhaseMath::SphereBox(sphereCenter, V::Set1(sphere.radius), center, axis, half);
+		}
+		case ColliderType::AABB:
+		case ColliderType::OBB: {
+			const OBB other = (collider->GetColliderType() == ColliderType::AABB)
+				? ToOBB(static_cast<AABBCollider*>(collider)->GetAABB())
+				: static_cast<OBBCollider*>(collider)->GetOBB();
+			V otherCenter[3];
+			V otherAxis[3][3];
+			V otherHalf[3];
+			LoadOBB(other, otherCenter, otherAxis, otherHalf);
+			return NarrowPhaseMath::BoxBox(center, axis, half, otherCenter, otherAxis, otherHalf);
+		}
+		default:
+			return false;
+		}
+	}
+}
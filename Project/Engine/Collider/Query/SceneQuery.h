@@ -0,0 +1,96 @@
+#pragma once
+/// ===Include=== ///
+// Data
+#include "Engine/DataInfo/ColliderData.h"
+// c++
+#include <cstdint>
+
+namespace MiiEngine {
+	/// ===前方宣言=== ///
+	class Collider;
+
+	///-------------------------------------------///
+	/// LayerMask
+	/// ColliderName ごとに1ビット。ToLayerMask(a) | ToLayerMask(b) で複数指定する
+	///-------------------------------------------///
+	using LayerMask = uint32_t;
+	// 全てのレイヤー
+	inline constexpr LayerMask kLayerMaskAll = 0xFFFFFFFFu;
+	// ColliderName からマスクへの変換
+	constexpr LayerMask ToLayerMask(ColliderName name) { return 1u << static_cast<uint32_t>(name); }
+
+	///-------------------------------------------///
+	/// Ray
+	///-------------------------------------------///
+	struct Ray {
+		Vector3 origin;      // 始点
+		Vector3 direction;   // 方向（内部で正規化）
+		float maxDistance;   // 最大距離
+	};
+
+	///-------------------------------------------///
+	/// RaycastHit
+	///-------------------------------------------///
+	struct RaycastHit {
+		Collider* collider = nullptr; // 当たったコライダー（当たらなかった場合は nullptr）
+		ColliderHandle handle{};      // 当たったコライダーのハンドル（後から参照する場合は IsColliderAlive で確認する）
+		float distance = 0.0f;        // 始点からの距離（始点で重なっていた場合は 0）
+		Vector3 point{};              // 衝突点（スフィアキャストでは相手の表面上の点）
+		Vector3 normal{};             // 衝突面の法線（相手の表面から外向き）
+	};
+
+	///=====================================================///
+	/// SceneQueryMath
+	/// レイ・スフィアキャスト・オーバーラップの形状ごとの判定式
+	///=====================================================///
+	namespace SceneQueryMath {
+
+		/// <summary>
+		/// レイとコライダーの判定
+		/// </summary>
+		/// <param name="origin">始点。</param>
+		/// <param name="direction">正規化された方向。</param>
+		/// <param name="maxDistance">最大距離。</param>
+		/// <param name="collider">判定するコライダー。</param>
+		/// <param name="outDistance">当たった距離の出力先。</param>
+		/// <param name="outNormal">当たった面の法線の出力先。</param>
+		/// <returns>当たった場合は true。</returns>
+		bool Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, Collider* collider, float& outDistance, Vector3& outNormal);
+
+		/// <summary>
+		/// 球を移動させた時にコライダーと最初に接触する距離を求める
+		/// </summary>
+		/// <param name="origin">球の中心の始点。</param>
+		/// <param name="radius">球の半径。</param>
+		/// <param name="direction">正規化された方向。</param>
+		/// <param name="maxDistance">最大距離。</param>
+		/// <param name="collider">判定するコライダー。</param>
+		/// <param name="outDistance">接触した距離の出力先。</param>
+		/// <param name="outNormal">接触した面の法線の出力先。</param>
+		/// <returns>接触した場合は true。</returns>
+		bool SphereCast(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, Collider* collider, float& outDistance, Vector3& outNormal);
+
+		/// <summary>
+		/// 球とコライダーが重なっているか
+		/// </summary>
+		bool OverlapSphere(const Sphere& sphere, Collider* collider);
+
+		/// <summary>
+		/// OBBとコライダーが重なっているか
+		/// </summary>
+		bool OverlapOBB(const OBB& obb, Collider* collider);
+
+		// レイと球
+		bool RaySphere(const Vector3& origin, const Vector3& direction, float maxDistance, const Sphere& sphere, float& outDistance, Vector3& outNormal);
+		// レイとOBB
+		bool RayOBB(const Vector3& origin, const Vector3& direction, float maxDistance, const OBB& obb, float& outDistance, Vector3& outNormal);
+		// レイとカプセル（線分 a-b を半径分太らせた形状）
+		bool RayCapsule(const Vector3& origin, const Vector3& direction, float maxDistance, const Vector3& a, const Vector3& b, float radius, float& outDistance);
+		// 移動する球とOBB
+		bool SphereCastOBB(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, const OBB& obb, float& outDistance, Vector3& outNormal);
+		// OBB上の最近点
+		Vector3 ClosestPointOBB(const OBB& obb, const Vector3& point);
+		// AABBを軸が揃ったOBBに変換
+		OBB ToOBB(const AABB& aabb);
+	}
+}
@@ -0,0 +1,108 @@
+#include "ColliderRegistry.h"
+// Collider
+#include "Engine/Collider/Base/Collider.h"
+
+namespace MiiEngine {
+	///-------------------------------------------///
+	/// Getter
+	///-------------------------------------------///
+	// プロキシ
+	ColliderProxy* ColliderRegistry::GetProxy(ColliderHandle handle) {
+		return IsAlive(handle) ? &proxies_[slots_[handle.index].denseIndex] : nullptr;
+	}
+	const ColliderProxy* ColliderRegistry::GetProxy(ColliderHandle handle) const {
+		return IsAlive(handle) ? &proxies_[slots_[handle.index].denseIndex] : nullptr;
+	}
+	// コライダー
+	Collider* ColliderRegistry::GetOwner(ColliderHandle handle) const {
+		const ColliderProxy* proxy = GetProxy(handle);
+		return proxy ? proxy->owner : nullptr;
+	}
+	// プロキシ配列
+	std::vector<ColliderProxy>& ColliderRegistry::GetProxies() { return proxies_; }
+	const std::vector<ColliderProxy>& ColliderRegistry::GetProxies() const { return proxies_; }
+	// 登録数
+	uint32_t ColliderRegistry::GetCount() const { return static_cast<uint32_t>(proxies_.size()); }
+
+	///-------------------------------------------///
+	/// 登録
+	///-------------------------------------------///
+	ColliderHandle ColliderRegistry::Add(Collider* owner) {
+		/// ===空きスロットを再利用（なければ追加）=== ///
+		uint32_t index = freeHead_;
+		if (index != ColliderHandle::kInvalidIndex) {
+			freeHead_ = slots_[index].denseIndex;
+		} else {
+			index = static_cast<uint32_t>(slots_.size());
+			slots_.emplace_back();
+		}
+
+		Slot& slot = slots_[index];
+		slot.denseIndex = static_cast<uint32_t>(proxies_.size());
+		slot.isUsed = true;
+
+		/// ===プロキシを末尾に追加=== ///
+		ColliderProxy proxy;
+		proxy.owner = owner;
+		proxy.handle = { index, slot.generation };
+		proxy.type = owner->GetColliderType();
+		proxy.layer = owner->GetColliderName();
+		proxies_.push_back(proxy);
+		return proxy.handle;
+	}
+
+	///-------------------------------------------///
+	/// 登録の解除
+	///-------------------------------------------///
+	bool ColliderRegistry::Remove(ColliderHandle handle) {
+		if (!IsAlive(handle)) {
+			return false;
+		}
+
+		/// ===末尾のプロキシで穴を埋める=== ///
+		Slot& slot = slots_[handle.index];
+		const uint32_t denseIndex = slot.denseIndex;
+		const uint32_t lastIndex = static_cast<uint32_t>(proxies_.size()) - 1;
+		if (denseIndex != lastIndex) {
+			proxies_[denseIndex] = proxies_[lastIndex];
+			slots_[proxies_[denseIndex].handle.index].denseIndex = denseIndex;
+		}
+		proxies_.pop_back();
+
+		/// ===世代を進めて空きリストへ=== ///
+		slot.generation++;
+		slot.isUsed = false;
+		slot.denseIndex = freeHead_;
+		freeHead_ = handle.index;
+		return true;
+	}
+
+	///-------------------------------------------///
+	/// 全ての登録を解除
+	///-------------------------------------------///
+	void ColliderRegistry::Clear() {
+		// スロットは残して世代を進め、古いハンドルを無効にする
+		proxies_.clear();
+		freeHead_ = ColliderHandle::kInvalidIndex;
+		for (uint32_t i = static_cast<uint32_t>(slots_.size()); i-- > 0;) {
+			Slot& slot = slots_[i];
+			if (slot.isUsed) {
+				slot.generation++;
+				slot.isUsed = false;
+			}
+			slot.denseIndex = freeHead_;
+			freeHead_ = i;
+		}
+	}
+
+	///-------------------------------------------///
+	/// ハンドルが生きているか
+	///-------------------------------------------///
+	bool ColliderRegistry::IsAlive(ColliderHandle handle) const {
+		if (handle.index >= slots_.size()) {
+			return false;
+		}
+		const Slot& slot = slots_[handle.index];
+		return slot.isUsed && slot.generation == handle.generation;
+	}
+}
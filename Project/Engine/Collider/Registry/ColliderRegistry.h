@@ -0,0 +1,88 @@
+#pragma once
+/// ===Include=== ///
+// Data
+#include "Engine/DataInfo/ColliderData.h"
+// c++
+#include <cstdint>
+#include <vector>
+
+namespace MiiEngine {
+	/// ===前方宣言=== ///
+	class Collider;
+
+	///-------------------------------------------///
+	/// ColliderProxy
+	/// 判定ループで参照する情報だけを連続した配列に並べたもの
+	///-------------------------------------------///
+	struct ColliderProxy {
+		Collider* owner = nullptr;                 // 持ち主のコライダー
+		ColliderHandle handle{};                   // 自分のハンドル
+		ColliderType type = ColliderType::Count;   // 形状
+		ColliderName layer = ColliderName::None;   // レイヤー
+		AABB bounds{};                             // 前回の判定時の境界
+		int32_t treeProxyId = -1;                  // 動的AABB木のプロキシID（未生成は -1）
+		Vector3 lastCenter{};                      // 前回の境界中心（移動量の計算用）
+	};
+
+	///=====================================================///
+	/// ColliderRegistry
+	/// 世代付きハンドルで引くスロットマップ。追加・削除は O(1) で、
+	/// 削除は末尾の要素で穴を埋めるため、生きているプロキシは常に詰めて並ぶ
+	///=====================================================///
+	class ColliderRegistry {
+	public:
+
+		ColliderRegistry() = default;
+		~ColliderRegistry() = default;
+
+		/// <summary>
+		/// コライダーを登録してハンドルを発行
+		/// </summary>
+		/// <param name="owner">登録するコライダー。</param>
+		/// <returns>発行したハンドル。</returns>
+		ColliderHandle Add(Collider* owner);
+
+		/// <summary>
+		/// ハンドルの登録を解除（末尾のプロキシが空いた位置に移動します）
+		/// </summary>
+		/// <param name="handle">解除するハンドル。</param>
+		/// <returns>有効なハンドルだった場合は true。</returns>
+		bool Remove(ColliderHandle handle);
+
+		/// <summary>
+		/// 全ての登録を解除（発行済みのハンドルは全て無効になります）
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// ハンドルが生きているか
+		/// </summary>
+		bool IsAlive(ColliderHandle handle) const;
+
+	public: /// ===Getter=== ///
+		// ハンドルのプロキシ（無効な場合は nullptr）
+		ColliderProxy* GetProxy(ColliderHandle handle);
+		const ColliderProxy* GetProxy(ColliderHandle handle) const;
+		// ハンドルのコライダー（無効な場合は nullptr）
+		Collider* GetOwner(ColliderHandle handle) const;
+		// 詰めて並んだプロキシ
+		std::vector<ColliderProxy>& GetProxies();
+		const std::vector<ColliderProxy>& GetProxies() const;
+		// 登録数
+		uint32_t GetCount() const;
+
+	private: /// ===変数=== ///
+
+		/// ===スロット（ハンドルの番号で引く）=== ///
+		struct Slot {
+			uint32_t denseIndex = ColliderHandle::kInvalidIndex; // プロキシ配列内の位置（空きの場合は次の空きスロット）
+			uint32_t generation = 0;                             // 解除するたびに進める
+			bool isUsed = false;
+		};
+		std::vector<Slot> slots_;
+		// 空きスロットの先頭
+		uint32_t freeHead_ = ColliderHandle::kInvalidIndex;
+		// 詰めて並んだプロキシ
+		std::vector<ColliderProxy> proxies_;
+	};
+}
@@ -0,0 +1,339 @@
+#include "ContactSolver.h"
+// Collider
+#include "Engine/Collider/SphereCollider.h"
+#include "Engine/Collider/AABBCollider.h"
+#include "Engine/Collider/OBBCollider.h"
+// Query
+#include "Engine/Collider/Query/SceneQuery.h"
+// Math
+#include "Math/sMath.h"
+// c++
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+// ImGui
+#ifdef USE_IMGUI
+#include <imgui.h>
+#endif // USE_IMGUI
+
+namespace MiiEngine {
+	namespace {
+		// 0 とみなす長さ
+		constexpr float kEpsilon = 1e-6f;
+		// 平行とみなす辺の組み合わせ（外積の長さ）
+		constexpr float kParallelThreshold = 1e-3f;
+		// 辺の組み合わせの軸を採用するのに必要な差（面の軸を優先して法線を安定させる）
+		constexpr float kEdgeAxisBias = 1e-3f;
+
+		// 剛体の形状を移動
+		void MoveShape(ColliderType type, Sphere& sphere, OBB& obb, const Vector3& delta) {
+			if (type == ColliderType::Sphere) {
+				sphere.center += delta;
+			} else {
+				obb.center += delta;
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// Setter
+	///-------------------------------------------///
+	void ContactSolver::SetIterationCount(uint32_t count) { iterationCount_ = (std::max)(count, 1u); }
+
+	///-------------------------------------------///
+	/// Getter
+	///-------------------------------------------///
+	uint32_t ContactSolver::GetSolvedContactCount() const { return solvedContactCount_; }
+
+	///-------------------------------------------///
+	/// ペアの追加
+	///-------------------------------------------///
+	void ContactSolver::AddContact(Collider* a, Collider* b) {
+		if (!a || !b || a == b) {
+			return;
+		}
+
+		// 両方とも動かない場合は解消しようがない
+		uint32_t indexA = FindOrAddBody(a);
+		uint32_t indexB = FindOrAddBody(b);
+		if (bodies_[indexA].inverseMass == 0.0f && bodies_[indexB].inverseMass == 0.0f) {
+			return;
+		}
+
+		// 両側の OnCollision から呼ばれるので重複を除く
+		const uint64_t key = (static_cast<uint64_t>((std::min)(indexA, indexB)) << 32) | (std::max)(indexA, indexB);
+		if (!contactKeys_.insert(key).second) {
+			return;
+		}
+		contacts_.push_back({ indexA, indexB });
+	}
+
+	///-------------------------------------------///
+	/// めり込みの解消
+	///-------------------------------------------///
+	void ContactSolver::Solve() {
+		solvedContactCount_ = static_cast<uint32_t>(contacts_.size());
+		residualDepth_ = 0.0f;
+
+		/// ===Gauss-Seidel 反復（直前のペアで動いた位置を次のペアがそのまま使う）=== ///
+		for (uint32_t iteration = 0; iteration < iterationCount_; ++iteration) {
+			const bool isLast = (iteration + 1 == iterationCount_);
+			for (const Contact& contact : contacts_) {
+				Body& a = bodies_[contact.a];
+				Body& b = bodies_[contact.b];
+				const float totalInverseMass = a.inverseMass + b.inverseMass;
+				if (totalInverseMass <= 0.0f) {
+					continue;
+				}
+
+				Vector3 normal{};
+				float depth = 0.0f;
+				if (!ComputePenetration(a, b, normal, depth)) {
+					continue;
+				}
+				if (isLast) {
+					residualDepth_ = (std::max)(residualDepth_, depth);
+				}
+				depth -= slop_;
+				if (depth <= 0.0f) {
+					continue;
+				}
+
+				// 質量の逆数の比で配分
+				const Vector3 deltaA = normal * (-depth * a.inverseMass / totalInverseMass);
+				const Vector3 deltaB = normal * (depth * b.inverseMass / totalInverseMass);
+				a.correction += deltaA;
+				b.correction += deltaB;
+				MoveShape(a.type, a.sphere, a.obb, deltaA);
+				MoveShape(b.type, b.sphere, b.obb, deltaB);
+			}
+		}
+
+		/// ===Translate に書き戻す=== ///
+		for (const Body& body : bodies_) {
+			if (!body.collider || body.inverseMass == 0.0f) {
+				continue;
+			}
+			if (Dot(body.correction, body.correction) < kEpsilon * kEpsilon) {
+				continue;
+			}
+			body.collider->SetTranslate(body.collider->GetTransform().translate + body.correction);
+		}
+
+		Clear();
+	}
+
+	///-------------------------------------------///
+	/// コライダーの削除
+	///-------------------------------------------///
+	void ContactSolver::RemoveCollider(Collider* collider) {
+		auto it = bodyLookup_.find(collider);
+		if (it == bodyLookup_.end()) {
+			return;
+		}
+		// 相手側の計算のために形状は残し、自分は動かさない
+		Body& body = bodies_[it->second];
+		body.collider = nullptr;
+		body.inverseMass = 0.0f;
+		bodyLookup_.erase(it);
+	}
+
+	///-------------------------------------------///
+	/// 全てのペアを破棄
+	///-------------------------------------------///
+	void ContactSolver::Clear() {
+		bodies_.clear();
+		bodyLookup_.clear();
+		contacts_.clear();
+		contactKeys_.clear();
+	}
+
+	///-------------------------------------------///
+	/// ImGui情報の更新
+	///-------------------------------------------///
+	void ContactSolver::Information() {
+	#ifdef USE_IMGUI
+		if (ImGui::TreeNode("ContactSolver")) {
+			int iterationCount = static_cast<int>(iterationCount_);
+			if (ImGui::SliderInt("Iterations", &iterationCount, 1, 16)) {
+				SetIterationCount(static_cast<uint32_t>(iterationCount));
+			}
+			ImGui::DragFloat("Slop", &slop_, 0.0001f, 0.0f, 0.1f, "%.4f");
+			ImGui::Text("Contacts : %u", solvedContactCount_);
+			ImGui::Text("Residual : %.4f", residualDepth_);
+			ImGui::TreePop();
+		}
+	#endif // USE_IMGUI
+	}
+
+	///-------------------------------------------///
+	/// 剛体の取得・登録
+	///-------------------------------------------///
+	uint32_t ContactSolver::FindOrAddBody(Collider* collider) {
+		auto it = bodyLookup_.find(collider);
+		if (it != bodyLookup_.end()) {
+			return it->second;
+		}
+
+		Body body;
+		body.collider = collider;
+		switch (collider->GetColliderType()) {
+		case ColliderType::Sphere:
+			body.type = ColliderType::Sphere;
+			body.sphere = static_cast<SphereCollider*>(collider)->GetSphere();
+			break;
+		case ColliderType::AABB:
+			body.type = ColliderType::OBB;
+			body.obb = SceneQueryMath::ToOBB(static_cast<AABBCollider*>(collider)->GetAABB());
+			break;
+		case ColliderType::OBB:
+			body.type = ColliderType::OBB;
+			body.obb = static_cast<OBBCollider*>(collider)->GetOBB();
+			break;
+		default:
+			break;
+		}
+		// 静的コライダーと質量 0 のコライダーは動かさない
+		const float mass = collider->GetMass();
+		body.inverseMass = (collider->GetIsStatic() || mass <= 0.0f) ? 0.0f : 1.0f / mass;
+
+		const uint32_t index = static_cast<uint32_t>(bodies_.size());
+		bodies_.push_back(body);
+		bodyLookup_.emplace(collider, index);
+		return index;
+	}
+
+	///-------------------------------------------///
+	/// めり込みの計算
+	///-------------------------------------------///
+	bool ContactSolver::ComputePenetration(const Body& a, const Body& b, Vector3& outNormal, float& outDepth) {
+		if (a.type == ColliderType::Sphere && b.type == ColliderType::Sphere) {
+			return SphereSphere(a.sphere, b.sphere, outNormal, outDepth);
+		}
+		if (a.type == ColliderType::Sphere && b.type == ColliderType::OBB) {
+			return SphereOBB(a.sphere, b.obb, outNormal, outDepth);
+		}
+		if (a.type == ColliderType::OBB && b.type == ColliderType::Sphere) {
+			// 球から見た法線を反転
+			if (!SphereOBB(b.sphere, a.obb, outNormal, outDepth)) {
+				return false;
+			}
+			outNormal = -outNormal;
+			return true;
+		}
+		if (a.type == ColliderType::OBB && b.type == ColliderType::OBB) {
+			return OBBOBB(a.obb, b.obb, outNormal, outDepth);
+		}
+		return false;
+	}
+
+	///-------------------------------------------///
+	/// 球同士
+	///-------------------------------------------///
+	bool ContactSolver::SphereSphere(const Sphere& a, const Sphere& b, Vector3& outNormal, float& outDepth) {
+		const Vector3 diff = b.center - a.center;
+		const float distance = Length(diff);
+		const float depth = a.radius + b.radius - distance;
+		if (depth <= 0.0f) {
+			return false;
+		}
+		// 中心が重なっている場合は上方向に分ける
+		outNormal = (distance < kEpsilon) ? Vector3(0.0f, 1.0f, 0.0f) : diff / distance;
+		outDepth = depth;
+		return true;
+	}
+
+	///-------------------------------------------///
+	/// 球とOBB
+	///-------------------------------------------///
+	bool ContactSolver::SphereOBB(const Sphere& sphere, const OBB& obb, Vector3& outNormal, float& outDepth) {
+		const Vector3 closest = SceneQueryMath::ClosestPointOBB(obb, sphere.center);
+		const Vector3 diff = closest - sphere.center;
+		const float distanceSq = Dot(diff, diff);
+
+		/// ===中心がOBBの外にある場合は最近点の方向=== ///
+		if (distanceSq > kEpsilon * kEpsilon) {
+			const float distance = std::sqrt(distanceSq);
+			if (distance >= sphere.radius) {
+				return false;
+			}
+			outNormal = diff / distance;
+			outDepth = sphere.radius - distance;
+			return true;
+		}
+
+		/// ===中心がOBBの中にある場合は最も近い面から押し出す=== ///
+		const Vector3 local = sphere.center - obb.center;
+		const float halfSize[3] = { obb.halfSize.x, obb.halfSize.y, obb.halfSize.z };
+		float minDistance = FLT_MAX;
+		for (int i = 0; i < 3; ++i) {
+			const float offset = Dot(local, obb.axis[i]);
+			const float faceDistance = halfSize[i] - std::abs(offset);
+			if (faceDistance < minDistance) {
+				minDistance = faceDistance;
+				// 球は offset の向きへ出るので、球からOBBへの法線はその逆
+				outNormal = (offset >= 0.0f) ? -obb.axis[i] : obb.axis[i];
+			}
+		}
+		outDepth = sphere.radius + minDistance;
+		return true;
+	}
+
+	///-------------------------------------------///
+	/// OBB同士
+	///-------------------------------------------///
+	bool ContactSolver::OBBOBB(const OBB& a, const OBB& b, Vector3& outNormal, float& outDepth) {
+		const Vector3 offset = b.center - a.center;
+		const float halfA[3] = { a.halfSize.x, a.halfSize.y, a.halfSize.z };
+		const float halfB[3] = { b.halfSize.x, b.halfSize.y, b.halfSize.z };
+
+		float minOverlap = FLT_MAX;
+		Vector3 minAxis = Vector3(0.0f, 1.0f, 0.0f);
+
+		// 正規化済みの軸で重なりを求め、最小なら記録（分離していれば false）
+		auto testAxis = [&](const Vector3& axis, float bias) {
+			float radius = 0.0f;
+			for (int i = 0; i < 3; ++i) {
+				radius += halfA[i] * std::abs(Dot(a.axis[i], axis));
+				radius += halfB[i] * std::abs(Dot(b.axis[i], axis));
+			}
+			const float distance = Dot(offset, axis);
+			const float overlap = radius - std::abs(distance);
+			if (overlap <= 0.0f) {
+				return false;
+			}
+			if (overlap + bias < minOverlap) {
+				minOverlap = overlap;
+				// a から b へ向ける
+				minAxis = (distance >= 0.0f) ? axis : -axis;
+			}
+			return true;
+		};
+
+		/// ===面法線 6 本=== ///
+		for (int i = 0; i < 3; ++i) {
+			if (!testAxis(a.axis[i], 0.0f) || !testAxis(b.axis[i], 0.0f)) {
+				return false;
+			}
+		}
+
+		/// ===辺の組み合わせ 9 本=== ///
+		for (int i = 0; i < 3; ++i) {
+			for (int j = 0; j < 3; ++j) {
+				Vector3 axis = Math::Cross(a.axis[i], b.axis[j]);
+				const float length = Length(axis);
+				// 平行な辺の組み合わせは面法線で判定済み
+				if (length < kParallelThreshold) {
+					continue;
+				}
+				if (!testAxis(axis / length, kEdgeAxisBias)) {
+					return false;
+				}
+			}
+		}
+
+		outNormal = minAxis;
+		outDepth = minOverlap;
+		return true;
+	}
+}
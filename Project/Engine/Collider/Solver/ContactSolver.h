@@ -0,0 +1,124 @@
+#pragma once
+/// ===Include=== ///
+// Data
+#include "Engine/DataInfo/ColliderData.h"
+// c++
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace MiiEngine {
+	/// ===前方宣言=== ///
+	class Collider;
+
+	///=====================================================///
+	/// ContactSolver
+	/// 1フレーム分の押し戻しの要求を集め、Gauss-Seidel 反復でまとめてめり込みを解消する。
+	/// 各ペアの移動量は質量の逆数の比で配分し、静的コライダーと質量 0 のコライダーは動かさない
+	///=====================================================///
+	class ContactSolver {
+	public:
+
+		ContactSolver() = default;
+		~ContactSolver() = default;
+
+		/// <summary>
+		/// 押し戻しを行うペアを追加（同じペアを両側から追加しても1つにまとめます）
+		/// </summary>
+		/// <param name="a">1番目のコライダー。</param>
+		/// <param name="b">2番目のコライダー。</param>
+		void AddContact(Collider* a, Collider* b);
+
+		/// <summary>
+		/// 集めたペアのめり込みを解消し、結果を各コライダーの Translate に書き戻してから空にします。
+		/// </summary>
+		void Solve();
+
+		/// <summary>
+		/// 指定したコライダーを動かさないようにする（削除されるコライダー用）
+		/// </summary>
+		/// <param name="collider">削除されるコライダー。</param>
+		void RemoveCollider(Collider* collider);
+
+		/// <summary>
+		/// 全てのペアを破棄
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// ImGui情報の更新
+		/// </summary>
+		void Information();
+
+	public: /// ===Setter=== ///
+		// 反復回数
+		void SetIterationCount(uint32_t count);
+
+	public: /// ===Getter=== ///
+		// 前回の Solve で処理したペア数
+		uint32_t GetSolvedContactCount() const;
+
+	private: /// ===変数=== ///
+
+		/// ===剛体（形状は反復中に押し戻した位置へ更新する）=== ///
+		struct Body {
+			Collider* collider = nullptr;
+			ColliderType type = ColliderType::Count; // AABB は OBB として扱う
+			Sphere sphere{};
+			OBB obb{};
+			float inverseMass = 0.0f;                // 0 は動かない
+			Vector3 correction{};                     // 反復で累積した移動量
+		};
+		std::vector<Body> bodies_;
+		std::unordered_map<Collider*, uint32_t> bodyLookup_;
+
+		/// ===ペア（bodies_ の番号）=== ///
+		struct Contact {
+			uint32_t a = 0;
+			uint32_t b = 0;
+		};
+		std::vector<Contact> contacts_;
+		// 重複の確認用（小さい番号を上位に詰めたキー）
+		std::unordered_set<uint64_t> contactKeys_;
+
+		// 反復回数
+		uint32_t iterationCount_ = 4;
+		// 解消せずに残すめり込み（接触し続けるペアが毎フレーム離れて振動しないように）
+		float slop_ = 0.001f;
+		// 前回の Solve で処理したペア数
+		uint32_t solvedContactCount_ = 0;
+		// 前回の Solve で残った最大のめり込み
+		float residualDepth_ = 0.0f;
+
+	private: /// ===関数=== ///
+
+		/// <summary>
+		/// コライダーの剛体番号を取得（初めての場合は今の形状で登録）
+		/// </summary>
+		uint32_t FindOrAddBody(Collider* collider);
+
+		/// <summary>
+		/// 2つの剛体のめり込みを求める
+		/// </summary>
+		/// <param name="outNormal">a から b へ向かう単位法線の出力先。</param>
+		/// <param name="outDepth">めり込みの深さの出力先。</param>
+		/// <returns>めり込んでいる場合は true。</returns>
+		static bool ComputePenetration(const Body& a, const Body& b, Vector3& outNormal, float& outDepth);
+
+		/// <summary>
+		/// 球同士のめり込み
+		/// </summary>
+		static bool SphereSphere(const Sphere& a, const Sphere& b, Vector3& outNormal, float& outDepth);
+
+		/// <summary>
+		/// 球とOBBのめり込み（法線は球からOBBへ向かう）
+		/// </summary>
+		static bool SphereOBB(const Sphere& sphere, const OBB& obb, Vector3& outNormal, float& outDepth);
+
+		/// <summary>
+		/// OBB同士のめり込み（分離軸のうち重なりが最小の軸）
+		/// </summary>
+		static bool OBBOBB(const OBB& a, const OBB& b, Vector3& outNormal, float& outDepth);
+	};
+}
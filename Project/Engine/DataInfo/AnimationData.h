@@ -55,6 +55,15 @@ namespace MiiEngine {
 		AnimationCurve<Vector3> scale;
 	};
 
+	/// <summary>
+	/// ノードアニメーションの再生カーソル（チャンネルごとに前回のキーの番号を保持。トラック内での番号）
+	/// </summary>
+	struct NodeAnimationCursor {
+		size_t translate = 0;
+		size_t rotate = 0;
+		size_t scale = 0;
+	};
+
 	/// <summary>
 	/// アニメーションの構造体
 	/// </summary>
@@ -86,6 +95,36 @@ namespace MiiEngine {
 		std::vector<Joint> joints; // 所属しているジョイント
 	};
 
+	/// <summary>
+	/// キーフレーム配列の範囲（AnimationClip の連続した配列の [begin, begin + count)）
+	/// </summary>
+	struct KeyframeRange {
+		uint32_t begin = 0;
+		uint32_t count = 0; // 0 ならそのチャンネルはJointの値を変更しない
+	};
+
+	/// <summary>
+	/// Jointに対応付けたトラック
+	/// </summary>
+	struct AnimationTrack {
+		int32_t jointIndex; // 対象のJointのIndex
+		KeyframeRange translate;
+		KeyframeRange rotate;
+		KeyframeRange scale;
+	};
+
+	/// <summary>
+	/// Skeletonに対応付けたアニメーション（SetAnimation時に1回だけ作成する）
+	/// トラックはJointのIndex順に並び、各チャンネルのキーフレームも同じ順に連続して並ぶ
+	/// </summary>
+	struct AnimationClip {
+		float duration = 0.0f;						// アニメーション全体の尺(単位は秒)
+		std::vector<AnimationTrack> tracks;			// チャンネルがあるJointのトラックのみ
+		std::vector<KeyframeVector3> translateKeys;	// 全トラックのTranslateのキーフレーム
+		std::vector<KeyframeQuaternion> rotateKeys;	// 全トラックのRotateのキーフレーム
+		std::vector<KeyframeVector3> scaleKeys;		// 全トラックのScaleのキーフレーム
+	};
+
 	/// <summary>
 	/// Influence(インフルエンス)
 	/// </summary>
@@ -103,6 +142,23 @@ namespace MiiEngine {
 		Matrix4x4 skeletonSpaceInverseTransposeMatrix; // 法線用
 	};
 
+	/// <summary>
+	/// MatrixPalette(コンパクト版。48byte)
+	/// skeletonSpaceMatrix の4列目は常に (0, 0, 0, 1) なので、残りの3列を行として格納する。
+	/// 法線用の行列はシェーダーで左上3x3の余因子から求める
+	/// </summary>
+	struct WellForGPUCompact {
+		float skeletonSpaceMatrix[3][4]; // 位置用（skeletonSpaceMatrix を転置した上3行）
+	};
+
+	/// <summary>
+	/// MatrixPaletteの形式
+	/// </summary>
+	enum class SkinningPaletteFormat {
+		Full,		// WellForGPU（位置用と法線用の4x4行列。128byte）
+		Compact,	// WellForGPUCompact（位置用の3x4行列のみ。48byte）
+	};
+
 	/// <summary>
 	/// SkinCluster
 	/// </summary>
@@ -112,7 +168,9 @@ namespace MiiEngine {
 		D3D12_VERTEX_BUFFER_VIEW influenceBufferView;
 		std::span<VertexInfluence> mappedInfluence;
 		ComPtr<ID3D12Resource> paletteResource;
-		std::span<WellForGPU> mappedPalette;
+		SkinningPaletteFormat paletteFormat = SkinningPaletteFormat::Full;
+		std::span<WellForGPU> mappedPalette;				// Full の場合のみ
+		std::span<WellForGPUCompact> mappedCompactPalette;	// Compact の場合のみ
 		std::pair<D3D12_CPU_DESCRIPTOR_HANDLE, D3D12_GPU_DESCRIPTOR_HANDLE> paletteSrvHandle;
 	};
 }
\ No newline at end of file
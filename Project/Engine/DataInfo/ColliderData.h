@@ -1,6 +1,8 @@
 #pragma once
 #include "Math/Vector2.h"
 #include "Math/Vector3.h"
+// c++
+#include <cstdint>
 
 namespace MiiEngine {
     ///-------------------------------------------/// 
@@ -52,5 +54,17 @@ namespace MiiEngine {
         Vector3 center;  // 中心
         float radius;    // 半径
     };
-}
 
+    ///-------------------------------------------/// 
+    /// ColliderHandle
+    /// ColliderManager に登録された時に発行される。削除されると世代が進み、古いハンドルは無効と判定される
+    ///-------------------------------------------///
+    struct ColliderHandle {
+        static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+        uint32_t index = kInvalidIndex; // スロット番号
+        uint32_t generation = 0;        // 発行時の世代
+
+        bool IsValid() const { return index != kInvalidIndex; }
+        bool operator==(const ColliderHandle& other) const { return index == other.index && generation == other.generation; }
+    };
+}
@@ -38,11 +38,20 @@ namespace MiiEngine {
 
     ///=====================================================/// 
     /// パーティクルGPU送信用データ
+    /// 行列は送らず、頂点シェーダーで SRT とカメラ行列から WVP を組み立てる
     ///=====================================================///
     struct ParticleForGPU {
-        Matrix4x4 WVP;    // ワールドビュープロジェクション行列
-        Matrix4x4 World;  // ワールド行列
-        Vector4 color;    // 色
+        Vector4 translate; // xyz: 位置
+        Vector4 rotate;    // xyz: 回転（オイラー角）
+        Vector4 scale;     // xyz: スケール
+        Vector4 color;     // 色
+    };
+
+    ///=====================================================/// 
+    /// パーティクルのカメラ定数（グループごとに1フレーム1回書き込む）
+    ///=====================================================///
+    struct ParticleCameraForGPU {
+        Matrix4x4 viewProjection; // ビュープロジェクション行列
     };
 
     ///=====================================================/// 
@@ -185,4 +194,29 @@ namespace MiiEngine {
         float trailSpacing = 0.008f;           // 軌跡の間隔(秒)
         bool clearOnStop = true;               // 停止時にクリアするか
     };
+
+    ///-------------------------------------------/// 
+    /// パーティクルのLOD・カリング設定
+    ///-------------------------------------------///
+    struct ParticleLodSettings {
+        static constexpr int kBandCount = 3;
+
+        // 視錐台カリング（見えない間は発生と移動を止め、寿命だけ進める）
+        // 自動計算の半径は渦巻きや軌跡を含まないため、定義ごとに確認してから有効にする
+        bool enableCulling = false;            // 視錐台カリングを行うか
+        float boundsRadius = 0.0f;             // 境界球の半径（0 の場合は発生範囲・速度・寿命から求める）
+
+        // 距離による発生数の削減（カメラからの距離が bandDistances[i] 以上で bandEmissionScales[i] 倍）
+        bool enableLod = false;                                       // 距離LODを行うか
+        float bandDistances[kBandCount] = { 20.0f, 40.0f, 80.0f };    // 各帯の開始距離（昇順）
+        float bandEmissionScales[kBandCount] = { 0.75f, 0.5f, 0.25f }; // 各帯での発生数の倍率
+    };
+
+    ///-------------------------------------------/// 
+    /// パーティクルの予算設定（全体の上限を超えた時に、発生数をどのグループから削るか）
+    ///-------------------------------------------///
+    struct ParticleBudgetSettings {
+        int priority = 0;                      // 優先度（大きいほど先に予算を割り当てる）
+        uint32_t minimumGuarantee = 0;         // 優先度に関係なく1グループに残す粒子数
+    };
 }
\ No newline at end of file
@@ -25,6 +25,8 @@ namespace MiiEngine {
 		Particle,
 		// Skinning3D
 		Skinning3D,
+		// SkinningCompact3D（3x4のMatrixPaletteを使うSkinning3D）
+		SkinningCompact3D,
 		// Line3D
 		Line3D,
 		// OffScreen
@@ -75,6 +77,7 @@ namespace MiiEngine {
 			PipelineType::PrimitiveSkyBox,
 			PipelineType::Particle ,
 			PipelineType::Skinning3D,
+			PipelineType::SkinningCompact3D,
 			PipelineType::Ocean,
 			PipelineType::FFTOcean,
 			PipelineType::Line3D,
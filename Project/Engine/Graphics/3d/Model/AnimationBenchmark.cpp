@@ -0,0 +1,606 @@
+#include "AnimationBenchmark.h"
+#include "AnimationSampler.h"
+#include "AnimationPose.h"
+// c++
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+// Engine
+#include "Engine/System/Job/JobSystem.h"
+// Math
+#include "Math/sMath.h"
+#include "Math/MatrixMath.h"
+
+namespace MiiEngine {
+	namespace {
+		using Clock = std::chrono::steady_clock;
+
+		// コマンドラインから "key=値" の値を取得（見つからない場合は空）
+		std::string FindOption(const std::string& commandLine, const std::string& key) {
+			const std::string prefix = key + "=";
+			const size_t begin = commandLine.find(prefix);
+			if (begin == std::string::npos) {
+				return {};
+			}
+			const size_t valueBegin = begin + prefix.size();
+			const size_t valueEnd = commandLine.find(' ', valueBegin);
+			return commandLine.substr(valueBegin, valueEnd == std::string::npos ? std::string::npos : valueEnd - valueBegin);
+		}
+
+		// 計測用のクリップを生成（Jointごとに同じキー数・同じ間隔）
+		std::vector<NodeAnimation> CreateClip(uint32_t jointCount, uint32_t keyCount, float keyInterval) {
+			std::vector<NodeAnimation> clip(jointCount);
+			for (uint32_t joint = 0; joint < jointCount; ++joint) {
+				NodeAnimation& node = clip[joint];
+				node.translate.keyframes.resize(keyCount);
+				node.rotate.keyframes.resize(keyCount);
+				node.scale.keyframes.resize(keyCount);
+				for (uint32_t key = 0; key < keyCount; ++key) {
+					const float time = static_cast<float>(key) * keyInterval;
+					const float phase = time * 3.0f + static_cast<float>(joint);
+					const float halfAngle = std::sin(phase) * 0.5f;
+					node.translate.keyframes[key] = { time, { std::sin(phase), std::cos(phase), 0.0f } };
+					node.rotate.keyframes[key] = { time, { 0.0f, std::sin(halfAngle), 0.0f, std::cos(halfAngle) } };
+					node.scale.keyframes[key] = { time, { 1.0f, 1.0f, 1.0f } };
+				}
+			}
+			return clip;
+		}
+
+		// クリップと同じ数のJointを持つSkeletonを生成（Joint名はクリップのチャンネル名と一致）
+		Skeleton CreateSkeleton(uint32_t jointCount) {
+			Skeleton skeleton;
+			skeleton.root = 0;
+			skeleton.joints.resize(jointCount);
+			for (uint32_t index = 0; index < jointCount; ++index) {
+				Joint& joint = skeleton.joints[index];
+				joint.name = "Joint_" + std::to_string(index);
+				joint.index = static_cast<int32_t>(index);
+				if (index > 0) {
+					joint.parent = static_cast<int32_t>(index - 1);
+				}
+				skeleton.jointMap.emplace(joint.name, joint.index);
+			}
+			return skeleton;
+		}
+
+		// 計測用のモデルデータを生成（頂点・インデックス・スキンウェイト・Jointと同じ形のノード木）
+		ModelData CreateModelData(uint32_t vertexCount, uint32_t jointCount) {
+			ModelData modelData;
+			modelData.vertices.resize(vertexCount);
+			modelData.indices.resize(static_cast<size_t>(vertexCount) * 3);
+			for (size_t index = 0; index < modelData.indices.size(); ++index) {
+				modelData.indices[index] = static_cast<uint32_t>(index % vertexCount);
+			}
+			for (uint32_t joint = 0; joint < jointCount; ++joint) {
+				jointWeightData& weight = modelData.skinClusterData["Joint_" + std::to_string(joint)];
+				weight.inverseBindPoseMatrix = Math::MakeIdentity4x4();
+				for (uint32_t vertex = joint; vertex < vertexCount; vertex += jointCount) {
+					weight.vertexWeights.push_back({ 1.0f, vertex });
+				}
+			}
+			// Jointを親子の1列につなげる
+			std::vector<Node> nodes(jointCount);
+			for (uint32_t joint = jointCount; joint-- > 0;) {
+				nodes[joint].name = "Joint_" + std::to_string(joint);
+				nodes[joint].localMatrix = Math::MakeIdentity4x4();
+				if (joint + 1 < jointCount) {
+					nodes[joint].children.push_back(std::move(nodes[joint + 1]));
+				}
+			}
+			if (jointCount > 0) {
+				modelData.rootNode = std::move(nodes[0]);
+			}
+			modelData.material.textureFilePath = "uvChecker.png";
+			modelData.haveBone = true;
+			return modelData;
+		}
+
+		// ノード木のデータ量
+		size_t CalculateBytes(const Node& node) {
+			size_t bytes = node.name.capacity() + node.children.capacity() * sizeof(Node);
+			for (const Node& child : node.children) {
+				bytes += CalculateBytes(child);
+			}
+			return bytes;
+		}
+
+		// モデルデータのデータ量（ModelData 本体を含む）
+		size_t CalculateBytes(const ModelData& modelData) {
+			size_t bytes = sizeof(ModelData);
+			bytes += modelData.vertices.capacity() * sizeof(VertexData3D);
+			bytes += modelData.indices.capacity() * sizeof(uint32_t);
+			bytes += modelData.material.textureFilePath.capacity();
+			for (const auto& [name, weight] : modelData.skinClusterData) {
+				bytes += name.capacity() + sizeof(weight) + weight.vertexWeights.capacity() * sizeof(VertexWeightData);
+			}
+			return bytes + CalculateBytes(modelData.rootNode);
+		}
+
+		// アニメーションのデータ量
+		size_t CalculateBytes(const std::map<std::string, Animation>& animations) {
+			size_t bytes = sizeof(animations);
+			for (const auto& [animationName, animation] : animations) {
+				bytes += animationName.capacity() + sizeof(Animation);
+				for (const auto& [nodeName, node] : animation.nodeAnimations) {
+					bytes += nodeName.capacity() + sizeof(NodeAnimation);
+					bytes += node.translate.keyframes.capacity() * sizeof(KeyframeVector3);
+					bytes += node.rotate.keyframes.capacity() * sizeof(KeyframeQuaternion);
+					bytes += node.scale.keyframes.capacity() * sizeof(KeyframeVector3);
+				}
+			}
+			return bytes;
+		}
+
+		// クリップのデータ量
+		size_t CalculateBytes(const AnimationClip& clip) {
+			return sizeof(AnimationClip) + clip.tracks.capacity() * sizeof(AnimationTrack) +
+				clip.translateKeys.capacity() * sizeof(KeyframeVector3) +
+				clip.rotateKeys.capacity() * sizeof(KeyframeQuaternion) +
+				clip.scaleKeys.capacity() * sizeof(KeyframeVector3);
+		}
+
+		// 従来の方法（先頭から線形探索）
+		template<typename tValue>
+		tValue SampleLinear(const std::vector<Keyframe<tValue>>& keyframes, float time) {
+			if (keyframes.size() == 1 || time <= keyframes[0].time) {
+				return keyframes[0].value;
+			}
+			for (size_t index = 0; index < keyframes.size() - 1; ++index) {
+				size_t nextIndex = index + 1;
+				if (keyframes[index].time <= time && time <= keyframes[nextIndex].time) {
+					float t = (time - keyframes[index].time) / (keyframes[nextIndex].time - keyframes[index].time);
+					if constexpr (std::is_same_v<tValue, Quaternion>) {
+						return Math::SLerp(keyframes[index].value, keyframes[nextIndex].value, t);
+					} else {
+						return Math::Lerp(keyframes[index].value, keyframes[nextIndex].value, t);
+					}
+				}
+			}
+			return keyframes.back().value;
+		}
+
+		// ループ再生で frameCount フレーム分のポーズを評価し、1フレームあたりの時間（ns）を返す
+		template<typename tSampleFunc>
+		double MeasurePerFrame(const AnimationBenchmarkSettings& settings, float duration, tSampleFunc&& samplePose) {
+			float animationTime = 0.0f;
+			const Clock::time_point start = Clock::now();
+			for (uint32_t frame = 0; frame < settings.frameCount; ++frame) {
+				animationTime = std::fmod(animationTime + settings.deltaTime, duration);
+				samplePose(animationTime);
+			}
+			const Clock::duration elapsed = Clock::now() - start;
+			return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(settings.frameCount);
+		}
+
+		// 最適化で消されないように結果を足し込む先
+		volatile float gSink = 0.0f;
+	}
+
+	///-------------------------------------------///
+	/// サンプリングの計測
+	///-------------------------------------------///
+	std::vector<AnimationSamplingResult> AnimationBenchmark::RunSampling(const AnimationBenchmarkSettings& settings) {
+		std::vector<AnimationSamplingResult> results;
+
+		for (uint32_t keyCount : settings.keyCounts) {
+			if (keyCount < 2 || settings.jointCount == 0 || settings.frameCount == 0) {
+				continue;
+			}
+			const std::vector<NodeAnimation> clip = CreateClip(settings.jointCount, keyCount, settings.keyInterval);
+
+			AnimationSamplingResult result;
+			result.keyCount = keyCount;
+			result.clipDuration = static_cast<float>(keyCount - 1) * settings.keyInterval;
+
+			/// ===従来の線形探索=== ///
+			result.linearNsPerFrame = MeasurePerFrame(settings, result.clipDuration, [&](float time) {
+				float sum = 0.0f;
+				for (const NodeAnimation& node : clip) {
+					sum += SampleLinear(node.translate.keyframes, time).x;
+					sum += SampleLinear(node.rotate.keyframes, time).w;
+					sum += SampleLinear(node.scale.keyframes, time).y;
+				}
+				gSink = gSink + sum;
+			});
+
+			/// ===毎回二分探索（カーソルを毎回無効にする）=== ///
+			result.binaryNsPerFrame = MeasurePerFrame(settings, result.clipDuration, [&](float time) {
+				float sum = 0.0f;
+				for (const NodeAnimation& node : clip) {
+					NodeAnimationCursor cursor{ SIZE_MAX, SIZE_MAX, SIZE_MAX };
+					sum += AnimationSampler::Sample(node.translate.keyframes, time, cursor.translate).x;
+					sum += AnimationSampler::Sample(node.rotate.keyframes, time, cursor.rotate).w;
+					sum += AnimationSampler::Sample(node.scale.keyframes, time, cursor.scale).y;
+				}
+				gSink = gSink + sum;
+			});
+
+			/// ===カーソル=== ///
+			std::vector<NodeAnimationCursor> cursors(clip.size());
+			result.cursorNsPerFrame = MeasurePerFrame(settings, result.clipDuration, [&](float time) {
+				float sum = 0.0f;
+				for (size_t joint = 0; joint < clip.size(); ++joint) {
+					const NodeAnimation& node = clip[joint];
+					NodeAnimationCursor& cursor = cursors[joint];
+					sum += AnimationSampler::Sample(node.translate.keyframes, time, cursor.translate).x;
+					sum += AnimationSampler::Sample(node.rotate.keyframes, time, cursor.rotate).w;
+					sum += AnimationSampler::Sample(node.scale.keyframes, time, cursor.scale).y;
+				}
+				gSink = gSink + sum;
+			});
+
+			/// ===Joint名でチャンネルを引いて適用（従来の ApplyAnimation）=== ///
+			Skeleton skeleton = CreateSkeleton(settings.jointCount);
+			Animation animation;
+			animation.duration = result.clipDuration;
+			for (size_t joint = 0; joint < clip.size(); ++joint) {
+				animation.nodeAnimations.emplace(skeleton.joints[joint].name, clip[joint]);
+			}
+			std::fill(cursors.begin(), cursors.end(), NodeAnimationCursor{});
+			result.nameLookupNsPerFrame = MeasurePerFrame(settings, result.clipDuration, [&](float time) {
+				for (Joint& joint : skeleton.joints) {
+					if (auto it = animation.nodeAnimations.find(joint.name); it != animation.nodeAnimations.end()) {
+						NodeAnimationCursor& cursor = cursors[joint.index];
+						joint.transform.translate = AnimationSampler::Sample(it->second.translate.keyframes, time, cursor.translate);
+						joint.transform.rotate = AnimationSampler::Sample(it->second.rotate.keyframes, time, cursor.rotate);
+						joint.transform.scale = AnimationSampler::Sample(it->second.scale.keyframes, time, cursor.scale);
+					}
+				}
+				gSink = gSink + skeleton.joints.back().transform.translate.x;
+			});
+
+			/// ===Skeletonに対応付けたクリップで適用=== ///
+			const AnimationClip animationClip = AnimationSampler::CreateClip(animation, skeleton);
+			std::vector<NodeAnimationCursor> trackCursors(animationClip.tracks.size());
+			result.clipNsPerFrame = MeasurePerFrame(settings, result.clipDuration, [&](float time) {
+				AnimationSampler::ApplyClip(animationClip, time, trackCursors, skeleton.joints);
+				gSink = gSink + skeleton.joints.back().transform.translate.x;
+			});
+
+			results.push_back(result);
+		}
+		return results;
+	}
+
+	///-------------------------------------------///
+	/// インスタンス生成の計測
+	///-------------------------------------------///
+	AnimationSpawnResult AnimationBenchmark::RunSpawn(const AnimationBenchmarkSettings& settings) {
+		AnimationSpawnResult result;
+		result.spawnCount = settings.spawnCount;
+		if (settings.spawnCount == 0 || settings.jointCount == 0 || settings.spawnKeyCount < 2) {
+			return result;
+		}
+
+		/// ===マネージャが保持するアセット（1セット分）=== ///
+		const std::string animationName = "Walk";
+		const std::shared_ptr<const ModelData> model = std::make_shared<const ModelData>(CreateModelData(settings.spawnVertexCount, settings.jointCount));
+		const Skeleton skeleton = CreateSkeleton(settings.jointCount);
+		std::map<std::string, Animation> animationData;
+		{
+			const std::vector<NodeAnimation> nodes = CreateClip(settings.jointCount, settings.spawnKeyCount, settings.keyInterval);
+			Animation& animation = animationData[animationName];
+			animation.duration = static_cast<float>(settings.spawnKeyCount - 1) * settings.keyInterval;
+			for (uint32_t joint = 0; joint < settings.jointCount; ++joint) {
+				animation.nodeAnimations.emplace(skeleton.joints[joint].name, nodes[joint]);
+			}
+		}
+		const std::shared_ptr<const std::map<std::string, Animation>> animations = std::make_shared<const std::map<std::string, Animation>>(std::move(animationData));
+		std::map<std::string, std::shared_ptr<const AnimationClip>> clipCache;
+		clipCache[animationName] = std::make_shared<const AnimationClip>(AnimationSampler::CreateClip(animations->at(animationName), skeleton));
+		result.assetBytes = CalculateBytes(*model) + CalculateBytes(*animations) + CalculateBytes(*clipCache[animationName]);
+
+		/// ===値でコピー（モデル・アニメーションを複製し、クリップも1体ごとに作成）=== ///
+		struct CopiedInstance {
+			ModelData model;
+			std::map<std::string, Animation> animations;
+			AnimationClip clip;
+		};
+		std::vector<CopiedInstance> copied;
+		copied.reserve(settings.spawnCount);
+		Clock::time_point start = Clock::now();
+		for (uint32_t spawn = 0; spawn < settings.spawnCount; ++spawn) {
+			CopiedInstance& instance = copied.emplace_back();
+			instance.model = *model;
+			instance.animations = *animations;
+			instance.clip = AnimationSampler::CreateClip(instance.animations.at(animationName), skeleton);
+		}
+		result.copyMicrosecondsPerSpawn = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / static_cast<double>(settings.spawnCount);
+		result.copyBytesPerInstance = CalculateBytes(copied.front().model) + CalculateBytes(copied.front().animations) + CalculateBytes(copied.front().clip);
+
+		/// ===共有ポインタ（作成済みのクリップを引くだけ）=== ///
+		struct SharedInstance {
+			std::shared_ptr<const ModelData> model;
+			std::shared_ptr<const AnimationClip> clip;
+		};
+		std::vector<SharedInstance> shared;
+		shared.reserve(settings.spawnCount);
+		start = Clock::now();
+		for (uint32_t spawn = 0; spawn < settings.spawnCount; ++spawn) {
+			SharedInstance& instance = shared.emplace_back();
+			instance.model = model;
+			instance.clip = clipCache.at(animationName);
+		}
+		result.sharedMicrosecondsPerSpawn = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / static_cast<double>(settings.spawnCount);
+		result.sharedBytesPerInstance = sizeof(SharedInstance);
+
+		gSink = gSink + static_cast<float>(copied.size() + shared.size());
+		return result;
+	}
+
+	///-------------------------------------------///
+	/// 一括更新の計測
+	///-------------------------------------------///
+	std::vector<AnimationBatchResult> AnimationBenchmark::RunBatch(const AnimationBenchmarkSettings& settings) {
+		std::vector<AnimationBatchResult> results;
+		if (settings.batchCharacterCount == 0 || settings.jointCount == 0 || settings.batchKeyCount < 2 || settings.batchFrameCount == 0) {
+			return results;
+		}
+
+		/// ===全キャラクターで共有するクリップ=== ///
+		const Skeleton skeleton = CreateSkeleton(settings.jointCount);
+		Animation animation;
+		animation.duration = static_cast<float>(settings.batchKeyCount - 1) * settings.keyInterval;
+		{
+			const std::vector<NodeAnimation> nodes = CreateClip(settings.jointCount, settings.batchKeyCount, settings.keyInterval);
+			for (uint32_t joint = 0; joint < settings.jointCount; ++joint) {
+				animation.nodeAnimations.emplace(skeleton.joints[joint].name, nodes[joint]);
+			}
+		}
+		const AnimationClip clip = AnimationSampler::CreateClip(animation, skeleton);
+		const std::vector<Matrix4x4> inverseBindPoseMatrices(settings.jointCount, Math::MakeIdentity4x4());
+
+		/// ===キャラクターごとの状態（AnimationModel が持つものと同じ）=== ///
+		struct Character {
+			float animationTime = 0.0f;
+			Skeleton skeleton;
+			std::vector<NodeAnimationCursor> cursors;
+			std::vector<WellForGPU> palette; // マップしたバッファの代わり
+		};
+		std::vector<Character> characters(settings.batchCharacterCount);
+		auto resetCharacters = [&]() {
+			for (uint32_t index = 0; index < settings.batchCharacterCount; ++index) {
+				Character& character = characters[index];
+				character.animationTime = std::fmod(static_cast<float>(index) * 0.37f, animation.duration); // 再生位置をずらす
+				character.skeleton = skeleton;
+				character.cursors.assign(clip.tracks.size(), NodeAnimationCursor{});
+				character.palette.assign(settings.jointCount, WellForGPU{});
+			}
+		};
+		auto updateRange = [&](uint32_t begin, uint32_t end, uint32_t) {
+			for (uint32_t index = begin; index < end; ++index) {
+				Character& character = characters[index];
+				character.animationTime = std::fmod(character.animationTime + settings.deltaTime, clip.duration);
+				AnimationSampler::ApplyClip(clip, character.animationTime, character.cursors, character.skeleton.joints);
+				AnimationPose::UpdateSkeleton(character.skeleton);
+				AnimationPose::UpdatePalette(character.palette, inverseBindPoseMatrices, character.skeleton);
+			}
+		};
+
+		/// ===スレッド数ごとに計測=== ///
+		const uint32_t count = settings.batchCharacterCount;
+		for (uint32_t threadCount : settings.batchThreadCounts) {
+			if (threadCount == 0) {
+				continue;
+			}
+			std::unique_ptr<JobSystem> jobSystem;
+			if (threadCount > 1) {
+				jobSystem = std::make_unique<JobSystem>();
+				jobSystem->Initialize(threadCount - 1);
+			}
+			resetCharacters();
+
+			AnimationBatchResult result;
+			result.threadCount = jobSystem ? jobSystem->GetThreadCount() : 1;
+			const Clock::time_point start = Clock::now();
+			for (uint32_t frame = 0; frame < settings.batchFrameCount; ++frame) {
+				if (jobSystem) {
+					jobSystem->ParallelFor(count, 1, updateRange);
+				} else {
+					updateRange(0, count, 0);
+				}
+			}
+			result.msPerFrame = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / static_cast<double>(settings.batchFrameCount);
+			gSink = gSink + characters.back().palette.back().skeletonSpaceMatrix.m[3][0];
+
+			if (jobSystem) {
+				jobSystem->Finalize();
+			}
+			results.push_back(result);
+		}
+
+		/// ===1スレッドに対する速度比=== ///
+		if (!results.empty() && results.front().threadCount == 1) {
+			for (AnimationBatchResult& result : results) {
+				result.speedup = result.msPerFrame > 0.0 ? results.front().msPerFrame / result.msPerFrame : 0.0;
+			}
+		}
+		return results;
+	}
+
+	///-------------------------------------------///
+	/// MatrixPaletteの計測
+	///-------------------------------------------///
+	AnimationPaletteResult AnimationBenchmark::RunPalette(const AnimationBenchmarkSettings& settings) {
+		AnimationPaletteResult result;
+		result.jointCount = settings.jointCount;
+		result.fullBytesPerJoint = sizeof(WellForGPU);
+		result.compactBytesPerJoint = sizeof(WellForGPUCompact);
+		if (settings.jointCount == 0 || settings.paletteIterationCount == 0) {
+			return result;
+		}
+
+		/// ===スケールが一様でない姿勢を作る=== ///
+		Skeleton skeleton = CreateSkeleton(settings.jointCount);
+		for (Joint& joint : skeleton.joints) {
+			const float phase = static_cast<float>(joint.index);
+			const float halfAngle = std::sin(phase) * 0.5f;
+			joint.transform.scale = { 1.0f + 0.1f * std::sin(phase), 1.0f, 1.0f + 0.1f * std::cos(phase) };
+			joint.transform.rotate = Normalize(Quaternion{ std::sin(halfAngle) * 0.6f, std::sin(halfAngle) * 0.8f, 0.0f, std::cos(halfAngle) });
+			joint.transform.translate = { 0.0f, 0.1f, 0.05f * phase };
+		}
+		AnimationPose::UpdateSkeleton(skeleton);
+		const std::vector<Matrix4x4> inverseBindPoseMatrices(settings.jointCount, Math::MakeIdentity4x4());
+		std::vector<WellForGPU> reference(settings.jointCount);
+		std::vector<WellForGPU> palette(settings.jointCount);
+		std::vector<WellForGPUCompact> compactPalette(settings.jointCount);
+		const double jointUpdates = static_cast<double>(settings.jointCount) * static_cast<double>(settings.paletteIterationCount);
+
+		/// ===従来の方法（4x4の逆行列と転置）=== ///
+		Clock::time_point start = Clock::now();
+		for (uint32_t iteration = 0; iteration < settings.paletteIterationCount; ++iteration) {
+			for (size_t jointIndex = 0; jointIndex < skeleton.joints.size(); ++jointIndex) {
+				reference[jointIndex].skeletonSpaceMatrix = Multiply(inverseBindPoseMatrices[jointIndex], skeleton.joints[jointIndex].skeletonSpaceMatrix);
+				reference[jointIndex].skeletonSpaceInverseTransposeMatrix = Math::TransposeMatrix(Math::Inverse4x4(reference[jointIndex].skeletonSpaceMatrix));
+			}
+			gSink = gSink + reference.back().skeletonSpaceInverseTransposeMatrix.m[0][0];
+		}
+		result.inverse4x4NsPerJoint = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / jointUpdates;
+
+		/// ===余因子による逆転置=== ///
+		start = Clock::now();
+		for (uint32_t iteration = 0; iteration < settings.paletteIterationCount; ++iteration) {
+			AnimationPose::UpdatePalette(std::span<WellForGPU>(palette), inverseBindPoseMatrices, skeleton);
+			gSink = gSink + palette.back().skeletonSpaceInverseTransposeMatrix.m[0][0];
+		}
+		result.affineNsPerJoint = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / jointUpdates;
+
+		/// ===コンパクト形式=== ///
+		start = Clock::now();
+		for (uint32_t iteration = 0; iteration < settings.paletteIterationCount; ++iteration) {
+			AnimationPose::UpdatePalette(std::span<WellForGPUCompact>(compactPalette), inverseBindPoseMatrices, skeleton);
+			gSink = gSink + compactPalette.back().skeletonSpaceMatrix[0][3];
+		}
+		result.compactNsPerJoint = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / jointUpdates;
+
+		/// ===従来の方法との誤差=== ///
+		for (size_t jointIndex = 0; jointIndex < reference.size(); ++jointIndex) {
+			for (int row = 0; row < 4; ++row) {
+				for (int column = 0; column < 4; ++column) {
+					const float error = std::abs(reference[jointIndex].skeletonSpaceInverseTransposeMatrix.m[row][column] -
+						palette[jointIndex].skeletonSpaceInverseTransposeMatrix.m[row][column]);
+					result.maxAffineError = (std::max)(result.maxAffineError, error);
+				}
+			}
+			// コンパクト形式は位置用の行列を転置した上3行
+			for (int row = 0; row < 3; ++row) {
+				for (int column = 0; column < 4; ++column) {
+					const float error = std::abs(reference[jointIndex].skeletonSpaceMatrix.m[column][row] -
+						compactPalette[jointIndex].skeletonSpaceMatrix[row][column]);
+					result.maxCompactError = (std::max)(result.maxCompactError, error);
+				}
+			}
+		}
+		return result;
+	}
+
+	///-------------------------------------------///
+	/// JSONに変換
+	///-------------------------------------------///
+	nlohmann::json AnimationBenchmark::ToJson(const std::vector<AnimationSamplingResult>& results, const AnimationSpawnResult& spawn,
+		const std::vector<AnimationBatchResult>& batch, const AnimationPaletteResult& palette, const AnimationBenchmarkSettings& settings) {
+		nlohmann::json json;
+		json["settings"] = {
+			{"jointCount", settings.jointCount},
+			{"keyInterval", settings.keyInterval},
+			{"deltaTime", settings.deltaTime},
+			{"frameCount", settings.frameCount},
+			{"spawnVertexCount", settings.spawnVertexCount},
+			{"spawnKeyCount", settings.spawnKeyCount},
+			{"spawnCount", settings.spawnCount},
+			{"batchCharacterCount", settings.batchCharacterCount},
+			{"batchKeyCount", settings.batchKeyCount},
+			{"batchFrameCount", settings.batchFrameCount},
+			{"paletteIterationCount", settings.paletteIterationCount},
+			{"hardwareThreadCount", std::thread::hardware_concurrency()}
+		};
+
+		nlohmann::json entries = nlohmann::json::array();
+		for (const AnimationSamplingResult& result : results) {
+			entries.push_back({
+				{"keyCount", result.keyCount},
+				{"clipDuration", result.clipDuration},
+				{"linearNsPerFrame", result.linearNsPerFrame},
+				{"binaryNsPerFrame", result.binaryNsPerFrame},
+				{"cursorNsPerFrame", result.cursorNsPerFrame},
+				{"nameLookupNsPerFrame", result.nameLookupNsPerFrame},
+				{"clipNsPerFrame", result.clipNsPerFrame}
+			});
+		}
+		json["sampling"] = entries;
+		json["spawn"] = {
+			{"spawnCount", spawn.spawnCount},
+			{"assetBytes", spawn.assetBytes},
+			{"copyMicrosecondsPerSpawn", spawn.copyMicrosecondsPerSpawn},
+			{"sharedMicrosecondsPerSpawn", spawn.sharedMicrosecondsPerSpawn},
+			{"copyBytesPerInstance", spawn.copyBytesPerInstance},
+			{"sharedBytesPerInstance", spawn.sharedBytesPerInstance}
+		};
+
+		nlohmann::json batchEntries = nlohmann::json::array();
+		for (const AnimationBatchResult& result : batch) {
+			batchEntries.push_back({
+				{"threadCount", result.threadCount},
+				{"msPerFrame", result.msPerFrame},
+				{"speedup", result.speedup}
+			});
+		}
+		json["batch"] = batchEntries;
+		json["palette"] = {
+			{"jointCount", palette.jointCount},
+			{"inverse4x4NsPerJoint", palette.inverse4x4NsPerJoint},
+			{"affineNsPerJoint", palette.affineNsPerJoint},
+			{"compactNsPerJoint", palette.compactNsPerJoint},
+			{"fullBytesPerJoint", palette.fullBytesPerJoint},
+			{"compactBytesPerJoint", palette.compactBytesPerJoint},
+			{"maxAffineError", palette.maxAffineError},
+			{"maxCompactError", palette.maxCompactError}
+		};
+		return json;
+	}
+
+	///-------------------------------------------///
+	/// コマンドラインから実行
+	///-------------------------------------------///
+	int AnimationBenchmark::RunFromCommandLine(const std::string& commandLine) {
+		AnimationBenchmarkSettings settings;
+		std::string outputPath = kDefaultOutputPath;
+
+		/// ===引数の読み取り=== ///
+		if (const std::string value = FindOption(commandLine, "--animation-benchmark-out"); !value.empty()) {
+			outputPath = value;
+		}
+		if (const std::string value = FindOption(commandLine, "--animation-benchmark-frames"); !value.empty()) {
+			settings.frameCount = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+		}
+		if (settings.frameCount == 0) {
+			return 1;
+		}
+
+		/// ===計測して書き込み=== ///
+		const std::vector<AnimationSamplingResult> results = RunSampling(settings);
+		const AnimationSpawnResult spawn = RunSpawn(settings);
+		const std::vector<AnimationBatchResult> batch = RunBatch(settings);
+		const AnimationPaletteResult palette = RunPalette(settings);
+		std::ofstream file(outputPath);
+		if (!file.is_open()) {
+			return 1;
+		}
+		file << ToJson(results, spawn, batch, palette, settings).dump(4);
+
+		// コンパクト形式は同じ行列を並べ替えるだけなので、従来の位置用の行列と完全に一致しなければ失敗
+		if (palette.maxCompactError != 0.0f) {
+			return 1;
+		}
+		return results.empty() ? 1 : 0;
+	}
+}
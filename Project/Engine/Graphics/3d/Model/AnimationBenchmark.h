@@ -0,0 +1,141 @@
+#pragma once
+/// ===Include=== ///
+// c++
+#include <cstdint>
+#include <string>
+#include <vector>
+// JSON
+#include <json.hpp>
+
+namespace MiiEngine {
+	///=====================================================///
+	/// ベンチマークの設定
+	///=====================================================///
+	struct AnimationBenchmarkSettings {
+		uint32_t jointCount = 64;                                   // 1ポーズあたりのJoint数
+		float keyInterval = 1.0f / 30.0f;                           // キーの間隔（秒）
+		float deltaTime = 1.0f / 60.0f;                             // 固定デルタタイム
+		uint32_t frameCount = 600;                                  // 計測するフレーム数（ループ再生）
+		std::vector<uint32_t> keyCounts = { 8, 32, 128, 512, 2048 }; // 計測するクリップの長さ（キー数）
+		uint32_t spawnVertexCount = 20000;                          // 生成計測用モデルの頂点数
+		uint32_t spawnKeyCount = 512;                               // 生成計測用クリップのキー数
+		uint32_t spawnCount = 32;                                   // 生成するインスタンス数
+		uint32_t batchCharacterCount = 128;                         // 一括更新の計測に使うキャラクター数
+		uint32_t batchKeyCount = 128;                               // 一括更新の計測用クリップのキー数
+		uint32_t batchFrameCount = 120;                             // 一括更新の計測フレーム数
+		std::vector<uint32_t> batchThreadCounts = { 1, 2, 4, 8 };   // 計測するスレッド数（1 はジョブシステムを使わない）
+		uint32_t paletteIterationCount = 2000;                      // MatrixPaletteの計測で全Jointを更新する回数
+	};
+
+	///=====================================================///
+	/// 1クリップ長分のサンプリングの計測結果
+	///=====================================================///
+	struct AnimationSamplingResult {
+		uint32_t keyCount = 0;          // 1チャンネルあたりのキー数
+		float clipDuration = 0.0f;      // クリップの尺（秒）
+		double linearNsPerFrame = 0.0;  // 先頭からの線形探索（従来の方法）での1フレームあたりの時間（ns）
+		double binaryNsPerFrame = 0.0;  // 毎回二分探索した場合の1フレームあたりの時間（ns）
+		double cursorNsPerFrame = 0.0;  // カーソルを使った場合の1フレームあたりの時間（ns）
+		double nameLookupNsPerFrame = 0.0; // Joint名でチャンネルを引いてJointに適用した場合の1フレームあたりの時間（ns）
+		double clipNsPerFrame = 0.0;    // Skeletonに対応付けたクリップ（AnimationClip）で適用した場合の1フレームあたりの時間（ns）
+	};
+
+	///=====================================================///
+	/// インスタンス生成（アセットの取得）の計測結果
+	///=====================================================///
+	struct AnimationSpawnResult {
+		uint32_t spawnCount = 0;                // 生成したインスタンス数
+		size_t assetBytes = 0;                  // モデル・アニメーション・クリップのデータ量（1セット分）
+		double copyMicrosecondsPerSpawn = 0.0;  // 値でコピーして取得した場合の1体あたりの時間（μs）
+		double sharedMicrosecondsPerSpawn = 0.0; // 共有ポインタで取得した場合の1体あたりの時間（μs）
+		size_t copyBytesPerInstance = 0;        // 値でコピーした場合に1体が保持するデータ量
+		size_t sharedBytesPerInstance = 0;      // 共有した場合に1体が保持するデータ量（共有ポインタ分のみ）
+	};
+
+	///=====================================================///
+	/// 全キャラクターのポーズの一括更新の計測結果（スレッド数ごと）
+	///=====================================================///
+	struct AnimationBatchResult {
+		uint32_t threadCount = 0;       // 処理に参加したスレッド数（呼び出し元を含む）
+		double msPerFrame = 0.0;        // 全キャラクターのポーズ更新の1フレームあたりの時間（ms）
+		double speedup = 0.0;           // 1スレッドに対する速度比
+	};
+
+	///=====================================================///
+	/// MatrixPaletteの更新の計測結果
+	///=====================================================///
+	struct AnimationPaletteResult {
+		uint32_t jointCount = 0;            // 1パレットあたりのJoint数
+		double inverse4x4NsPerJoint = 0.0;  // 4x4の逆行列と転置で法線用の行列を求めた場合（従来の方法）の1Jointあたりの時間（ns）
+		double affineNsPerJoint = 0.0;      // 左上3x3の余因子で求めた場合の1Jointあたりの時間（ns）
+		double compactNsPerJoint = 0.0;     // 3x4のコンパクト形式（法線用の行列はシェーダーで計算）の1Jointあたりの時間（ns）
+		size_t fullBytesPerJoint = 0;       // WellForGPU の1Jointあたりの転送量
+		size_t compactBytesPerJoint = 0;    // WellForGPUCompact の1Jointあたりの転送量
+		float maxAffineError = 0.0f;        // 従来の方法との最大誤差（法線用の行列の要素の差の絶対値）
+		float maxCompactError = 0.0f;       // コンパクト形式の3行と従来の方法の位置用の行列（転置）との最大誤差
+	};
+
+	///=====================================================///
+	/// AnimationBenchmark
+	/// ウィンドウと D3D12 を作らずに、生成したクリップでアニメーション処理を計測する
+	///=====================================================///
+	class AnimationBenchmark {
+	public:
+
+		/// <summary>
+		/// クリップの長さごとに、1ポーズ（全Joint・3チャンネル）のサンプリング時間と、Jointへの適用時間を計測
+		/// </summary>
+		/// <param name="settings">ベンチマークの設定</param>
+		/// <returns>keyCounts の順の計測結果</returns>
+		static std::vector<AnimationSamplingResult> RunSampling(const AnimationBenchmarkSettings& settings);
+
+		/// <summary>
+		/// AnimationModel の生成時に行うアセットの取得を、値のコピーと共有ポインタで比較
+		/// （GPUリソースの作成は含まない）
+		/// </summary>
+		/// <param name="settings">ベンチマークの設定</param>
+		/// <returns>計測結果</returns>
+		static AnimationSpawnResult RunSpawn(const AnimationBenchmarkSettings& settings);
+
+		/// <summary>
+		/// AnimationManager::Update と同じ処理（クリップの適用・Skeleton・MatrixPaletteの更新）を
+		/// 全キャラクター分行い、スレッド数ごとの1フレームあたりの時間を計測
+		/// </summary>
+		/// <param name="settings">ベンチマークの設定</param>
+		/// <returns>batchThreadCounts の順の計測結果</returns>
+		static std::vector<AnimationBatchResult> RunBatch(const AnimationBenchmarkSettings& settings);
+
+		/// <summary>
+		/// MatrixPaletteの更新を、従来の4x4の逆行列・余因子による逆転置・コンパクト形式で比較
+		/// （スケールが一様でない姿勢で計測し、従来の方法との誤差とコンパクト形式の並びも確認する）
+		/// </summary>
+		/// <param name="settings">ベンチマークの設定</param>
+		/// <returns>計測結果</returns>
+		static AnimationPaletteResult RunPalette(const AnimationBenchmarkSettings& settings);
+
+		/// <summary>
+		/// 計測結果を JSON に変換（回帰の比較用）
+		/// </summary>
+		/// <param name="results">サンプリングの計測結果</param>
+		/// <param name="spawn">生成の計測結果</param>
+		/// <param name="batch">一括更新の計測結果</param>
+		/// <param name="palette">MatrixPaletteの計測結果</param>
+		/// <param name="settings">計測時の設定</param>
+		/// <returns>設定と結果をまとめた JSON</returns>
+		static nlohmann::json ToJson(const std::vector<AnimationSamplingResult>& results, const AnimationSpawnResult& spawn,
+			const std::vector<AnimationBatchResult>& batch, const AnimationPaletteResult& palette, const AnimationBenchmarkSettings& settings);
+
+		/// <summary>
+		/// コマンドラインから実行（--animation-benchmark が含まれる場合に main から呼ぶ）
+		/// 指定できる引数: --animation-benchmark-out=パス --animation-benchmark-frames=フレーム数
+		/// </summary>
+		/// <param name="commandLine">コマンドライン引数</param>
+		/// <returns>終了コード（結果を書き込めなかった場合・コンパクト形式の行列が一致しなかった場合は 1）</returns>
+		static int RunFromCommandLine(const std::string& commandLine);
+
+	private:
+
+		// 結果の既定の出力先
+		static constexpr const char* kDefaultOutputPath = "AnimationBenchmark.json";
+	};
+}
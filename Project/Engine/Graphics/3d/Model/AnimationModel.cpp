@@ -1,4 +1,6 @@
 #include "AnimationModel.h"
+#include "AnimationSampler.h"
+#include "AnimationPose.h"
 #define NOMINMAX
 // c++
 #include <Windows.h>
@@ -12,6 +14,7 @@
 #include "Service/Render.h"
 // Manager
 #include "Engine/System/Managers/SRVManager.h"
+#include "Engine/System/Managers/AnimationManager.h"
 // Math
 #include "Math/sMath.h"
 #include "Math/EasingMath.h"
@@ -21,14 +24,24 @@ namespace MiiEngine {
 	///-------------------------------------------/// 
 	/// デストラクタ
 	///-------------------------------------------///
-	AnimationModel::~AnimationModel() {}
+	AnimationModel::~AnimationModel() {
+		// 一括更新の登録を解除
+		AnimationManager* animationManager = Service::Locator::GetAnimationManager();
+		if (isRegistered_ && animationManager) {
+			animationManager->Unregister(this);
+		}
+	}
 
 	///-------------------------------------------/// 
 	/// Setter
 	///-------------------------------------------///
 	/// ===AnimationName=== ///
 	void AnimationModel::SetAnimation(const std::string& animationName, bool isLoop) {
-		animationName_ = animationName;
+		// 別のアニメーションに切り替えた場合だけSkeletonに対応付け直す
+		if (animationName_ != animationName) {
+			animationName_ = animationName;
+			BindAnimation();
+		}
 		isLoop_ = isLoop;
 	}
 
@@ -42,15 +55,20 @@ namespace MiiEngine {
 		/// ===モデル読み込み=== ///
 		modelData_ = Service::GraphicsResourceGetter::GetModelData(filename); // ファイルパス
 
-		/// ===Animationの読み込み=== ///
-		animation_ = Service::GraphicsResourceGetter::GetAnimationData(filename); // ファイルパス
+		/// ===Animationのキー=== ///
+		filename_ = filename; // アニメーションはSkeletonに対応付けたクリップとして共有する
 
 		/// ===Boneがあれば=== ///
-		if (modelData_.haveBone) {
+		if (modelData_->haveBone) {
 			/// ===Skeletonの作成=== ///
-			skeleton_ = CreateSkeleton(modelData_.rootNode);
+			skeleton_ = CreateSkeleton(modelData_->rootNode);
 			/// ===SkinClusterの作成=== ///
-			skinCluster_ = CreateSkinCluster(device, skeleton_, modelData_);
+			skinCluster_ = CreateSkinCluster(device, skeleton_, *modelData_, paletteFormat_);
+			/// ===ポーズはAnimationManagerでまとめて更新する=== ///
+			if (!isRegistered_) {
+				Service::Locator::GetAnimationManager()->Register(this);
+				isRegistered_ = true;
+			}
 		}
 
 		/// ===ModelCommonの初期化=== ///
@@ -59,6 +77,7 @@ namespace MiiEngine {
 		/// ===animation=== ///
 		isLoop_ = true;
 		animationTime_ = 0.0f;
+		BindAnimation();
 	}
 
 	///-------------------------------------------/// 
@@ -67,9 +86,25 @@ namespace MiiEngine {
 	void AnimationModel::Update() {
 
 		/// ===Animationの再生=== ///
-		float duration = animation_[animationName_].duration;
+		if (isRegistered_) {
+			isPoseRequested_ = true; // 全てのオブジェクトの更新後にAnimationManagerが並列で更新する
+		} else {
+			UpdatePose();
+		}
+
+		/// ===ModelCommonの更新=== ///
+		ModelCommon::Update();
+	}
+
+	///-------------------------------------------/// 
+	/// ポーズの更新
+	///-------------------------------------------///
+	void AnimationModel::UpdatePose() {
+		float duration = clip_ ? clip_->duration : 0.0f;
 		// ループするかのif分
-		if (isLoop_) {
+		if (duration <= 0.0f) {
+			animationTime_ = 0.0f; // 尺がない（アニメーションが見つからない）場合は進めない
+		} else if (isLoop_) {
 			animationTime_ += 1.0f / 60.0f;
 			animationTime_ = std::fmod(animationTime_, duration); // ループ
 		} else {
@@ -83,14 +118,22 @@ namespace MiiEngine {
 		}
 
 		// SkeletonにAnimationを適用
-		ApplyAnimation(skeleton_, animation_[animationName_], animationTime_);
+		if (clip_) {
+			ApplyAnimation(skeleton_, *clip_, animationTime_, cursors_);
+		}
 		// Skeletonの更新
 		SkeletonUpdate(skeleton_);
 		// SkinClusterの更新
 		SkinClusterUpdate(skinCluster_, skeleton_);
+	}
 
-		/// ===ModelCommonの更新=== ///
-		ModelCommon::Update();
+	///-------------------------------------------/// 
+	/// ポーズの更新要求の取得
+	///-------------------------------------------///
+	bool AnimationModel::ConsumePoseRequest() {
+		bool isRequested = isPoseRequested_;
+		isPoseRequested_ = false;
+		return isRequested;
 	}
 
 	///-------------------------------------------/// 
@@ -99,7 +142,7 @@ namespace MiiEngine {
 	void AnimationModel::Draw(BlendMode mode) {
 		/// ===コマンドリストのポインタの取得=== ///
 		ID3D12GraphicsCommandList* commandList = Service::GraphicsResourceGetter::GetDXCommandList();
-		if (modelData_.haveBone) {
+		if (modelData_->haveBone) {
 			/// ===VBVの設定=== ///
 			D3D12_VERTEX_BUFFER_VIEW vbvs[2] = {
 				vertexBufferView_, // VertexDataのVBV
@@ -107,8 +150,9 @@ namespace MiiEngine {
 			};
 
 			/// ===コマンドリストに設定=== ///
-			// PSOの設定
-			Service::Render::SetPSO(commandList, PipelineType::Skinning3D, mode);
+			// PSOの設定（パレットの形式でVertexShaderが変わる）
+			PipelineType pipelineType = skinCluster_.paletteFormat == SkinningPaletteFormat::Compact ? PipelineType::SkinningCompact3D : PipelineType::Skinning3D;
+			Service::Render::SetPSO(commandList, pipelineType, mode);
 			// Viewの設定
 			commandList->IASetVertexBuffers(0, 1, &vertexBufferView_);
 			commandList->IASetVertexBuffers(0, 2, vbvs);
@@ -130,59 +174,10 @@ namespace MiiEngine {
 		commandList->SetGraphicsRootDescriptorTable(9, skinCluster_.paletteSrvHandle.second);
 
 		// 描画（Drawコール）
-		commandList->DrawIndexedInstanced(UINT(modelData_.indices.size()), 1, 0, 0, 0);
-	}
-
-
-	///-------------------------------------------/// 
-	/// 任意の時刻の値を取得する関数
-	///-------------------------------------------///
-	Vector3 AnimationModel::CalculateValue(const std::vector<KeyframeVector3>& keyframes, float time) {
-		/// ===任意の時刻の値を取得する=== ///
-		assert(!keyframes.empty()); // キーがない物は返す値がわからないのでだめ
-		if (keyframes.size() == 1 || time <= keyframes[0].time) { // キーが一つか、時刻がキーフレーム前なら最初の値とする
-			return keyframes[0].value;
-		}
-
-		/// ===任意の自国の値を取得する2=== ///
-		for (size_t index = 0; index < keyframes.size() - 1; ++index) {
-			size_t nextIndex = index + 1;
-			// indexとnextIndexの2つのkeyframeを取得して範囲内に時刻があるかを判定
-			if (keyframes[index].time <= time && time <= keyframes[nextIndex].time) {
-				// 範囲内を線形補間する(Lerp)
-				float t = (time - keyframes[index].time) / (keyframes[nextIndex].time - keyframes[index].time);
-				return Math::Lerp(keyframes[index].value, keyframes[nextIndex].value, t);
-			}
-		}
-		// ここまでできた場合は一番後の時刻よりも後ろなので最後の値を返すことにする
-		return (*keyframes.rbegin()).value;
+		commandList->DrawIndexedInstanced(UINT(modelData_->indices.size()), 1, 0, 0, 0);
 	}
 
 
-	///-------------------------------------------/// 
-	/// 任意の時刻の値を取得する関数(Quaternion)
-	///-------------------------------------------///
-	Quaternion AnimationModel::CalculateValue(const std::vector<KeyframeQuaternion>& keyframes, float time) {
-		/// ===任意の時刻の値を取得する=== ///
-		assert(!keyframes.empty()); // キーがない物は返す値がわからないのでだめ
-		if (keyframes.size() == 1 || time <= keyframes[0].time) { // キーが一つか、時刻がキーフレーム前なら最初の値とする
-			return keyframes[0].value;
-		}
-
-		/// ===任意の自国の値を取得する2=== ///
-		for (size_t index = 0; index < keyframes.size() - 1; ++index) {
-			size_t nextIndex = index + 1;
-			// indexとnextIndexの2つのkeyframeを取得して範囲内に時刻があるかを判定
-			if (keyframes[index].time <= time && time <= keyframes[nextIndex].time) {
-				// 範囲内を球面線形補間する(SLerp)
-				float t = (time - keyframes[index].time) / (keyframes[nextIndex].time - keyframes[index].time);
-				return Math::SLerp(keyframes[index].value, keyframes[nextIndex].value, t);
-			}
-		}
-		// ここまでできた場合は一番後の時刻よりも後ろなので最後の値を返すことにする
-		return (*keyframes.rbegin()).value;
-	}
-
 	///-------------------------------------------/// 
 	/// Nodeの階層構造からSkeletonを作る関数
 	///-------------------------------------------///
@@ -222,46 +217,48 @@ namespace MiiEngine {
 	///-------------------------------------------/// 
 	/// Skeletonに対してAnimationの適用を行う関数
 	///-------------------------------------------///
-	void AnimationModel::ApplyAnimation(Skeleton& skeleton, const Animation& animation, float animationTime) {
-		for (Joint& joint : skeleton.joints) {
-			// 対象のJointのAnimationがあれば、値の適用を行う。下記のif分はc++17から可能になった初期化付きif分
-			if (auto it = animation.nodeAnimations.find(joint.name); it != animation.nodeAnimations.end()) {
-				const NodeAnimation& rootNodeAnimation = (*it).second;
-				joint.transform.translate = CalculateValue(rootNodeAnimation.translate.keyframes, animationTime);
-				joint.transform.rotate = CalculateValue(rootNodeAnimation.rotate.keyframes, animationTime);
-				joint.transform.scale = CalculateValue(rootNodeAnimation.scale.keyframes, animationTime);
-			}
-		}
+	void AnimationModel::ApplyAnimation(Skeleton& skeleton, const AnimationClip& clip, float animationTime, std::vector<NodeAnimationCursor>& cursors) {
+		// トラックはJointのIndex順に並んでいるので、Joint名を引かずに1回の走査で適用できる
+		AnimationSampler::ApplyClip(clip, animationTime, cursors, skeleton.joints);
+	}
+
+	///-------------------------------------------/// 
+	/// アニメーションをSkeletonに対応付ける関数
+	///-------------------------------------------///
+	void AnimationModel::BindAnimation() {
+		// 対応付けは同じモデルで1回だけ行われ、2体目以降は同じクリップを共有する
+		clip_ = Service::GraphicsResourceGetter::GetAnimationClip(filename_, animationName_, skeleton_);
+		// カーソルは先頭に戻す
+		cursors_.assign(clip_ ? clip_->tracks.size() : 0, NodeAnimationCursor{});
 	}
 
 	///-------------------------------------------/// 
 	/// Skeletonの更新関数
 	///-------------------------------------------///
 	void AnimationModel::SkeletonUpdate(Skeleton& skeleton) {
-		// 全てのJointを更新。親が若いので通常ループで処理を可能にしている。
-		for (Joint& joint : skeleton.joints) {
-			joint.localMatrix = Math::MakeAffineQuaternionMatrix(joint.transform.scale, joint.transform.rotate, joint.transform.translate);
-			if (joint.parent) { // 親がいなければ親の行列を掛ける
-				joint.skeletonSpaceMatrix = Multiply(joint.localMatrix, skeleton.joints[*joint.parent].skeletonSpaceMatrix);
-			} else { // 親がいないのでlocalMatrixとskeletonSpaceMatrixは一致する
-				joint.skeletonSpaceMatrix = joint.localMatrix;
-			}
-		}
+		AnimationPose::UpdateSkeleton(skeleton);
 	}
 
 	///-------------------------------------------/// 
 	/// SkinClusterの生成
 	///-------------------------------------------///
 	SkinCluster AnimationModel::CreateSkinCluster(
-		const ComPtr<ID3D12Device>& device, const Skeleton& skeleton, const ModelData& modelData) {
+		const ComPtr<ID3D12Device>& device, const Skeleton& skeleton, const ModelData& modelData, SkinningPaletteFormat paletteFormat) {
 
 		SkinCluster skinCluster;
 		/// ===Palette用のResourceを確保=== ///
+		skinCluster.paletteFormat = paletteFormat;
+		const UINT paletteStride = paletteFormat == SkinningPaletteFormat::Compact ? sizeof(WellForGPUCompact) : sizeof(WellForGPU);
 		uint32_t paletteIndex = Service::Locator::GetSRVManager()->Allocate();
-		skinCluster.paletteResource = CreateBufferResourceComPtr(device.Get(), sizeof(WellForGPU) * skeleton.joints.size());
-		WellForGPU* mappedPalette = nullptr;
-		skinCluster.paletteResource->Map(0, nullptr, reinterpret_cast<void**>(&mappedPalette));
-		skinCluster.mappedPalette = { mappedPalette, skeleton.joints.size() }; // spanを使ってアクセスするようにする
+		skinCluster.paletteResource = CreateBufferResourceComPtr(device.Get(), paletteStride * skeleton.joints.size());
+		void* mappedPalette = nullptr;
+		skinCluster.paletteResource->Map(0, nullptr, &mappedPalette);
+		// spanを使ってアクセスするようにする
+		if (paletteFormat == SkinningPaletteFormat::Compact) {
+			skinCluster.mappedCompactPalette = { static_cast<WellForGPUCompact*>(mappedPalette), skeleton.joints.size() };
+		} else {
+			skinCluster.mappedPalette = { static_cast<WellForGPU*>(mappedPalette), skeleton.joints.size() };
+		}
 		skinCluster.paletteSrvHandle.first = Service::Locator::GetSRVManager()->GetCPUDescriptorHandle(paletteIndex);
 		skinCluster.paletteSrvHandle.second = Service::Locator::GetSRVManager()->GetGPUDescriptorHandle(paletteIndex);
 
@@ -273,7 +270,7 @@ namespace MiiEngine {
 		paletteSrvDesc.Buffer.FirstElement = 0;
 		paletteSrvDesc.Buffer.Flags = D3D12_BUFFER_SRV_FLAG_NONE;
 		paletteSrvDesc.Buffer.NumElements = UINT(skeleton.joints.size());
-		paletteSrvDesc.Buffer.StructureByteStride = sizeof(WellForGPU);
+		paletteSrvDesc.Buffer.StructureByteStride = paletteStride;
 		device->CreateShaderResourceView(skinCluster.paletteResource.Get(), &paletteSrvDesc, skinCluster.paletteSrvHandle.first);
 
 		/// ===Influence用Resourceの作成=== ///
@@ -318,12 +315,11 @@ namespace MiiEngine {
 	/// SkinClusterの更新関数
 	///-------------------------------------------///
 	void AnimationModel::SkinClusterUpdate(SkinCluster& skinCluster, const Skeleton& skeleton) {
-		for (size_t jointIndex = 0; jointIndex < skeleton.joints.size(); ++jointIndex) {
-			assert(jointIndex < skinCluster.inverseBindPoseMatrices.size()); // ここで止まる
-			skinCluster.mappedPalette[jointIndex].skeletonSpaceMatrix =
-				Multiply(skinCluster.inverseBindPoseMatrices[jointIndex], skeleton.joints[jointIndex].skeletonSpaceMatrix);
-			skinCluster.mappedPalette[jointIndex].skeletonSpaceInverseTransposeMatrix =
-				Math::TransposeMatrix(Math::Inverse4x4(skinCluster.mappedPalette[jointIndex].skeletonSpaceMatrix));
+		// マップ済みのパレットに直接書き込む（GPUはフェンスで前フレームの描画完了を待っているので安全）
+		if (skinCluster.paletteFormat == SkinningPaletteFormat::Compact) {
+			AnimationPose::UpdatePalette(skinCluster.mappedCompactPalette, skinCluster.inverseBindPoseMatrices, skeleton);
+		} else {
+			AnimationPose::UpdatePalette(skinCluster.mappedPalette, skinCluster.inverseBindPoseMatrices, skeleton);
 		}
 	}
 }
@@ -24,9 +24,22 @@ namespace MiiEngine {
 
 		/// <summary>
 		/// 更新処理
+		/// Boneがある場合、ポーズの更新は要求だけ行い、AnimationManager::Update でまとめて行う
 		/// </summary>
 		void Update() override;
 
+		/// <summary>
+		/// ポーズの更新処理（時間を進めてSkeletonとMatrixPaletteを更新）
+		/// 自身のデータだけを書き換えるため、別々のインスタンスであればワーカースレッドから並列に呼び出せる
+		/// </summary>
+		void UpdatePose();
+
+		/// <summary>
+		/// ポーズの更新要求を取得してクリア（AnimationManager から呼ばれる）
+		/// </summary>
+		/// <returns>前回から Update が呼ばれていれば true</returns>
+		bool ConsumePoseRequest();
+
 		/// <summary>
 		/// 描画処理
 		/// </summary>
@@ -36,35 +49,26 @@ namespace MiiEngine {
 	public: /// ===Setter=== ///
 		// Animation
 		void SetAnimation(const std::string& animationName, bool isLoop);
+		// MatrixPaletteの形式（GPUリソースを作るため Initialize より前に設定する）
+		void SetPaletteFormat(SkinningPaletteFormat format) { paletteFormat_ = format; }
 
 	private: /// ===Variables(変数)=== ///
 
 		/// ===Animation=== ///
 		float animationTime_;
-		std::map<std::string, Animation> animation_;
+		std::string filename_;						// アニメーションデータのキー（モデルと同じ）
 		std::string animationName_;
 		Skeleton skeleton_;
 		SkinCluster skinCluster_;
+		std::shared_ptr<const AnimationClip> clip_;	// 再生中のアニメーション（Skeletonに対応付け済み。同じモデルの全インスタンスで共有）
+		std::vector<NodeAnimationCursor> cursors_;	// トラックごとの再生カーソル
 		bool isLoop_;
+		bool isRegistered_ = false;					// AnimationManager で一括更新するか
+		bool isPoseRequested_ = false;				// 今フレームに Update が呼ばれたか
+		SkinningPaletteFormat paletteFormat_ = SkinningPaletteFormat::Full; // MatrixPaletteの形式
 
 	private: /// ===Functions(関数)=== ///
 
-		/// <summary>
-		/// 任意の時刻を取得する関数(Vector3)
-		/// </summary>
-		/// <param name="keyframes">評価に使用する KeyframeVector3 の配列（const 参照）。各キーフレームの値を基に、指定時刻で補間して値を算出します。</param>
-		/// <param name="time">評価する時刻。キーフレーム間で補間する位置を指定します。</param>
-		/// <returns>指定時刻における補間された Vector3 値を返します。</returns>
-		Vector3 CalculateValue(const std::vector<KeyframeVector3>& keyframes, float time);
-
-		/// <summary>
-		/// 任意の時刻を取得する関数(Quaternion)
-		/// </summary>
-		/// <param name="keyframes">KeyframeQuaternion 型の要素からなる std::vector。各要素は時刻と対応するクォータニオン値を表します。</param>
-		/// <param name="time">評価する時刻（浮動小数点）。関数はこの時刻におけるクォータニオン値を返します。</param>
-		/// <returns>指定された時刻における（通常は補間された）Quaternion 値を返します。</returns>
-		Quaternion CalculateValue(const std::vector<KeyframeQuaternion>& keyframes, float time);
-
 		/// <summary>
 		/// Nodeの階層構造からSkeletonの生成処理
 		/// </summary>
@@ -81,13 +85,19 @@ namespace MiiEngine {
 		/// <returns>作成されたジョイントのインデックス（joints 内の位置）を示す int32_t を返します。</returns>
 		int32_t CreateJoint(const Node& node, const std::optional<int32_t>& parent, std::vector<Joint>& joints);
 
+		/// <summary>
+		/// animationName_ のアニメーションをSkeletonに対応付けたクリップを取得（見つからない場合は nullptr）
+		/// </summary>
+		void BindAnimation();
+
 		/// <summary>
 		/// Skeletonに対してAnimationの適用を行う関数
 		/// </summary>
 		/// <param name="skeleton">アニメーションを適用するSkeletonオブジェクトへの参照。関数はこのオブジェクトの状態を更新します。</param>
-		/// <param name="animation">適用するアニメーションデータへの参照（const）。アニメーション情報は変更されません。</param>
+		/// <param name="clip">適用するクリップ（skeleton に対応付け済み）。</param>
 		/// <param name="animationTime">アニメーションの適用時刻（秒）。アニメーション内のどの時点を適用するかを指定します。</param>
-		void ApplyAnimation(Skeleton& skeleton, const Animation& animation, float animationTime);
+		/// <param name="cursors">トラックごとの再生カーソル（トラックの数と同じ要素数）。</param>
+		void ApplyAnimation(Skeleton& skeleton, const AnimationClip& clip, float animationTime, std::vector<NodeAnimationCursor>& cursors);
 
 		/// <summary>
 		/// Skeletonの更新処理
@@ -101,8 +111,9 @@ namespace MiiEngine {
 		/// <param name="device">ID3D12Device への ComPtr の参照。スキン クラスター作成に使用する Direct3D12 デバイスを指定します（入力専用）。</param>
 		/// <param name="skeleton">スケルトン情報（ボーン階層、バインドポーズなど）。スキニング用の骨構造を提供します（入力専用）。</param>
 		/// <param name="modelData">モデルのジオメトリとウェイト情報を含む ModelData。メッシュ、頂点ウェイト、関連するバッファなど、クラスター生成に必要なデータを提供します（入力専用）。</param>
+		/// <param name="paletteFormat">MatrixPaletteの形式。パレット用のバッファの要素の大きさが変わります。</param>
 		/// <returns>作成された SkinCluster オブジェクト。スキニング情報および関連する GPU リソースを表します。</returns>
-		SkinCluster CreateSkinCluster(const ComPtr<ID3D12Device>& device, const Skeleton& skeleton, const ModelData& modelData);
+		SkinCluster CreateSkinCluster(const ComPtr<ID3D12Device>& device, const Skeleton& skeleton, const ModelData& modelData, SkinningPaletteFormat paletteFormat);
 
 		/// <summary>
 		/// SkinClusterの更新処理
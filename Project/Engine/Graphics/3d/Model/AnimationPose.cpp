@@ -0,0 +1,53 @@
+#include "AnimationPose.h"
+// c++
+#include <cassert>
+// Math
+#include "Math/sMath.h"
+#include "Math/MatrixMath.h"
+
+namespace MiiEngine {
+	///-------------------------------------------///
+	/// Skeletonの更新
+	///-------------------------------------------///
+	void AnimationPose::UpdateSkeleton(Skeleton& skeleton) {
+		// 全てのJointを更新。親が若いので通常ループで処理を可能にしている。
+		for (Joint& joint : skeleton.joints) {
+			joint.localMatrix = Math::MakeAffineQuaternionMatrix(joint.transform.scale, joint.transform.rotate, joint.transform.translate);
+			if (joint.parent) { // 親がいれば親の行列を掛ける
+				joint.skeletonSpaceMatrix = Multiply(joint.localMatrix, skeleton.joints[*joint.parent].skeletonSpaceMatrix);
+			} else { // 親がいないのでlocalMatrixとskeletonSpaceMatrixは一致する
+				joint.skeletonSpaceMatrix = joint.localMatrix;
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// MatrixPaletteの更新
+	///-------------------------------------------///
+	void AnimationPose::UpdatePalette(std::span<WellForGPU> palette, std::span<const Matrix4x4> inverseBindPoseMatrices, const Skeleton& skeleton) {
+		for (size_t jointIndex = 0; jointIndex < skeleton.joints.size(); ++jointIndex) {
+			assert(jointIndex < inverseBindPoseMatrices.size()); // ここで止まる
+			// 書き込み先はマップしたバッファ（書き込み結合メモリ）なので読み戻さず、ローカルで求めてから書き込む
+			const Matrix4x4 matrix = Multiply(inverseBindPoseMatrices[jointIndex], skeleton.joints[jointIndex].skeletonSpaceMatrix);
+			palette[jointIndex] = { matrix, Math::InverseTransposeAffine(matrix) };
+		}
+	}
+
+	///-------------------------------------------///
+	/// MatrixPaletteの更新（コンパクト版）
+	///-------------------------------------------///
+	void AnimationPose::UpdatePalette(std::span<WellForGPUCompact> palette, std::span<const Matrix4x4> inverseBindPoseMatrices, const Skeleton& skeleton) {
+		for (size_t jointIndex = 0; jointIndex < skeleton.joints.size(); ++jointIndex) {
+			assert(jointIndex < inverseBindPoseMatrices.size()); // ここで止まる
+			const Matrix4x4 matrix = Multiply(inverseBindPoseMatrices[jointIndex], skeleton.joints[jointIndex].skeletonSpaceMatrix);
+			// 転置した上3行をローカルで作ってから書き込む（4行目は常に (0, 0, 0, 1) なので送らない）
+			WellForGPUCompact well;
+			for (int row = 0; row < 3; ++row) {
+				for (int column = 0; column < 4; ++column) {
+					well.skeletonSpaceMatrix[row][column] = matrix.m[column][row];
+				}
+			}
+			palette[jointIndex] = well;
+		}
+	}
+}
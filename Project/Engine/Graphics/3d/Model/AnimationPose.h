@@ -0,0 +1,40 @@
+#pragma once
+/// ===Include=== ///
+// Data
+#include "Engine/DataInfo/AnimationData.h"
+// c++
+#include <span>
+
+namespace MiiEngine {
+	///=====================================================///
+	/// アニメーションのポーズ計算
+	/// Skeletonの行列とMatrixPaletteの計算をまとめたもの。
+	/// 引数で渡されたデータだけを書き換えるため、別々のインスタンスであれば並列に呼び出せる
+	///=====================================================///
+	class AnimationPose {
+	public:
+
+		/// <summary>
+		/// Skeletonの更新処理（各JointのlocalMatrixとskeletonSpaceMatrixを計算）
+		/// </summary>
+		/// <param name="skeleton">更新対象のSkeleton。親のJointが子より前に並んでいること。</param>
+		static void UpdateSkeleton(Skeleton& skeleton);
+
+		/// <summary>
+		/// MatrixPaletteの更新処理
+		/// 行列はアフィンなので、法線用の行列は左上3x3の余因子から求める（4x4の逆行列は使わない）
+		/// </summary>
+		/// <param name="palette">書き込み先（GPUにMapしたバッファでもよい）。Jointの数以上の要素数。</param>
+		/// <param name="inverseBindPoseMatrices">JointごとのInverseBindPoseMatrix。</param>
+		/// <param name="skeleton">UpdateSkeleton 済みのSkeleton。</param>
+		static void UpdatePalette(std::span<WellForGPU> palette, std::span<const Matrix4x4> inverseBindPoseMatrices, const Skeleton& skeleton);
+
+		/// <summary>
+		/// MatrixPaletteの更新処理（コンパクト版。位置用の3x4行列のみ書き込む）
+		/// </summary>
+		/// <param name="palette">書き込み先（GPUにMapしたバッファでもよい）。Jointの数以上の要素数。</param>
+		/// <param name="inverseBindPoseMatrices">JointごとのInverseBindPoseMatrix。</param>
+		/// <param name="skeleton">UpdateSkeleton 済みのSkeleton。</param>
+		static void UpdatePalette(std::span<WellForGPUCompact> palette, std::span<const Matrix4x4> inverseBindPoseMatrices, const Skeleton& skeleton);
+	};
+}
@@ -0,0 +1,124 @@
+#include "AnimationSampler.h"
+// c++
+#include <cassert>
+// Math
+#include "Math/sMath.h"
+
+namespace MiiEngine {
+	namespace {
+		// キーフレームを連続した配列の末尾に追加して、その範囲を返す
+		template<typename tValue>
+		KeyframeRange AppendKeyframes(std::vector<Keyframe<tValue>>& destination, const std::vector<Keyframe<tValue>>& keyframes) {
+			KeyframeRange range;
+			range.begin = static_cast<uint32_t>(destination.size());
+			range.count = static_cast<uint32_t>(keyframes.size());
+			destination.insert(destination.end(), keyframes.begin(), keyframes.end());
+			return range;
+		}
+
+		// 範囲のキーフレームを取得
+		template<typename tValue>
+		std::span<const Keyframe<tValue>> GetKeyframes(const std::vector<Keyframe<tValue>>& keyframes, const KeyframeRange& range) {
+			return std::span<const Keyframe<tValue>>(keyframes).subspan(range.begin, range.count);
+		}
+	}
+
+	///-------------------------------------------///
+	/// Skeletonに対応付けたクリップの作成
+	///-------------------------------------------///
+	AnimationClip AnimationSampler::CreateClip(const Animation& animation, const Skeleton& skeleton) {
+		AnimationClip clip;
+		clip.duration = animation.duration;
+
+		/// ===必要な数を数えて先に確保する=== ///
+		size_t translateCount = 0, rotateCount = 0, scaleCount = 0;
+		for (const auto& [name, nodeAnimation] : animation.nodeAnimations) {
+			translateCount += nodeAnimation.translate.keyframes.size();
+			rotateCount += nodeAnimation.rotate.keyframes.size();
+			scaleCount += nodeAnimation.scale.keyframes.size();
+		}
+		clip.translateKeys.reserve(translateCount);
+		clip.rotateKeys.reserve(rotateCount);
+		clip.scaleKeys.reserve(scaleCount);
+
+		/// ===Jointの番号順にトラックを作る（チャンネルがないJointは飛ばす）=== ///
+		for (const Joint& joint : skeleton.joints) {
+			auto it = animation.nodeAnimations.find(joint.name);
+			if (it == animation.nodeAnimations.end()) {
+				continue;
+			}
+			const NodeAnimation& nodeAnimation = it->second;
+			AnimationTrack track;
+			track.jointIndex = joint.index;
+			track.translate = AppendKeyframes(clip.translateKeys, nodeAnimation.translate.keyframes);
+			track.rotate = AppendKeyframes(clip.rotateKeys, nodeAnimation.rotate.keyframes);
+			track.scale = AppendKeyframes(clip.scaleKeys, nodeAnimation.scale.keyframes);
+			clip.tracks.push_back(track);
+		}
+		return clip;
+	}
+
+	///-------------------------------------------///
+	/// クリップのポーズをJointに適用
+	///-------------------------------------------///
+	void AnimationSampler::ApplyClip(const AnimationClip& clip, float time, std::span<NodeAnimationCursor> cursors, std::span<Joint> joints) {
+		assert(cursors.size() == clip.tracks.size());
+		for (size_t trackIndex = 0; trackIndex < clip.tracks.size(); ++trackIndex) {
+			const AnimationTrack& track = clip.tracks[trackIndex];
+			NodeAnimationCursor& cursor = cursors[trackIndex];
+			QuaternionTransform& transform = joints[track.jointIndex].transform;
+			// キーがないチャンネルはJointの値をそのまま使う
+			if (track.translate.count > 0) {
+				transform.translate = Sample(GetKeyframes(clip.translateKeys, track.translate), time, cursor.translate);
+			}
+			if (track.rotate.count > 0) {
+				transform.rotate = Sample(GetKeyframes(clip.rotateKeys, track.rotate), time, cursor.rotate);
+			}
+			if (track.scale.count > 0) {
+				transform.scale = Sample(GetKeyframes(clip.scaleKeys, track.scale), time, cursor.scale);
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// 任意の時刻の値を取得する関数(Vector3)
+	///-------------------------------------------///
+	Vector3 AnimationSampler::Sample(std::span<const KeyframeVector3> keyframes, float time, size_t& cursor) {
+		assert(!keyframes.empty()); // キーがない物は返す値がわからないのでだめ
+		if (keyframes.size() == 1 || time <= keyframes[0].time) { // キーが一つか、時刻がキーフレーム前なら最初の値とする
+			cursor = 0;
+			return keyframes[0].value;
+		}
+
+		/// ===区間を探して線形補間する(Lerp)=== ///
+		const size_t index = FindKeyframe(keyframes, time, cursor);
+		if (index + 1 >= keyframes.size()) { // 一番後の時刻よりも後ろなので最後の値を返す
+			return keyframes.back().value;
+		}
+		const KeyframeVector3& current = keyframes[index];
+		const KeyframeVector3& next = keyframes[index + 1];
+		float t = (time - current.time) / (next.time - current.time);
+		return Math::Lerp(current.value, next.value, t);
+	}
+
+	///-------------------------------------------///
+	/// 任意の時刻の値を取得する関数(Quaternion)
+	///-------------------------------------------///
+	Quaternion AnimationSampler::Sample(std::span<const KeyframeQuaternion> keyframes, float time, size_t& cursor) {
+		assert(!keyframes.empty()); // キーがない物は返す値がわからないのでだめ
+		if (keyframes.size() == 1 || time <= keyframes[0].time) { // キーが一つか、時刻がキーフレーム前なら最初の値とする
+			cursor = 0;
+			return keyframes[0].value;
+		}
+
+		/// ===区間を探して球面線形補間する(SLerp)=== ///
+		const size_t index = FindKeyframe(keyframes, time, cursor);
+		if (index + 1 >= keyframes.size()) { // 一番後の時刻よりも後ろなので最後の値を返す
+			return keyframes.back().value;
+		}
+		const KeyframeQuaternion& current = keyframes[index];
+		const KeyframeQuaternion& next = keyframes[index + 1];
+		float t = (time - current.time) / (next.time - current.time);
+		return Math::SLerp(current.value, next.value, t);
+	}
+}
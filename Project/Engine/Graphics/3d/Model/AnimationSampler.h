@@ -0,0 +1,114 @@
+#pragma once
+/// ===Include=== ///
+// Data
+#include "Engine/DataInfo/AnimationData.h"
+// c++
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace MiiEngine {
+	///=====================================================///
+	/// アニメーションのサンプラー
+	/// チャンネルごとのカーソル（前回のキーの番号）を使い、順再生では数キー分だけ進めて区間を探す。
+	/// 時刻が戻った場合（ループ・シーク）や大きく飛んだ場合は二分探索に切り替える
+	///=====================================================///
+	class AnimationSampler {
+	public:
+
+		/// <summary>
+		/// アニメーションをSkeletonに対応付けたクリップを作成（Joint名の検索はここで1回だけ行う）
+		/// </summary>
+		/// <param name="animation">対応付けるアニメーション</param>
+		/// <param name="skeleton">対象のSkeleton</param>
+		/// <returns>Jointの番号順のトラックと、連続したキーフレーム配列を持つクリップ</returns>
+		static AnimationClip CreateClip(const Animation& animation, const Skeleton& skeleton);
+
+		/// <summary>
+		/// クリップの任意の時刻のポーズをJointに適用
+		/// </summary>
+		/// <param name="clip">CreateClip で作成したクリップ</param>
+		/// <param name="time">評価する時刻</param>
+		/// <param name="cursors">トラックごとの再生カーソル（トラックの数と同じ要素数）</param>
+		/// <param name="joints">適用先のJoint配列（クリップを作成したSkeletonのもの）</param>
+		static void ApplyClip(const AnimationClip& clip, float time, std::span<NodeAnimationCursor> cursors, std::span<Joint> joints);
+
+		/// <summary>
+		/// 任意の時刻の値を取得する(Vector3)
+		/// </summary>
+		/// <param name="keyframes">評価に使用するキーフレームの配列（時刻の昇順）</param>
+		/// <param name="time">評価する時刻</param>
+		/// <param name="cursor">チャンネルのカーソル。探索した区間の先頭のキーの番号に更新されます</param>
+		/// <returns>指定時刻における線形補間された値</returns>
+		static Vector3 Sample(std::span<const KeyframeVector3> keyframes, float time, size_t& cursor);
+
+		/// <summary>
+		/// 任意の時刻の値を取得する(Quaternion)
+		/// </summary>
+		/// <param name="keyframes">評価に使用するキーフレームの配列（時刻の昇順）</param>
+		/// <param name="time">評価する時刻</param>
+		/// <param name="cursor">チャンネルのカーソル。探索した区間の先頭のキーの番号に更新されます</param>
+		/// <returns>指定時刻における球面線形補間された値</returns>
+		static Quaternion Sample(std::span<const KeyframeQuaternion> keyframes, float time, size_t& cursor);
+
+		/// <summary>
+		/// 時刻を含む区間の先頭のキーの番号を探す（time より前の時刻を持つ最後のキー）
+		/// </summary>
+		/// <param name="keyframes">キーフレームの配列（空でないこと）</param>
+		/// <param name="time">探す時刻</param>
+		/// <param name="cursor">前回の探索結果。今回の結果に更新されます</param>
+		/// <returns>区間の先頭のキーの番号（最初のキーより前なら 0、最後のキー以降なら最後の番号）</returns>
+		template<typename tValue>
+		static size_t FindKeyframe(std::span<const Keyframe<tValue>> keyframes, float time, size_t& cursor);
+
+	private:
+
+		// 順再生で線形に進める最大のキー数（これを超えたら二分探索）
+		static constexpr uint32_t kMaxCursorSteps = 4;
+
+		/// <summary>
+		/// first 以降を二分探索
+		/// </summary>
+		template<typename tValue>
+		static size_t Search(std::span<const Keyframe<tValue>> keyframes, float time, size_t first);
+	};
+
+	///-------------------------------------------///
+	/// 区間の探索
+	///-------------------------------------------///
+	template<typename tValue>
+	inline size_t AnimationSampler::FindKeyframe(std::span<const Keyframe<tValue>> keyframes, float time, size_t& cursor) {
+		const size_t lastIndex = keyframes.size() - 1;
+
+		/// ===カーソルより前に戻った（ループ・シーク）場合は先頭から二分探索=== ///
+		if (cursor > lastIndex || time <= keyframes[cursor].time) {
+			cursor = Search(keyframes, time, 0);
+			return cursor;
+		}
+
+		/// ===順再生は数キー分だけ進める=== ///
+		for (uint32_t step = 0; step < kMaxCursorSteps; ++step) {
+			if (cursor == lastIndex || time <= keyframes[cursor + 1].time) {
+				return cursor;
+			}
+			++cursor;
+		}
+
+		/// ===大きく飛んだ場合は残りを二分探索=== ///
+		cursor = Search(keyframes, time, cursor);
+		return cursor;
+	}
+
+	///-------------------------------------------///
+	/// 二分探索
+	///-------------------------------------------///
+	template<typename tValue>
+	inline size_t AnimationSampler::Search(std::span<const Keyframe<tValue>> keyframes, float time, size_t first) {
+		// time 以降の最初のキーを探し、その1つ前を区間の先頭とする（同じ時刻のキーが並ぶ場合は最初のキーの値になる）
+		auto it = std::lower_bound(keyframes.begin() + first, keyframes.end(), time,
+			[](const Keyframe<tValue>& keyframe, float value) { return keyframe.time < value; });
+		const size_t index = static_cast<size_t>(it - keyframes.begin());
+		return index > 0 ? index - 1 : 0;
+	}
+}
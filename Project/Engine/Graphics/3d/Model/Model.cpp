@@ -59,6 +59,6 @@ namespace MiiEngine {
 		ModelCommon::Bind(commandList);
 
 		// 描画（Drawコール）
-		commandList->DrawIndexedInstanced(UINT(modelData_.indices.size()), 1, 0, 0, 0);
+		commandList->DrawIndexedInstanced(UINT(modelData_->indices.size()), 1, 0, 0, 0);
 	}
 }
\ No newline at end of file
@@ -225,23 +225,23 @@ namespace MiiEngine {
 
 		/// ===vertex=== ///
 		// Buffer
-		vertex_->Create(device, sizeof(VertexData3D) * modelData_.vertices.size());
+		vertex_->Create(device, sizeof(VertexData3D) * modelData_->vertices.size());
 		vertex_->GetBuffer()->Map(0, nullptr, reinterpret_cast<void**>(&vertexData_));
 		// メモリコピー
-		std::memcpy(vertexData_, modelData_.vertices.data(), sizeof(VertexData3D) * modelData_.vertices.size());
+		std::memcpy(vertexData_, modelData_->vertices.data(), sizeof(VertexData3D) * modelData_->vertices.size());
 		// view
 		vertexBufferView_.BufferLocation = vertex_->GetBuffer()->GetGPUVirtualAddress();
-		vertexBufferView_.SizeInBytes = UINT(sizeof(VertexData3D) * modelData_.vertices.size());
+		vertexBufferView_.SizeInBytes = UINT(sizeof(VertexData3D) * modelData_->vertices.size());
 		vertexBufferView_.StrideInBytes = sizeof(VertexData3D);
 
 		/// ===index=== ///
-		index_->Create(device, sizeof(uint32_t) * modelData_.indices.size());
+		index_->Create(device, sizeof(uint32_t) * modelData_->indices.size());
 		index_->GetBuffer()->Map(0, nullptr, reinterpret_cast<void**>(&indexData_));
 		// メモリコピー
-		std::memcpy(indexData_, modelData_.indices.data(), sizeof(uint32_t) * modelData_.indices.size());
+		std::memcpy(indexData_, modelData_->indices.data(), sizeof(uint32_t) * modelData_->indices.size());
 		// view
 		indexBufferView_.BufferLocation = index_->GetBuffer()->GetGPUVirtualAddress();
-		indexBufferView_.SizeInBytes = UINT(sizeof(uint32_t) * modelData_.indices.size());
+		indexBufferView_.SizeInBytes = UINT(sizeof(uint32_t) * modelData_->indices.size());
 		indexBufferView_.Format = DXGI_FORMAT_R32_UINT;
 
 		/// ===Common=== ///
@@ -258,7 +258,7 @@ namespace MiiEngine {
 		common_->Bind(commandList);
 
 		// テクスチャの設定
-		Service::Render::SetGraphicsRootDescriptorTable(commandList, 2, modelData_.material.textureFilePath);
+		Service::Render::SetGraphicsRootDescriptorTable(commandList, 2, modelData_->material.textureFilePath);
 		Service::Render::SetGraphicsRootDescriptorTable(commandList, 3, environmentMapInfo_.textureName);
 	}
 
@@ -311,7 +311,7 @@ namespace MiiEngine {
 		/// ===値の代入=== ///
 		common_->SetTransformData(
 			worldViewProjectionMatrix,
-			Multiply(modelData_.rootNode.localMatrix, worldMatrix_),
+			Multiply(modelData_->rootNode.localMatrix, worldMatrix_),
 			Math::Inverse4x4(worldMatrix_)
 		);
 
@@ -103,7 +103,7 @@ namespace MiiEngine {
 		uint32_t* indexData_ = nullptr;
 
 		/// ===モデル情報=== ///
-		ModelData modelData_;
+		std::shared_ptr<const ModelData> modelData_; // ModelManagerのデータを共有（変更不可）
 		EulerTransform uvTransform_;
 		QuaternionTransform worldTransform_;
 		Vector4 color_;
@@ -0,0 +1,591 @@
+#include "ParticleBenchmark.h"
+#include "ParticleGroup.h"
+#include "ParticleFactory.h"
+#include "ParticleKernel.h"
+#include "ParticleRandom.h"
+// c++
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <new>
+#include <random>
+
+///-------------------------------------------///
+/// 確保回数の計測（計測中のスレッドだけ数える）
+/// operator new の置き換えは実行ファイル全体に効くため、
+/// PARTICLE_BENCHMARK_COUNT_ALLOCATIONS を定義した計測用の構成（Profile: Release と同じ最適化）でだけ行う
+///-------------------------------------------///
+namespace {
+    thread_local uint64_t* gAllocationCounter = nullptr;
+}
+#ifdef PARTICLE_BENCHMARK_COUNT_ALLOCATIONS
+void* operator new(std::size_t size) {
+    if (gAllocationCounter) {
+        ++*gAllocationCounter;
+    }
+    if (size == 0) {
+        size = 1;
+    }
+    while (true) {
+        if (void* p = std::malloc(size)) {
+            return p;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+#endif // PARTICLE_BENCHMARK_COUNT_ALLOCATIONS
+
+namespace MiiEngine {
+    namespace {
+        // 確保回数を数える範囲
+        class AllocationScope {
+        public:
+            explicit AllocationScope(uint64_t& counter) : previous_(gAllocationCounter) { gAllocationCounter = &counter; }
+            ~AllocationScope() { gAllocationCounter = previous_; }
+        private:
+            uint64_t* previous_;
+        };
+
+        // コマンドラインから "key=値" の値を取得（見つからない場合は空）
+        std::string FindOption(const std::string& commandLine, const std::string& key) {
+            const std::string prefix = key + "=";
+            const size_t begin = commandLine.find(prefix);
+            if (begin == std::string::npos) {
+                return {};
+            }
+            const size_t valueBegin = begin + prefix.size();
+            const size_t valueEnd = commandLine.find(' ', valueBegin);
+            return commandLine.substr(valueBegin, valueEnd == std::string::npos ? std::string::npos : valueEnd - valueBegin);
+        }
+
+        // 確保回数を数えているか（数えていない構成では allocationCount は常に 0）
+#ifdef PARTICLE_BENCHMARK_COUNT_ALLOCATIONS
+        constexpr bool kIsAllocationCounting = true;
+#else
+        constexpr bool kIsAllocationCounting = false;
+#endif
+
+        // 格納方法の比較に使う定義
+        ParticleDefinition MakeLayoutDefinition(uint32_t particleCount) {
+            ParticleDefinition definition;
+            definition.maxInstance = particleCount;
+            definition.physics.gravity = -9.8f;
+            definition.appearance.useColorGradient = true;
+            definition.appearance.useScaleAnimation = true;
+            definition.emission.lifetimeMin = 0.5f;
+            definition.emission.lifetimeMax = 2.0f;
+            definition.advanced.motion.enableBillboardRotation = true;
+            return definition;
+        }
+
+        // プール化前の ParticleFactory::UpdateParticle と ParticleGroup::UpdateParticles の手順で1パーティクルを進める
+        // （渦巻き・回転影響・パーティクルごとの回転は積分処理の外で行うため含めない）
+        void UpdateParticleData(ParticleData& particle, const ParticleDefinition& definition, float deltaTime, const Vector3& emitterDelta) {
+            const ParticleMotionSettings& motion = definition.advanced.motion;
+
+            // 重力・加速度・位置
+            if (definition.physics.gravity != 0.0f) {
+                particle.velocity.y += definition.physics.gravity * deltaTime;
+            }
+            particle.velocity += definition.physics.acceleration * deltaTime;
+            particle.transform.translate += particle.velocity * deltaTime;
+
+            // 時間と寿命に応じた補間
+            particle.currentTime += deltaTime;
+            const float t = particle.currentTime / particle.lifeTime;
+            if (definition.appearance.useColorGradient) {
+                Vector4 startColor = definition.appearance.startColor;
+                Vector4 endColor = definition.appearance.endColor;
+                particle.color = startColor + (endColor - startColor) * t;
+            }
+            if (definition.appearance.useScaleAnimation) {
+                const Vector3 startScale = (definition.appearance.startScaleMin + definition.appearance.startScaleMax) * 0.5f;
+                particle.transform.scale = startScale + (definition.appearance.endScale - startScale) * t;
+            }
+
+            // エミッタ追従・速度減衰・ビルボード回転
+            if (motion.followEmitter) {
+                particle.transform.translate += emitterDelta * motion.followStrength;
+            }
+            if (motion.velocityDamping < 1.0f) {
+                particle.velocity = particle.velocity * motion.velocityDamping;
+            }
+            if (motion.enableBillboardRotation) {
+                particle.transform.rotate.z += motion.billboardRotationSpeed * deltaTime;
+            }
+        }
+
+        // プール化前の ParticleGroup::UpdateParticles と同じ手順で std::list<ParticleData> を1フレーム進める
+        void UpdateParticleList(std::list<ParticleData>& particles, const ParticleDefinition& definition, float deltaTime, std::vector<ParticleForGPU>& instances) {
+            const Vector3 emitterDelta = { 0.0f, 0.0f, 0.0f };
+
+            uint32_t numInstance = 0;
+            for (auto it = particles.begin(); it != particles.end();) {
+                // 寿命チェック
+                if (it->currentTime >= it->lifeTime) {
+                    it = particles.erase(it);
+                    continue;
+                }
+
+                UpdateParticleData(*it, definition, deltaTime, emitterDelta);
+
+                // インスタンシングデータの書き込み
+                if (numInstance < instances.size()) {
+                    ParticleForGPU& instance = instances[numInstance++];
+                    instance.translate = { it->transform.translate.x, it->transform.translate.y, it->transform.translate.z, 0.0f };
+                    instance.rotate = { it->transform.rotate.x, it->transform.rotate.y, it->transform.rotate.z, 0.0f };
+                    instance.scale = { it->transform.scale.x, it->transform.scale.y, it->transform.scale.z, 0.0f };
+                    instance.color = it->color;
+                }
+                ++it;
+            }
+        }
+
+        // 照合用に乱数でパーティクルを作成
+        std::vector<ParticleData> MakeRandomParticles(std::mt19937& engine, uint32_t count) {
+            std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+            std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+            std::uniform_real_distribution<float> lifeTime(0.1f, 3.0f);
+            // 一部が寿命切れになるよう、経過時間は寿命の最大値より長くまで取る
+            std::uniform_real_distribution<float> currentTime(0.0f, 3.5f);
+
+            std::vector<ParticleData> particles(count);
+            for (ParticleData& particle : particles) {
+                particle.transform.translate = { value(engine), value(engine), value(engine) };
+                particle.transform.rotate = { value(engine), value(engine), value(engine) };
+                particle.transform.scale = { value(engine), value(engine), value(engine) };
+                particle.velocity = { value(engine), value(engine), value(engine) };
+                particle.color = { unit(engine), unit(engine), unit(engine), unit(engine) };
+                particle.lifeTime = lifeTime(engine);
+                particle.currentTime = currentTime(engine);
+            }
+            return particles;
+        }
+
+        // パーティクルを同じ順でプールに詰める
+        void StoreParticles(const std::vector<ParticleData>& particles, ParticlePool& pool) {
+            const uint32_t count = static_cast<uint32_t>(particles.size());
+            pool.Initialize(count);
+            pool.Append(count);
+            ParticlePool::Channels& c = pool.GetChannels();
+            for (uint32_t i = 0; i < count; ++i) {
+                const ParticleData& particle = particles[i];
+                c.translate[0][i] = particle.transform.translate.x; c.translate[1][i] = particle.transform.translate.y; c.translate[2][i] = particle.transform.translate.z;
+                c.rotate[0][i] = particle.transform.rotate.x; c.rotate[1][i] = particle.transform.rotate.y; c.rotate[2][i] = particle.transform.rotate.z;
+                c.scale[0][i] = particle.transform.scale.x; c.scale[1][i] = particle.transform.scale.y; c.scale[2][i] = particle.transform.scale.z;
+                c.velocity[0][i] = particle.velocity.x; c.velocity[1][i] = particle.velocity.y; c.velocity[2][i] = particle.velocity.z;
+                c.color[0][i] = particle.color.x; c.color[1][i] = particle.color.y; c.color[2][i] = particle.color.z; c.color[3][i] = particle.color.w;
+                c.lifeTime[i] = particle.lifeTime;
+                c.currentTime[i] = particle.currentTime;
+            }
+        }
+
+        // 照合用に、指定した処理だけが有効になる定義を乱数で作成
+        ParticleDefinition MakeRandomDefinition(std::mt19937& engine, uint32_t features) {
+            std::uniform_real_distribution<float> signedUnit(-1.0f, 1.0f);
+            std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+            ParticleDefinition definition;
+            // 重力は 0 の場合（加算しない分岐）も通す
+            definition.physics.gravity = unit(engine) < 0.25f ? 0.0f : signedUnit(engine) * 10.0f;
+            definition.physics.acceleration = { signedUnit(engine), signedUnit(engine), signedUnit(engine) };
+
+            ParticleAppearanceSettings& appearance = definition.appearance;
+            appearance.useColorGradient = (features & ParticleKernel::kColorGradient) != 0;
+            appearance.startColor = { unit(engine), unit(engine), unit(engine), unit(engine) };
+            appearance.endColor = { unit(engine), unit(engine), unit(engine), unit(engine) };
+            appearance.useScaleAnimation = (features & ParticleKernel::kScaleAnimation) != 0;
+            appearance.startScaleMin = { unit(engine), unit(engine), unit(engine) };
+            appearance.startScaleMax = appearance.startScaleMin + Vector3{ unit(engine), unit(engine), unit(engine) };
+            appearance.endScale = { unit(engine) * 2.0f, unit(engine) * 2.0f, unit(engine) * 2.0f };
+
+            ParticleMotionSettings& motion = definition.advanced.motion;
+            motion.followEmitter = (features & ParticleKernel::kFollowEmitter) != 0;
+            motion.followStrength = unit(engine);
+            motion.velocityDamping = (features & ParticleKernel::kVelocityDamping) != 0 ? 0.8f + unit(engine) * 0.19f : 1.0f;
+            motion.enableBillboardRotation = (features & ParticleKernel::kBillboardRotation) != 0;
+            motion.billboardRotationSpeed = signedUnit(engine) * 6.0f;
+            return definition;
+        }
+
+        // 1つの値の誤差を更新
+        void AccumulateError(float expected, float actual, ParticleKernelCheckResult& result) {
+            const float error = std::fabs(expected - actual);
+            result.maxAbsoluteError = (std::max)(result.maxAbsoluteError, error);
+            result.maxRelativeError = (std::max)(result.maxRelativeError, error / (std::max)(1.0f, std::fabs(expected)));
+        }
+
+        // 命令セットの名前
+        const char* ToString(ParticleKernel::InstructionSet set) {
+            switch (set) {
+            case ParticleKernel::InstructionSet::AVX2: return "AVX2";
+            case ParticleKernel::InstructionSet::SSE: return "SSE";
+            default: return "Scalar";
+            }
+        }
+    }
+
+    ///-------------------------------------------///
+    /// 1つの定義を計測
+    ///-------------------------------------------///
+    ParticleBenchmarkResult ParticleBenchmark::Run(const std::string& name, const ParticleDefinition& definition, const ParticleBenchmarkSettings& settings) {
+        using Clock = std::chrono::steady_clock;
+
+        ParticleBenchmarkResult result;
+        result.name = name;
+        result.frameCount = static_cast<uint32_t>(std::ceil(settings.duration / settings.deltaTime));
+
+        // 最初の初期化（バッファの確保）は計測しない
+        ParticleGroup group;
+        uint64_t seed = settings.seed;
+        group.InitializeHeadless({ settings.orbitRadius, 0.0f, 0.0f }, definition, seed);
+
+        Clock::duration updateTime{};
+        {
+            AllocationScope scope(result.allocationCount);
+            for (uint32_t frame = 0; frame < result.frameCount; ++frame) {
+                // エミッタを円周上で動かす
+                const float time = static_cast<float>(frame) * settings.deltaTime;
+                const float angle = time * settings.orbitSpeed;
+                const Vector3 position = { std::cos(angle) * settings.orbitRadius, 0.0f, std::sin(angle) * settings.orbitRadius };
+                group.SetEmitterPosition(position);
+
+                // 更新（発生・積分・寿命・インスタンシングデータの書き込み）
+                const Clock::time_point start = Clock::now();
+                group.Update(settings.deltaTime);
+                updateTime += Clock::now() - start;
+
+                const uint32_t alive = group.GetActiveParticleCount();
+                result.particleUpdates += alive;
+                result.peakLiveCount = (std::max)(result.peakLiveCount, alive);
+
+                // 終了したバーストは次のシードで発生し直す
+                if (group.IsFinish()) {
+                    group.InitializeHeadless(position, definition, ++seed);
+                    ++result.restartCount;
+                }
+            }
+        }
+
+        result.updateMilliseconds = std::chrono::duration<double, std::milli>(updateTime).count();
+        if (result.particleUpdates > 0) {
+            result.nsPerParticleUpdate = std::chrono::duration<double, std::nano>(updateTime).count() / static_cast<double>(result.particleUpdates);
+        }
+        if (result.frameCount > 0) {
+            result.allocationsPerFrame = static_cast<double>(result.allocationCount) / static_cast<double>(result.frameCount);
+        }
+        return result;
+    }
+
+    ///-------------------------------------------///
+    /// ディレクトリ内の定義を計測
+    ///-------------------------------------------///
+    std::vector<ParticleBenchmarkResult> ParticleBenchmark::RunDirectory(const std::string& directory, const ParticleBenchmarkSettings& settings) {
+        std::vector<ParticleBenchmarkResult> results;
+
+        // 名前順に並べて、毎回同じ順番で計測する
+        std::vector<std::filesystem::path> paths;
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".json") {
+                paths.push_back(entry.path());
+            }
+        }
+        std::sort(paths.begin(), paths.end());
+
+        for (const std::filesystem::path& path : paths) {
+            try {
+                std::ifstream file(path);
+                nlohmann::json json;
+                file >> json;
+                const ParticleDefinition definition = ParticleDefinition::FromJson(json);
+                results.push_back(Run(path.stem().string(), definition, settings));
+            } catch (const std::exception&) {
+                // 定義として読めないファイルは飛ばす
+                continue;
+            }
+        }
+        return results;
+    }
+
+    ///-------------------------------------------///
+    /// 格納方法の比較
+    ///-------------------------------------------///
+    ParticleLayoutResult ParticleBenchmark::RunLayoutComparison(const ParticleBenchmarkSettings& settings) {
+        using Clock = std::chrono::steady_clock;
+
+        ParticleLayoutResult result;
+        result.particleCount = settings.layoutParticleCount;
+        result.frameCount = settings.layoutFrameCount;
+        const ParticleDefinition definition = MakeLayoutDefinition(settings.layoutParticleCount);
+        const Vector3 origin = { 0.0f, 0.0f, 0.0f };
+        std::vector<ParticleForGPU> instances(settings.layoutParticleCount);
+
+        /// ===std::list<ParticleData>（プール化前）=== ///
+        {
+            ParticleRandom random;
+            random.Seed(settings.seed);
+            std::list<ParticleData> particles;
+            for (uint32_t i = 0; i < settings.layoutParticleCount; ++i) {
+                particles.push_back(ParticleFactory::CreateParticle(definition, random, origin));
+            }
+
+            const Clock::time_point start = Clock::now();
+            for (uint32_t frame = 0; frame < settings.layoutFrameCount; ++frame) {
+                UpdateParticleList(particles, definition, settings.deltaTime, instances);
+                // 寿命が尽きた分を発生し直す
+                while (particles.size() < settings.layoutParticleCount) {
+                    particles.push_back(ParticleFactory::CreateParticle(definition, random, origin));
+                    ++result.listRespawnCount;
+                }
+            }
+            result.listMsPerFrame = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        /// ===ParticlePool=== ///
+        {
+            ParticleRandom random;
+            random.Seed(settings.seed);
+            ParticlePool pool;
+            pool.Initialize(settings.layoutParticleCount);
+            ParticleFactory::CreateParticleBurst(definition, random, origin, settings.layoutParticleCount, pool);
+
+            const ParticleKernel::InstructionSet set = ParticleKernel::GetBestInstructionSet();
+            const Clock::time_point start = Clock::now();
+            for (uint32_t frame = 0; frame < settings.layoutFrameCount; ++frame) {
+                // ParticleGroup::UpdateParticles と同じ手順
+                pool.RemoveExpired();
+                ParticleFactory::UpdateParticles(pool, definition, settings.deltaTime, origin, random);
+                ParticleKernel::WriteInstances(pool.GetChannels(), pool.GetCount(), instances.data(), set);
+                // 寿命が尽きた分を発生し直す
+                result.poolRespawnCount += ParticleFactory::CreateParticleBurst(
+                    definition, random, origin, settings.layoutParticleCount - pool.GetCount(), pool);
+            }
+            result.poolMsPerFrame = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        if (result.frameCount > 0) {
+            result.listMsPerFrame /= static_cast<double>(result.frameCount);
+            result.poolMsPerFrame /= static_cast<double>(result.frameCount);
+        }
+        return result;
+    }
+
+    ///-------------------------------------------///
+    /// 積分処理の照合
+    ///-------------------------------------------///
+    std::vector<ParticleKernelCheckResult> ParticleBenchmark::RunKernelCheck(const ParticleBenchmarkSettings& settings) {
+        using ParticleKernel::InstructionSet;
+
+        std::vector<InstructionSet> sets = { InstructionSet::Scalar, InstructionSet::SSE };
+        if (ParticleKernel::GetBestInstructionSet() == InstructionSet::AVX2) {
+            sets.push_back(InstructionSet::AVX2);
+        }
+
+        std::vector<ParticleKernelCheckResult> results;
+        for (InstructionSet set : sets) {
+            ParticleKernelCheckResult result;
+            result.instructionSet = ToString(set);
+
+            // 命令セットごとに同じ入力で照合する
+            std::mt19937 engine(static_cast<uint32_t>(settings.seed));
+            std::uniform_real_distribution<float> signedUnit(-1.0f, 1.0f);
+            std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+            // 8レーンの端数も全て通るよう、1〜67個の範囲で変える
+            std::uniform_int_distribution<uint32_t> countDistribution(1, 67);
+            std::vector<ParticleForGPU> expectedInstances;
+            std::vector<ParticleForGPU> actualInstances;
+
+            for (uint32_t round = 0; round < settings.kernelCheckRounds; ++round) {
+                for (uint32_t features = 0; features < ParticleKernel::kVariantCount; ++features) {
+                    const uint32_t count = countDistribution(engine);
+                    const ParticleDefinition definition = MakeRandomDefinition(engine, features);
+                    const float deltaTime = 0.001f + unit(engine) * 0.05f;
+                    const Vector3 emitterDelta = { signedUnit(engine), signedUnit(engine), signedUnit(engine) };
+                    std::vector<ParticleData> expected = MakeRandomParticles(engine, count);
+                    ParticlePool actual;
+                    StoreParticles(expected, actual);
+
+                    /// ===Integrate（プール化前の1パーティクルずつの更新と比べる）=== ///
+                    for (ParticleData& particle : expected) {
+                        UpdateParticleData(particle, definition, deltaTime, emitterDelta);
+                    }
+                    ParticleKernel::Integrate(actual, ParticleKernel::BuildFeatures(definition),
+                        ParticleKernel::BuildParams(definition, deltaTime, emitterDelta), set);
+                    const ParticlePool::Channels& a = actual.GetChannels();
+                    for (uint32_t i = 0; i < count; ++i) {
+                        const ParticleData& e = expected[i];
+                        const float values[] = {
+                            e.transform.translate.x, e.transform.translate.y, e.transform.translate.z,
+                            e.transform.rotate.x, e.transform.rotate.y, e.transform.rotate.z,
+                            e.transform.scale.x, e.transform.scale.y, e.transform.scale.z,
+                            e.velocity.x, e.velocity.y, e.velocity.z,
+                        };
+                        for (int axis = 0; axis < 3; ++axis) {
+                            AccumulateError(values[axis], a.translate[axis][i], result);
+                            AccumulateError(values[3 + axis], a.rotate[axis][i], result);
+                            AccumulateError(values[6 + axis], a.scale[axis][i], result);
+                            AccumulateError(values[9 + axis], a.velocity[axis][i], result);
+                        }
+                        const float color[4] = { e.color.x, e.color.y, e.color.z, e.color.w };
+                        for (int k = 0; k < 4; ++k) {
+                            AccumulateError(color[k], a.color[k][i], result);
+                        }
+                        AccumulateError(e.currentTime, a.currentTime[i], result);
+                    }
+
+                    /// ===FindExpired（先頭と途中から、1つずつ調べた結果と比べる）=== ///
+                    for (uint32_t begin : { 0u, count / 2 }) {
+                        uint32_t expectedIndex = begin;
+                        while (expectedIndex < count && a.currentTime[expectedIndex] < a.lifeTime[expectedIndex]) {
+                            ++expectedIndex;
+                        }
+                        if (ParticleKernel::FindExpired(a, begin, count, set) != expectedIndex) {
+                            ++result.expiredMismatches;
+                        }
+                    }
+
+                    /// ===WriteInstances（1つずつ書き込んだ結果と完全に一致する）=== ///
+                    expectedInstances.assign(count, ParticleForGPU{});
+                    actualInstances.assign(count, ParticleForGPU{});
+                    for (uint32_t i = 0; i < count; ++i) {
+                        ParticleForGPU& instance = expectedInstances[i];
+                        instance.translate = { a.translate[0][i], a.translate[1][i], a.translate[2][i], 0.0f };
+                        instance.rotate = { a.rotate[0][i], a.rotate[1][i], a.rotate[2][i], 0.0f };
+                        instance.scale = { a.scale[0][i], a.scale[1][i], a.scale[2][i], 0.0f };
+                        instance.color = { a.color[0][i], a.color[1][i], a.color[2][i], a.color[3][i] };
+                    }
+                    ParticleKernel::WriteInstances(a, count, actualInstances.data(), set);
+                    for (uint32_t i = 0; i < count; ++i) {
+                        if (std::memcmp(&expectedInstances[i], &actualInstances[i], sizeof(ParticleForGPU)) != 0) {
+                            ++result.instanceMismatches;
+                        }
+                    }
+
+                    ++result.caseCount;
+                    result.particleCount += count;
+                }
+            }
+
+            result.isPassed = result.maxRelativeError <= kKernelTolerance && result.expiredMismatches == 0 && result.instanceMismatches == 0;
+            results.push_back(result);
+        }
+        return results;
+    }
+
+    ///-------------------------------------------///
+    /// JSONに変換
+    ///-------------------------------------------///
+    nlohmann::json ParticleBenchmark::ToJson(const std::vector<ParticleBenchmarkResult>& results, const ParticleLayoutResult& layout,
+        const std::vector<ParticleKernelCheckResult>& kernelChecks, const ParticleBenchmarkSettings& settings) {
+        nlohmann::json json;
+        json["settings"] = {
+            {"duration", settings.duration},
+            {"deltaTime", settings.deltaTime},
+            {"seed", settings.seed},
+            {"orbitRadius", settings.orbitRadius},
+            {"orbitSpeed", settings.orbitSpeed},
+            {"layoutParticleCount", settings.layoutParticleCount},
+            {"layoutFrameCount", settings.layoutFrameCount},
+            {"kernelCheckRounds", settings.kernelCheckRounds},
+            {"kernelTolerance", kKernelTolerance},
+            {"allocationCounting", kIsAllocationCounting}
+        };
+        json["instructionSet"] = ToString(ParticleKernel::GetBestInstructionSet());
+
+        nlohmann::json entries = nlohmann::json::array();
+        for (const ParticleBenchmarkResult& result : results) {
+            entries.push_back({
+                {"name", result.name},
+                {"frameCount", result.frameCount},
+                {"restartCount", result.restartCount},
+                {"particleUpdates", result.particleUpdates},
+                {"peakLiveCount", result.peakLiveCount},
+                {"updateMilliseconds", result.updateMilliseconds},
+                {"nsPerParticleUpdate", result.nsPerParticleUpdate},
+                {"allocationCount", result.allocationCount},
+                {"allocationsPerFrame", result.allocationsPerFrame}
+            });
+        }
+        json["results"] = entries;
+
+        json["layoutComparison"] = {
+            {"particleCount", layout.particleCount},
+            {"frameCount", layout.frameCount},
+            {"listMsPerFrame", layout.listMsPerFrame},
+            {"poolMsPerFrame", layout.poolMsPerFrame},
+            {"listRespawnCount", layout.listRespawnCount},
+            {"poolRespawnCount", layout.poolRespawnCount}
+        };
+
+        nlohmann::json checks = nlohmann::json::array();
+        for (const ParticleKernelCheckResult& check : kernelChecks) {
+            checks.push_back({
+                {"instructionSet", check.instructionSet},
+                {"caseCount", check.caseCount},
+                {"particleCount", check.particleCount},
+                {"maxAbsoluteError", check.maxAbsoluteError},
+                {"maxRelativeError", check.maxRelativeError},
+                {"expiredMismatches", check.expiredMismatches},
+                {"instanceMismatches", check.instanceMismatches},
+                {"isPassed", check.isPassed}
+            });
+        }
+        json["kernelCheck"] = checks;
+        return json;
+    }
+
+    ///-------------------------------------------///
+    /// コマンドラインから実行
+    ///-------------------------------------------///
+    int ParticleBenchmark::RunFromCommandLine(const std::string& commandLine) {
+        ParticleBenchmarkSettings settings;
+        std::string outputPath = kDefaultOutputPath;
+
+        /// ===引数の読み取り=== ///
+        if (const std::string value = FindOption(commandLine, "--particle-benchmark-out"); !value.empty()) {
+            outputPath = value;
+        }
+        if (const std::string value = FindOption(commandLine, "--particle-benchmark-duration"); !value.empty()) {
+            settings.duration = std::strtof(value.c_str(), nullptr);
+        }
+        if (const std::string value = FindOption(commandLine, "--particle-benchmark-seed"); !value.empty()) {
+            settings.seed = std::strtoull(value.c_str(), nullptr, 10);
+        }
+        if (const std::string value = FindOption(commandLine, "--particle-benchmark-layout-count"); !value.empty()) {
+            settings.layoutParticleCount = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        }
+        if (settings.duration <= 0.0f || settings.layoutParticleCount == 0) {
+            return 1;
+        }
+
+        /// ===計測して書き込み=== ///
+        const std::vector<ParticleBenchmarkResult> results = RunDirectory(kDefaultDirectory, settings);
+        const ParticleLayoutResult layout = RunLayoutComparison(settings);
+        const std::vector<ParticleKernelCheckResult> kernelChecks = RunKernelCheck(settings);
+        std::ofstream file(outputPath);
+        if (!file.is_open()) {
+            return 1;
+        }
+        file << ToJson(results, layout, kernelChecks, settings).dump(4);
+
+        // 積分処理の結果がプール化前の更新と一致しない場合は失敗
+        for (const ParticleKernelCheckResult& check : kernelChecks) {
+            if (!check.isPassed) {
+                return 1;
+            }
+        }
+        return results.empty() ? 1 : 0;
+    }
+}
@@ -0,0 +1,139 @@
+#pragma once
+/// ===Include=== ///
+#include "ParticleDefinition.h"
+// c++
+#include <cstdint>
+#include <string>
+#include <vector>
+// JSON
+#include <json.hpp>
+
+namespace MiiEngine {
+    ///=====================================================///
+    /// ベンチマークの設定
+    ///=====================================================///
+    struct ParticleBenchmarkSettings {
+        float duration = 10.0f;            // 1定義あたりのシミュレーション時間（秒）
+        float deltaTime = 1.0f / 60.0f;    // 固定デルタタイム
+        uint64_t seed = 1;                 // 乱数のシード（同じ値なら同じ発生になる）
+        float orbitRadius = 2.0f;          // エミッタを回す半径（軌跡パーティクルは移動しないと発生しないため）
+        float orbitSpeed = 6.2831853f;     // エミッタを回す角速度（rad/s）
+        uint32_t layoutParticleCount = 10000; // 格納方法の比較で維持するパーティクル数
+        uint32_t layoutFrameCount = 600;      // 格納方法の比較でシミュレーションするフレーム数
+        uint32_t kernelCheckRounds = 64;      // 積分処理の照合で、全ての特殊化を乱数の入力で試す回数
+    };
+
+    ///=====================================================///
+    /// 1定義分のベンチマーク結果
+    ///=====================================================///
+    struct ParticleBenchmarkResult {
+        std::string name;                  // 定義ファイル名（拡張子なし）
+        uint32_t frameCount = 0;           // シミュレーションしたフレーム数
+        uint32_t restartCount = 0;         // 終了したバーストを発生し直した回数
+        uint64_t particleUpdates = 0;      // 各フレームの生存数の合計
+        uint32_t peakLiveCount = 0;        // 最大生存数
+        double updateMilliseconds = 0.0;   // 更新処理の合計時間（ms）
+        double nsPerParticleUpdate = 0.0;  // 1パーティクル・1フレームあたりの時間（ns）
+        uint64_t allocationCount = 0;      // 計測中の operator new の呼び出し回数（PARTICLE_BENCHMARK_COUNT_ALLOCATIONS を定義した Profile 構成以外では 0）
+        double allocationsPerFrame = 0.0;  // 1フレームあたりの確保回数
+    };
+
+    ///=====================================================///
+    /// 格納方法の比較結果（std::list<ParticleData> と ParticlePool）
+    ///=====================================================///
+    struct ParticleLayoutResult {
+        uint32_t particleCount = 0;        // 維持したパーティクル数
+        uint32_t frameCount = 0;           // シミュレーションしたフレーム数
+        double listMsPerFrame = 0.0;       // std::list<ParticleData>（プール化前の方法）の1フレームあたりの時間（ms）
+        double poolMsPerFrame = 0.0;       // ParticlePool の1フレームあたりの時間（ms）
+        uint64_t listRespawnCount = 0;     // 寿命が尽きて発生し直した数（std::list）
+        uint64_t poolRespawnCount = 0;     // 寿命が尽きて発生し直した数（ParticlePool）
+    };
+
+    ///=====================================================///
+    /// 積分処理の照合結果（命令セットごと、プール化前の1パーティクルずつの更新との比較）
+    ///=====================================================///
+    struct ParticleKernelCheckResult {
+        std::string instructionSet;        // 照合した命令セット
+        uint32_t caseCount = 0;            // 照合したケース数（回数 × 特殊化の数）
+        uint64_t particleCount = 0;        // 照合したパーティクル数の合計
+        float maxAbsoluteError = 0.0f;     // Integrate の結果のプール化前の更新との最大誤差
+        float maxRelativeError = 0.0f;     // Integrate の結果のプール化前の更新との最大相対誤差（|差| / max(1, |基準の値|)）
+        uint64_t expiredMismatches = 0;    // FindExpired の結果が1つずつ調べた結果と異なったケース数
+        uint64_t instanceMismatches = 0;   // WriteInstances の結果が1つずつ書き込んだ結果と異なったパーティクル数
+        bool isPassed = false;             // 相対誤差が許容値以内で、不一致がないか
+    };
+
+    ///=====================================================///
+    /// ParticleBenchmark
+    /// ウィンドウと D3D12 を作らずに、定義ファイルのシミュレーションだけを固定ステップで計測する。
+    /// グループは InitializeHeadless で初期化し、インスタンシングデータは CPU 側の配列に書き込む
+    ///=====================================================///
+    class ParticleBenchmark {
+    public:
+
+        /// <summary>
+        /// 1つの定義を計測（バーストは終了するたびに発生し直して duration 秒分を埋める）
+        /// </summary>
+        /// <param name="name">結果に記録する名前</param>
+        /// <param name="definition">計測する定義</param>
+        /// <param name="settings">ベンチマークの設定</param>
+        /// <returns>計測結果</returns>
+        static ParticleBenchmarkResult Run(const std::string& name, const ParticleDefinition& definition, const ParticleBenchmarkSettings& settings);
+
+        /// <summary>
+        /// ディレクトリ内の全ての定義ファイル（.json）を名前順に計測（読み込めないファイルは飛ばす）
+        /// </summary>
+        /// <param name="directory">定義ファイルのディレクトリ</param>
+        /// <param name="settings">ベンチマークの設定</param>
+        /// <returns>計測結果</returns>
+        static std::vector<ParticleBenchmarkResult> RunDirectory(const std::string& directory, const ParticleBenchmarkSettings& settings);
+
+        /// <summary>
+        /// 同じ定義（重力・色のグラデーション・スケールアニメーション・ビルボード回転）で layoutParticleCount 個を維持し、
+        /// プール化前の std::list<ParticleData> での更新と ParticlePool での更新の時間を比較
+        /// （寿命が尽きた分はどちらも毎フレーム発生し直す）
+        /// </summary>
+        /// <param name="settings">ベンチマークの設定</param>
+        /// <returns>比較結果</returns>
+        static ParticleLayoutResult RunLayoutComparison(const ParticleBenchmarkSettings& settings);
+
+        /// <summary>
+        /// 乱数で作ったパーティクルと定義で、ParticleKernel の全ての特殊化を各命令セットで実行し、
+        /// プール化前の1パーティクルずつの更新（ParticleFactory::UpdateParticle とエミッタ追従・速度減衰・ビルボード回転）と照合
+        /// （端数の処理も通るよう、パーティクル数もケースごとに変える）
+        /// </summary>
+        /// <param name="settings">ベンチマークの設定</param>
+        /// <returns>スカラー・SSE・（対応していれば）AVX2 の照合結果</returns>
+        static std::vector<ParticleKernelCheckResult> RunKernelCheck(const ParticleBenchmarkSettings& settings);
+
+        /// <summary>
+        /// 計測結果を JSON に変換（回帰の比較用）
+        /// </summary>
+        /// <param name="results">計測結果</param>
+        /// <param name="layout">格納方法の比較結果</param>
+        /// <param name="kernelChecks">積分処理の照合結果</param>
+        /// <param name="settings">計測時の設定</param>
+        /// <returns>設定・命令セット・結果をまとめた JSON</returns>
+        static nlohmann::json ToJson(const std::vector<ParticleBenchmarkResult>& results, const ParticleLayoutResult& layout,
+            const std::vector<ParticleKernelCheckResult>& kernelChecks, const ParticleBenchmarkSettings& settings);
+
+        /// <summary>
+        /// コマンドラインから実行（--particle-benchmark が含まれる場合に main から呼ぶ）
+        /// 指定できる引数: --particle-benchmark-out=パス --particle-benchmark-duration=秒 --particle-benchmark-seed=値
+        ///                 --particle-benchmark-layout-count=パーティクル数
+        /// </summary>
+        /// <param name="commandLine">コマンドライン引数</param>
+        /// <returns>終了コード（結果を書き込めなかった場合・積分処理の照合に失敗した場合は 1）</returns>
+        static int RunFromCommandLine(const std::string& commandLine);
+
+    private:
+
+        // 定義ファイルの既定のディレクトリ
+        static constexpr const char* kDefaultDirectory = "./Resource/Json/Particles";
+        // 結果の既定の出力先
+        static constexpr const char* kDefaultOutputPath = "ParticleBenchmark.json";
+        // 積分処理の照合で許容する相対誤差
+        static constexpr float kKernelTolerance = 1.0e-5f;
+    };
+}
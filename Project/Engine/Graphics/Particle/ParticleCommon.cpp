@@ -1,5 +1,8 @@
 #include "ParticleCommon.h"
+#include "ParticleKernel.h"
+#include "ParticlePool.h"
 // c++
+#include <algorithm>
 #include <cassert>
 // Math
 #include "Math/MatrixMath.h"
@@ -12,6 +15,7 @@ namespace MiiEngine {
 	ParticleCommon::~ParticleCommon() {
 		material_.reset();
 		instancing_.Reset();
+		camera_.Reset();
 	}
 	
 	///-------------------------------------------/// 
@@ -30,17 +34,25 @@ namespace MiiEngine {
 		materialData_->uvTransform = Math::MakeIdentity4x4();
 
 		/// ===Instancing=== ///
+		maxInstance_ = kNumMaxInstance;
 		// 生成
-		Create(device, sizeof(ParticleForGPU) * kNumMaxInstance);
+		instancing_ = Create(device, sizeof(ParticleForGPU) * kNumMaxInstance);
 		// 書き込むためのアドレスを取得
 		instancing_->Map(0, nullptr, reinterpret_cast<void**>(&instancingData_));
 
 		// Dataの書き込み
 		for (uint32_t index = 0; index < kNumMaxInstance; ++index) {
-			instancingData_[index].WVP = Math::MakeIdentity4x4();
-			instancingData_[index].World = Math::MakeIdentity4x4();
+			instancingData_[index].translate = { 0.0f, 0.0f, 0.0f, 0.0f };
+			instancingData_[index].rotate = { 0.0f, 0.0f, 0.0f, 0.0f };
+			instancingData_[index].scale = { 1.0f, 1.0f, 1.0f, 0.0f };
 			instancingData_[index].color = { 1.0f, 1.0f, 1.0f, 1.0f };
 		}
+
+		/// ===Camera=== ///
+		// 定数バッファは256バイト単位
+		camera_ = Create(device, (sizeof(ParticleCameraForGPU) + 0xFF) & ~0xFF);
+		camera_->Map(0, nullptr, reinterpret_cast<void**>(&cameraData_));
+		cameraData_->viewProjection = Math::MakeIdentity4x4();
 	}
 
 	///-------------------------------------------/// 
@@ -49,6 +61,8 @@ namespace MiiEngine {
 	void ParticleCommon::Bind(ID3D12GraphicsCommandList* commandList) {
 		// マテリアルCBufferの場所設定
 		commandList->SetGraphicsRootConstantBufferView(0, material_->GetBuffer()->GetGPUVirtualAddress());
+		// カメラCBufferの場所設定
+		commandList->SetGraphicsRootConstantBufferView(3, camera_->GetGPUVirtualAddress());
 	}
 
 	///-------------------------------------------/// 
@@ -66,18 +80,24 @@ namespace MiiEngine {
 		materialData_->uvTransform = uvTransform;
 
 	}
-	// Instancing
-	void ParticleCommon::SetInstancingData(size_t index, const Vector4& color, const Matrix4x4& WVP, const Matrix4x4& World) {
-		instancingData_[index].color = color;
-		instancingData_[index].WVP = WVP;
-		instancingData_[index].World = World;
+	// Camera
+	void ParticleCommon::SetViewProjection(const Matrix4x4& viewProjection) { cameraData_->viewProjection = viewProjection; }
+
+	///-------------------------------------------/// 
+	/// インスタンシングデータの書き込み
+	///-------------------------------------------///
+	uint32_t ParticleCommon::WriteInstances(const ParticlePool& pool) {
+		const uint32_t count = (std::min)(pool.GetCount(), maxInstance_);
+		ParticleKernel::WriteInstances(pool.GetChannels(), count, instancingData_, ParticleKernel::GetBestInstructionSet());
+		return count;
 	}
 
 	///-------------------------------------------/// 
 	/// Bufferの生成
 	///-------------------------------------------///
-	void ParticleCommon::Create(ID3D12Device* device, size_t sizeInBytes) {
+	ComPtr<ID3D12Resource> ParticleCommon::Create(ID3D12Device* device, size_t sizeInBytes) {
 		HRESULT hr;
+		ComPtr<ID3D12Resource> resource;
 
 		// リソース用のヒープの設定
 		D3D12_HEAP_PROPERTIES uploadHeapProperties{};
@@ -101,7 +121,9 @@ namespace MiiEngine {
 
 		// 実際に頂点リソースを作る
 		hr = device->CreateCommittedResource(&uploadHeapProperties, D3D12_HEAP_FLAG_NONE, &ResourceDesc,
-			D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&instancing_));
+			D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&resource));
 		assert(SUCCEEDED(hr));
+
+		return resource;
 	}
 }
\ No newline at end of file
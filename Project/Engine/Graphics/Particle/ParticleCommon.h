@@ -10,6 +10,9 @@
 #include <list>
 
 namespace MiiEngine {
+	/// ===前方宣言=== ///
+	class ParticlePool;
+
 	///=====================================================/// 
 	/// ParticleSetUp
 	///=====================================================///
@@ -41,18 +44,30 @@ namespace MiiEngine {
 
 		// Material
 		void SetMaterialData(const Vector4& color, const Matrix4x4& uvTransform);
-		// Instancing
-		void SetInstancingData(size_t index, const Vector4& color, const Matrix4x4& WVP, const Matrix4x4& World);
+		// Camera
+		void SetViewProjection(const Matrix4x4& viewProjection);
+
+		/// <summary>
+		/// プールの全パーティクルをインスタンシングバッファへ直接書き込む
+		/// </summary>
+		/// <param name="pool">書き込むパーティクルのプール</param>
+		/// <returns>書き込んだインスタンス数</returns>
+		uint32_t WriteInstances(const ParticlePool& pool);
 
 	private:
 
 		/// ===バッファリソース=== ///
 		std::unique_ptr<Material3D> material_;
 		ComPtr<ID3D12Resource> instancing_;
+		ComPtr<ID3D12Resource> camera_;
 
 		/// ===バッファリソース内のデータを指すポインタ=== ///
 		MaterialData3D* materialData_ = nullptr;
 		ParticleForGPU* instancingData_ = nullptr;
+		ParticleCameraForGPU* cameraData_ = nullptr;
+
+		/// ===インスタンスの最大数=== ///
+		uint32_t maxInstance_ = 0;
 
 	private:
 
@@ -61,7 +76,8 @@ namespace MiiEngine {
 		/// </summary>
 		/// <param name="device">リソース作成に使用する ID3D12Device へのポインタ。</param>
 		/// <param name="sizeInBytes">作成するリソースのサイズ（バイト単位）。</param>
-		void Create(ID3D12Device* device, size_t sizeInBytes);
+		/// <returns>生成したリソース</returns>
+		ComPtr<ID3D12Resource> Create(ID3D12Device* device, size_t sizeInBytes);
 	};
 }
 
@@ -68,6 +68,11 @@ namespace MiiEngine {
 			{"clearOnStop", advanced.clearOnStop}
 		};
 
+		// LOD・カリング設定
+		j["lod"] = LodSettingsToJson(lod);
+		// 予算設定
+		j["budget"] = BudgetSettingsToJson(budget);
+
 		return j;
 	}
 
@@ -149,6 +154,15 @@ namespace MiiEngine {
 			if (adv.contains("clearOnStop")) def.advanced.clearOnStop = adv["clearOnStop"];
 		}
 
+		// LOD・カリング設定（古いJSONには無いので既定値のまま）
+		if (json.contains("lod")) {
+			def.lod = JsonToLodSettings(json["lod"]);
+		}
+		// 予算設定（古いJSONには無いので既定値のまま）
+		if (json.contains("budget")) {
+			def.budget = JsonToBudgetSettings(json["budget"]);
+		}
+
 		return def;
 	}
 
@@ -271,4 +285,58 @@ namespace MiiEngine {
 		if (json.contains("endScale")) animation.endScale = json["endScale"];
 		return animation;
 	}
+
+	///-------------------------------------------/// 
+	/// LodSettingsのJson変換
+	///-------------------------------------------///
+	nlohmann::json ParticleDefinition::LodSettingsToJson(const ParticleLodSettings& lod) {
+		nlohmann::json distances = nlohmann::json::array();
+		nlohmann::json scales = nlohmann::json::array();
+		for (int i = 0; i < ParticleLodSettings::kBandCount; ++i) {
+			distances.push_back(lod.bandDistances[i]);
+			scales.push_back(lod.bandEmissionScales[i]);
+		}
+		return {
+			{"enableCulling", lod.enableCulling},
+			{"boundsRadius", lod.boundsRadius},
+			{"enableLod", lod.enableLod},
+			{"bandDistances", distances},
+			{"bandEmissionScales", scales}
+		};
+	}
+	ParticleLodSettings ParticleDefinition::JsonToLodSettings(const nlohmann::json& json) {
+		ParticleLodSettings lod;
+		if (json.contains("enableCulling")) lod.enableCulling = json["enableCulling"];
+		if (json.contains("boundsRadius")) lod.boundsRadius = json["boundsRadius"];
+		if (json.contains("enableLod")) lod.enableLod = json["enableLod"];
+		if (json.contains("bandDistances") && json["bandDistances"].is_array()) {
+			const auto& distances = json["bandDistances"];
+			for (int i = 0; i < ParticleLodSettings::kBandCount && i < static_cast<int>(distances.size()); ++i) {
+				lod.bandDistances[i] = distances[i];
+			}
+		}
+		if (json.contains("bandEmissionScales") && json["bandEmissionScales"].is_array()) {
+			const auto& scales = json["bandEmissionScales"];
+			for (int i = 0; i < ParticleLodSettings::kBandCount && i < static_cast<int>(scales.size()); ++i) {
+				lod.bandEmissionScales[i] = scales[i];
+			}
+		}
+		return lod;
+	}
+
+	///-------------------------------------------/// 
+	/// BudgetSettingsのJson変換
+	///-------------------------------------------///
+	nlohmann::json ParticleDefinition::BudgetSettingsToJson(const ParticleBudgetSettings& budget) {
+		return {
+			{"priority", budget.priority},
+			{"minimumGuarantee", budget.minimumGuarantee}
+		};
+	}
+	ParticleBudgetSettings ParticleDefinition::JsonToBudgetSettings(const nlohmann::json& json) {
+		ParticleBudgetSettings budget;
+		if (json.contains("priority")) budget.priority = json["priority"];
+		if (json.contains("minimumGuarantee")) budget.minimumGuarantee = json["minimumGuarantee"];
+		return budget;
+	}
 }
@@ -26,6 +26,8 @@ namespace MiiEngine {
         ParticleRotationSettings rotation;     // 回転設定
         ParticleEmissionSettings emission;     // 発生設定
         ParticleAdvancedSettings advanced;     // 高度設定
+        ParticleLodSettings lod;               // LOD・カリング設定
+        ParticleBudgetSettings budget;         // 予算設定
 
 
         /// ===JSON変換=== ///
@@ -60,6 +62,12 @@ namespace MiiEngine {
         static ParticleColorGradient JsonToColorGradient(const nlohmann::json& json);
         static nlohmann::json ScaleAnimationToJson(const ParticleScaleAnimation animation);
         static ParticleScaleAnimation JsonToScaleAnimation(const nlohmann::json& json);
+        // LOD設定用のJson変換
+        static nlohmann::json LodSettingsToJson(const ParticleLodSettings& lod);
+        static ParticleLodSettings JsonToLodSettings(const nlohmann::json& json);
+        // 予算設定用のJson変換
+        static nlohmann::json BudgetSettingsToJson(const ParticleBudgetSettings& budget);
+        static ParticleBudgetSettings JsonToBudgetSettings(const nlohmann::json& json);
     };
 }
 
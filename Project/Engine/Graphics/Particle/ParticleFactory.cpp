@@ -1,7 +1,9 @@
 #include "ParticleFactory.h"
+#include "ParticleKernel.h"
 // Math
 #include "Math/sMath.h"
 // c++
+#include <algorithm>
 #include <numbers>
 
 namespace MiiEngine {
@@ -10,17 +12,17 @@ namespace MiiEngine {
     ///-------------------------------------------///
     ParticleData ParticleFactory::CreateParticle(
         const ParticleDefinition& definition,
-        std::mt19937& randomEngine,
+        ParticleRandom& random,
         const Vector3& position) {
 
         ParticleData particle;
 
         // スケールの設定
-        particle.transform.scale = GenerateRandomScale(definition, randomEngine);
+        particle.transform.scale = GenerateRandomScale(definition, random);
 
         // 回転の初期化
         if (definition.rotation.randomInitialRotation) {
-            particle.transform.rotate = GenerateRandomInitialRotation(definition, randomEngine);
+            particle.transform.rotate = GenerateRandomInitialRotation(definition, random);
         } else {
             particle.transform.rotate = definition.rotation.initialRotationMin;
         }
@@ -31,26 +33,18 @@ namespace MiiEngine {
             definition.physics.explosionRange.y > 0.0f ||
             definition.physics.explosionRange.z > 0.0f) {
 
-            std::uniform_real_distribution<float> distX(-definition.physics.explosionRange.x, definition.physics.explosionRange.x);
-            std::uniform_real_distribution<float> distY(-definition.physics.explosionRange.y, definition.physics.explosionRange.y);
-            std::uniform_real_distribution<float> distZ(-definition.physics.explosionRange.z, definition.physics.explosionRange.z);
-
-            offset = {
-                distX(randomEngine),
-                distY(randomEngine),
-                distZ(randomEngine)
-            };
+            offset = random.Range(-definition.physics.explosionRange, definition.physics.explosionRange);
         }
         particle.transform.translate = position + offset;
 
         // 速度の設定
-        particle.velocity = GenerateRandomVelocity(definition, randomEngine, offset);
+        particle.velocity = GenerateRandomVelocity(definition, random, offset);
 
         // 色の設定
         particle.color = definition.appearance.startColor;
 
         // 寿命の設定
-        particle.lifeTime = GenerateRandomLifetime(definition, randomEngine);
+        particle.lifeTime = GenerateRandomLifetime(definition, random);
         particle.currentTime = 0.0f;
 
         // 回転速度の保存（カスタムデータとして）
@@ -62,74 +56,142 @@ namespace MiiEngine {
     ///-------------------------------------------/// 
     /// バースト生成
     ///-------------------------------------------///
-    std::list<ParticleData> ParticleFactory::CreateParticleBurst(
+    uint32_t ParticleFactory::CreateParticleBurst(
         const ParticleDefinition& definition,
-        std::mt19937& randomEngine,
+        ParticleRandom& random,
         const Vector3& position,
-        uint32_t count) {
+        uint32_t count,
+        ParticlePool& pool) {
+
+        const uint32_t first = pool.GetCount();
+        const uint32_t emitted = pool.Append(count);
+        if (emitted == 0) {
+            return 0;
+        }
+        const uint32_t last = first + emitted;
+        ParticlePool::Channels& channels = pool.GetChannels();
+
+        // 成分ごとに扱えるよう配列にしておく
+        const Vector3& scaleMin = definition.appearance.startScaleMin;
+        const Vector3& scaleMax = definition.appearance.startScaleMax;
+        const Vector3& rotationMin = definition.rotation.initialRotationMin;
+        const Vector3& rotationMax = definition.rotation.initialRotationMax;
+        const Vector3& velocityMin = definition.physics.velocityMin;
+        const Vector3& velocityMax = definition.physics.velocityMax;
+        const Vector3& explosionRange = definition.physics.explosionRange;
+        const float scaleRange[2][3] = { { scaleMin.x, scaleMin.y, scaleMin.z }, { scaleMax.x, scaleMax.y, scaleMax.z } };
+        const float rotationRange[2][3] = { { rotationMin.x, rotationMin.y, rotationMin.z }, { rotationMax.x, rotationMax.y, rotationMax.z } };
+        const float velocityRange[2][3] = { { velocityMin.x, velocityMin.y, velocityMin.z }, { velocityMax.x, velocityMax.y, velocityMax.z } };
+        const float explosion[3] = { explosionRange.x, explosionRange.y, explosionRange.z };
+        const float origin[3] = { position.x, position.y, position.z };
+        const bool hasExplosion = explosion[0] > 0.0f || explosion[1] > 0.0f || explosion[2] > 0.0f;
+
+        /// ===スケールと初期回転=== ///
+        for (int axis = 0; axis < 3; ++axis) {
+            random.FillRange(&channels.scale[axis][first], emitted, scaleRange[0][axis], scaleRange[1][axis]);
+            if (definition.rotation.randomInitialRotation) {
+                random.FillRange(&channels.rotate[axis][first], emitted, rotationRange[0][axis], rotationRange[1][axis]);
+            } else {
+                std::fill_n(&channels.rotate[axis][first], emitted, rotationRange[0][axis]);
+            }
+        }
 
-        std::list<ParticleData> particles;
+        /// ===爆発範囲のオフセット（位置の配列に一旦書き込む）=== ///
+        for (int axis = 0; axis < 3; ++axis) {
+            if (hasExplosion) {
+                random.FillRange(&channels.translate[axis][first], emitted, -explosion[axis], explosion[axis]);
+            } else {
+                std::fill_n(&channels.translate[axis][first], emitted, 0.0f);
+            }
+        }
+
+        /// ===速度=== ///
+        if (definition.physics.useRandomVelocity) {
+            for (int axis = 0; axis < 3; ++axis) {
+                random.FillRange(&channels.velocity[axis][first], emitted, velocityRange[0][axis], velocityRange[1][axis]);
+            }
+        } else if (hasExplosion) {
+            // オフセットの方向へ、速度の最大値の平均で放射状に飛ばす
+            const float averageMaxVelocity = (velocityMax.x + velocityMax.y + velocityMax.z) / 3.0f;
+            for (uint32_t i = first; i < last; ++i) {
+                const Vector3 direction = Normalize(Vector3{ channels.translate[0][i], channels.translate[1][i], channels.translate[2][i] });
+                channels.velocity[0][i] = direction.x * averageMaxVelocity;
+                channels.velocity[1][i] = direction.y * averageMaxVelocity;
+                channels.velocity[2][i] = direction.z * averageMaxVelocity;
+            }
+        } else {
+            for (int axis = 0; axis < 3; ++axis) {
+                std::fill_n(&channels.velocity[axis][first], emitted, velocityRange[0][axis]);
+            }
+        }
+        // 上方向の力を追加
+        for (uint32_t i = first; i < last; ++i) {
+            channels.velocity[1][i] += definition.physics.upwardForce;
+        }
+
+        /// ===オフセットに発生位置を足す=== ///
+        for (int axis = 0; axis < 3; ++axis) {
+            for (uint32_t i = first; i < last; ++i) {
+                channels.translate[axis][i] += origin[axis];
+            }
+        }
 
-        for (uint32_t i = 0; i < count; ++i) {
-            particles.push_back(CreateParticle(definition, randomEngine, position));
+        /// ===色と寿命=== ///
+        const Vector4& startColor = definition.appearance.startColor;
+        const float color[4] = { startColor.x, startColor.y, startColor.z, startColor.w };
+        for (int k = 0; k < 4; ++k) {
+            std::fill_n(&channels.color[k][first], emitted, color[k]);
         }
+        random.FillRange(&channels.lifeTime[first], emitted, definition.emission.lifetimeMin, definition.emission.lifetimeMax);
+        std::fill_n(&channels.currentTime[first], emitted, 0.0f);
 
-        return particles;
+        return emitted;
     }
 
     ///-------------------------------------------/// 
     /// パーティクル更新
     ///-------------------------------------------///
-    void ParticleFactory::UpdateParticle(
-        ParticleData& particle,
+    void ParticleFactory::UpdateParticles(
+        ParticlePool& pool,
         const ParticleDefinition& definition,
         float deltaTime,
-        std::mt19937& randomEngine) {
+        const Vector3& emitterDelta,
+        ParticleRandom& random) {
 
-        // 重力の適用
-        if (definition.physics.gravity != 0.0f) {
-            particle.velocity.y += definition.physics.gravity * deltaTime;
-        }
-
-        // 加速度の適用
-        particle.velocity += definition.physics.acceleration * deltaTime;
-
-        // 位置の更新
-        particle.transform.translate += particle.velocity * deltaTime;
+        // 速度・位置・時間・色・スケールの更新
+        ParticleKernel::Integrate(
+            pool,
+            ParticleKernel::BuildFeatures(definition),
+            ParticleKernel::BuildParams(definition, deltaTime, emitterDelta),
+            ParticleKernel::GetBestInstructionSet());
 
         // 回転の更新
         if (definition.rotation.enableRotation) {
-            Vector3 rotationSpeed = GenerateRandomRotationSpeed(definition, randomEngine);
+            ParticlePool::Channels& channels = pool.GetChannels();
+            const uint32_t count = pool.GetCount();
+            float* rotate[3] = { channels.rotate[0].data(), channels.rotate[1].data(), channels.rotate[2].data() };
             if (definition.rotation.randomRotation) {
-                particle.transform.rotate += rotationSpeed * deltaTime;
+                // パーティクルごとに毎フレーム範囲内の速度を引く
+                for (uint32_t i = 0; i < count; ++i) {
+                    Vector3 rotationSpeed = GenerateRandomRotationSpeed(definition, random);
+                    rotate[0][i] += rotationSpeed.x * deltaTime;
+                    rotate[1][i] += rotationSpeed.y * deltaTime;
+                    rotate[2][i] += rotationSpeed.z * deltaTime;
+                }
             } else {
                 // 固定速度で回転
-                particle.transform.rotate += definition.rotation.rotationSpeedMin * deltaTime;
+                const float speed[3] = {
+                    definition.rotation.rotationSpeedMin.x * deltaTime,
+                    definition.rotation.rotationSpeedMin.y * deltaTime,
+                    definition.rotation.rotationSpeedMin.z * deltaTime
+                };
+                for (int axis = 0; axis < 3; ++axis) {
+                    for (uint32_t i = 0; i < count; ++i) {
+                        rotate[axis][i] += speed[axis];
+                    }
+                }
             }
         }
-
-        // 時間の更新
-        particle.currentTime += deltaTime;
-
-        // 寿命に基づく補間率
-        float t = particle.currentTime / particle.lifeTime;
-
-        // 色のグラデーション
-        if (definition.appearance.useColorGradient) {
-            particle.color = LerpColor(
-                definition.appearance.startColor,
-                definition.appearance.endColor,
-                t);
-        }
-
-        // スケールアニメーション
-        if (definition.appearance.useScaleAnimation) {
-            Vector3 startScale = (definition.appearance.startScaleMin + definition.appearance.startScaleMax) * 0.5f;
-            particle.transform.scale = LerpScale(
-                startScale,
-                definition.appearance.endScale,
-                t);
-        }
     }
 
     ///-------------------------------------------/// 
@@ -137,28 +199,14 @@ namespace MiiEngine {
     ///-------------------------------------------///
     Vector3 ParticleFactory::GenerateRandomVelocity(
         const ParticleDefinition& definition,
-        std::mt19937& randomEngine,
+        ParticleRandom& random,
         const Vector3& position) {
 
         Vector3 velocity;
 
         if (definition.physics.useRandomVelocity) {
             // ランダム範囲内で速度を生成
-            std::uniform_real_distribution<float> distX(
-                definition.physics.velocityMin.x,
-                definition.physics.velocityMax.x);
-            std::uniform_real_distribution<float> distY(
-                definition.physics.velocityMin.y,
-                definition.physics.velocityMax.y);
-            std::uniform_real_distribution<float> distZ(
-                definition.physics.velocityMin.z,
-                definition.physics.velocityMax.z);
-
-            velocity = {
-                distX(randomEngine),
-                distY(randomEngine),
-                distZ(randomEngine)
-            };
+            velocity = random.Range(definition.physics.velocityMin, definition.physics.velocityMax);
         } else {
             // 爆発方向に基づく速度
             float rangeSum = definition.physics.explosionRange.x +
@@ -191,23 +239,9 @@ namespace MiiEngine {
     ///-------------------------------------------///
     Vector3 ParticleFactory::GenerateRandomInitialRotation(
         const ParticleDefinition& definition,
-        std::mt19937& randomEngine) {
-
-        std::uniform_real_distribution<float> distX(
-            definition.rotation.initialRotationMin.x,
-            definition.rotation.initialRotationMax.x);
-        std::uniform_real_distribution<float> distY(
-            definition.rotation.initialRotationMin.y,
-            definition.rotation.initialRotationMax.y);
-        std::uniform_real_distribution<float> distZ(
-            definition.rotation.initialRotationMin.z,
-            definition.rotation.initialRotationMax.z);
-
-        return {
-            distX(randomEngine),
-            distY(randomEngine),
-            distZ(randomEngine)
-        };
+        ParticleRandom& random) {
+
+        return random.Range(definition.rotation.initialRotationMin, definition.rotation.initialRotationMax);
     }
 
     ///-------------------------------------------/// 
@@ -215,23 +249,9 @@ namespace MiiEngine {
     ///-------------------------------------------///
     Vector3 ParticleFactory::GenerateRandomScale(
         const ParticleDefinition& definition,
-        std::mt19937& randomEngine) {
-
-        std::uniform_real_distribution<float> distX(
-            definition.appearance.startScaleMin.x,
-            definition.appearance.startScaleMax.x);
-        std::uniform_real_distribution<float> distY(
-            definition.appearance.startScaleMin.y,
-            definition.appearance.startScaleMax.y);
-        std::uniform_real_distribution<float> distZ(
-            definition.appearance.startScaleMin.z,
-            definition.appearance.startScaleMax.z);
-
-        return {
-            distX(randomEngine),
-            distY(randomEngine),
-            distZ(randomEngine)
-        };
+        ParticleRandom& random) {
+
+        return random.Range(definition.appearance.startScaleMin, definition.appearance.startScaleMax);
     }
 
     ///-------------------------------------------/// 
@@ -239,23 +259,9 @@ namespace MiiEngine {
     ///-------------------------------------------///
     Vector3 ParticleFactory::GenerateRandomRotationSpeed(
         const ParticleDefinition& definition,
-        std::mt19937& randomEngine) {
-
-        std::uniform_real_distribution<float> distX(
-            definition.rotation.rotationSpeedMin.x,
-            definition.rotation.rotationSpeedMax.x);
-        std::uniform_real_distribution<float> distY(
-            definition.rotation.rotationSpeedMin.y,
-            definition.rotation.rotationSpeedMax.y);
-        std::uniform_real_distribution<float> distZ(
-            definition.rotation.rotationSpeedMin.z,
-            definition.rotation.rotationSpeedMax.z);
-
-        return {
-            distX(randomEngine),
-            distY(randomEngine),
-            distZ(randomEngine)
-        };
+        ParticleRandom& random) {
+
+        return random.Range(definition.rotation.rotationSpeedMin, definition.rotation.rotationSpeedMax);
     }
 
     ///-------------------------------------------/// 
@@ -263,37 +269,8 @@ namespace MiiEngine {
     ///-------------------------------------------///
     float ParticleFactory::GenerateRandomLifetime(
         const ParticleDefinition& definition,
-        std::mt19937& randomEngine) {
-
-        std::uniform_real_distribution<float> dist(
-            definition.emission.lifetimeMin,
-            definition.emission.lifetimeMax);
-
-        return dist(randomEngine);
-    }
-
-    ///-------------------------------------------/// 
-    /// 色の補間
-    ///-------------------------------------------///
-    Vector4 ParticleFactory::LerpColor(const Vector4& start, const Vector4& end, float t) {
-        t = std::clamp(t, 0.0f, 1.0f);
-        return {
-            start.x + (end.x - start.x) * t,
-            start.y + (end.y - start.y) * t,
-            start.z + (end.z - start.z) * t,
-            start.w + (end.w - start.w) * t
-        };
-    }
+        ParticleRandom& random) {
 
-    ///-------------------------------------------/// 
-    /// スケールの補間
-    ///-------------------------------------------///
-    Vector3 ParticleFactory::LerpScale(const Vector3& start, const Vector3& end, float t) {
-        t = std::clamp(t, 0.0f, 1.0f);
-        return {
-            start.x + (end.x - start.x) * t,
-            start.y + (end.y - start.y) * t,
-            start.z + (end.z - start.z) * t
-        };
+        return random.Range(definition.emission.lifetimeMin, definition.emission.lifetimeMax);
     }
 }
\ No newline at end of file
@@ -1,10 +1,9 @@
 #pragma once
 /// ===Include=== ///
 #include "ParticleDefinition.h"
+#include "ParticlePool.h"
+#include "ParticleRandom.h"
 #include "Engine/DataInfo/ParticleData.h"
-// c++
-#include <random>
-#include <list>
 
 namespace MiiEngine {
     ///=====================================================/// 
@@ -18,40 +17,47 @@ namespace MiiEngine {
         /// 単一のパーティクルデータを生成
         /// </summary>
         /// <param name="definition">パーティクルの定義データ</param>
-        /// <param name="randomEngine">乱数生成器</param>
+        /// <param name="random">乱数生成器</param>
         /// <param name="position">発生位置</param>
         /// <returns>生成されたパーティクルデータ</returns>
         static ParticleData CreateParticle(
             const ParticleDefinition& definition,
-            std::mt19937& randomEngine,
+            ParticleRandom& random,
             const Vector3& position);
 
         /// <summary>
-        /// パーティクルのバッチ生成（バーストモード用）
+        /// パーティクルのバッチ生成（バースト・連続発生用）
+        /// 属性ごとに全パーティクル分の乱数をまとめて引き、プールのSoA配列に直接書き込む
         /// </summary>
         /// <param name="definition">パーティクルの定義データ</param>
-        /// <param name="randomEngine">乱数生成器</param>
+        /// <param name="random">乱数生成器</param>
         /// <param name="position">発生位置</param>
         /// <param name="count">生成数</param>
-        /// <returns>生成されたパーティクルのリスト</returns>
-        static std::list<ParticleData> CreateParticleBurst(
+        /// <param name="pool">追加先のプール（満杯になった時点で打ち切り）</param>
+        /// <returns>追加できた数</returns>
+        static uint32_t CreateParticleBurst(
             const ParticleDefinition& definition,
-            std::mt19937& randomEngine,
+            ParticleRandom& random,
             const Vector3& position,
-            uint32_t count);
+            uint32_t count,
+            ParticlePool& pool);
 
         /// <summary>
-        /// パーティクルの更新処理（汎用ロジック）
+        /// プール内の全パーティクルの更新処理（汎用ロジック）
+        /// 重力・加速度・エミッタ追従・速度減衰・色とスケールの補間・ビルボード回転は
+        /// ParticleKernel でまとめて処理する
         /// </summary>
-        /// <param name="particle">更新するパーティクルデータ</param>
+        /// <param name="pool">更新するパーティクルのプール</param>
         /// <param name="definition">パーティクルの定義データ</param>
         /// <param name="deltaTime">デルタタイム</param>
-        /// <param name="randomEngine">乱数生成器（回転用）</param>
-        static void UpdateParticle(
-            ParticleData& particle,
+        /// <param name="emitterDelta">前フレームからのエミッタの移動量（追従用）</param>
+        /// <param name="random">乱数生成器（回転用）</param>
+        static void UpdateParticles(
+            ParticlePool& pool,
             const ParticleDefinition& definition,
             float deltaTime,
-            std::mt19937& randomEngine);
+            const Vector3& emitterDelta,
+            ParticleRandom& random);
 
     private:
 
@@ -60,7 +66,7 @@ namespace MiiEngine {
         /// </summary>
         static Vector3 GenerateRandomVelocity(
             const ParticleDefinition& definition,
-            std::mt19937& randomEngine,
+            ParticleRandom& random,
             const Vector3& position);
 
         /// <summary>
@@ -68,43 +74,27 @@ namespace MiiEngine {
         /// </summary>
         static Vector3 GenerateRandomInitialRotation(
             const ParticleDefinition& definition,
-            std::mt19937& randomEngine);
+            ParticleRandom& random);
 
         /// <summary>
         /// ランダムなスケールを生成
         /// </summary>
         static Vector3 GenerateRandomScale(
             const ParticleDefinition& definition,
-            std::mt19937& randomEngine);
+            ParticleRandom& random);
 
         /// <summary>
         /// ランダムな回転速度を生成
         /// </summary>
         static Vector3 GenerateRandomRotationSpeed(
             const ParticleDefinition& definition,
-            std::mt19937& randomEngine);
+            ParticleRandom& random);
 
         /// <summary>
         /// ランダムな寿命を生成
         /// </summary>
         static float GenerateRandomLifetime(
             const ParticleDefinition& definition,
-            std::mt19937& randomEngine);
-
-        /// <summary>
-        /// 時間経過による色の補間
-        /// </summary>
-        static Vector4 LerpColor(
-            const Vector4& start,
-            const Vector4& end,
-            float t);
-
-        /// <summary>
-        /// 時間経過によるスケールの補間
-        /// </summary>
-        static Vector3 LerpScale(
-            const Vector3& start,
-            const Vector3& end,
-            float t);
+            ParticleRandom& random);
     };
 }
\ No newline at end of file
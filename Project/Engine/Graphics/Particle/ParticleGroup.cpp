@@ -1,5 +1,6 @@
 #include "ParticleGroup.h"
 #include "ParticleFactory.h"
+#include "ParticleKernel.h"
 // Camera
 #include "Engine/Camera/Base/CameraCommon.h"
 // Service
@@ -9,7 +10,10 @@
 // Math
 #include "Math/sMath.h"
 #include "Math/MatrixMath.h"
+#include "Math/Frustum.h"
 // c++
+#include <algorithm>
+#include <cmath>
 #include <numbers>
 
 namespace MiiEngine {
@@ -17,24 +21,68 @@ namespace MiiEngine {
     /// デストラクタ
     ///-------------------------------------------///
     ParticleGroup::~ParticleGroup() {
-        group_.particles.clear();
+        group_.particles.Clear();
         group_.particle.reset();
     }
 
     ///-------------------------------------------/// 
     /// 初期化（パラメータ駆動型）
     ///-------------------------------------------///
-    void ParticleGroup::Initialize(const Vector3& translate, const ParticleDefinition& definition) {
+    void ParticleGroup::Initialize(const Vector3& translate, const ParticleDefinition& definition, uint64_t seed) {
+        /// ===描画用バッファとプールの用意（プールから取り出したグループは使い回す）=== ///
+        isHeadless_ = false;
+        PrepareBuffers(definition);
+
+        /// ===発生ごとの状態を初期化=== ///
+        ResetState(translate, definition, seed);
+
+        /// ===Cameraの設定=== ///
+        group_.camera = Service::Camera::GetActiveCamera();
+
+        // デルタタイムの取得
+        kDeltaTime_ = Service::DeltaTime::GetDeltaTime();
+
+        // テクスチャの設定
+        if (!definition_.appearance.texturePath.empty()) {
+            SetTexture(definition_.appearance.texturePath);
+        }
+
+        // 
+        Update();
+    }
+
+    ///-------------------------------------------/// 
+    /// 初期化（描画用バッファなし）
+    ///-------------------------------------------///
+    void ParticleGroup::InitializeHeadless(const Vector3& translate, const ParticleDefinition& definition, uint64_t seed) {
+        /// ===プールと書き込み先の用意（同じ最大数なら使い回す）=== ///
+        isHeadless_ = true;
+        group_.particle.reset();
+        group_.numInstance = 0;
+        if (group_.maxInstance != definition.maxInstance || headlessInstances_.size() != definition.maxInstance) {
+            group_.maxInstance = definition.maxInstance;
+            group_.particles.Initialize(group_.maxInstance);
+            headlessInstances_.assign(group_.maxInstance, ParticleForGPU{});
+        } else {
+            group_.particles.Clear();
+        }
+
+        /// ===発生ごとの状態を初期化=== ///
+        ResetState(translate, definition, seed);
+        group_.camera = nullptr;
+    }
+
+    ///-------------------------------------------/// 
+    /// 発生ごとの状態の初期化
+    ///-------------------------------------------///
+    void ParticleGroup::ResetState(const Vector3& translate, const ParticleDefinition& definition, uint64_t seed) {
         /// ===定義を保存=== ///
         definition_ = definition;
+        isStopped_ = false;
 
         /// ===乱数生成器の初期化=== ///
-        std::random_device seedGenerator;
-        randomEngine_.seed(seedGenerator());
-
-        /// ===最大パーティクル数の設定=== ///
-        group_.maxInstance = definition_.maxInstance;
-        group_.numInstance = 0;
+        seed_ = seed;
+        random_.Seed(seed_);
 
         /// ===トランスフォームの初期化=== ///
         group_.transform = { {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, translate };
@@ -49,26 +97,26 @@ namespace MiiEngine {
         group_.previousEmitterRotation = { 0.0f, 0.0f, 0.0f };
         group_.trajectoryTimer = 0.0f;
 
-        /// ===パーティクルグループの初期化=== ///
-        InstancingInit(definition_.modelName, translate, group_.maxInstance, definition_.shape);
-
-        /// ===Cameraの設定=== ///
-        group_.camera = Service::Camera::GetActiveCamera();
+        /// ===LOD・カリングの初期化=== ///
+        group_.isCulled = false;
+        group_.emissionScale = 1.0f;
+        group_.emissionRemainder = 0.0f;
+        group_.budgetScale = 1.0f;
+        group_.suppressedCount = 0;
 
         /// ===発生タイマーの初期化=== ///
         group_.frequencyTimer = 0.0f;
         group_.hasEmitted = false;
+    }
 
-        // デルタタイムの取得
-        kDeltaTime_ = Service::DeltaTime::GetDeltaTime();
-
-        // テクスチャの設定
-        if (!definition_.appearance.texturePath.empty()) {
-            SetTexture(definition_.appearance.texturePath);
-        }
-
-        // 
-        Update();
+    ///-------------------------------------------/// 
+    /// 事前確保
+    ///-------------------------------------------///
+    void ParticleGroup::Prewarm(const ParticleDefinition& definition) {
+        isHeadless_ = false;
+        PrepareBuffers(definition);
+        definition_ = definition;
+        isStopped_ = false;
     }
 
     ///-------------------------------------------/// 
@@ -76,19 +124,30 @@ namespace MiiEngine {
     ///-------------------------------------------///
     void ParticleGroup::Update() {
         // デルタタイムの取得
-        kDeltaTime_ = Service::DeltaTime::GetDeltaTime();
+        Update(Service::DeltaTime::GetDeltaTime());
+    }
+    void ParticleGroup::Update(float deltaTime) {
+        kDeltaTime_ = deltaTime;
+        group_.suppressedCount = 0;
+
+        // 視錐台カリングと距離LOD
+        UpdateCulling();
 
         // 停止中の場合は新規発生を止めて、既存パーティクルの寿命を短縮
         if (isStopped_) {
-            // 既存のパーティクルの寿命を強制終了
-            for (auto& particle : group_.particles) {
-                particle.currentTime = particle.lifeTime;  // 即座に寿命を終了させる
-            }
+            // 既存のパーティクルを即座に全て消す
+            group_.particles.Clear();
             // パーティクルの更新のみ実行（発生処理はスキップ）
             UpdateParticles();
             return;
         }
 
+        // 画面外の場合は寿命だけ進める
+        if (group_.isCulled) {
+            FastForward();
+            return;
+        }
+
         // 通常時の処理
         // パーティクルの発生処理
         Emit();
@@ -101,7 +160,7 @@ namespace MiiEngine {
     /// 描画
     ///-------------------------------------------///
     void ParticleGroup::Draw(BlendMode mode) {
-        if (group_.numInstance > 0) {
+        if (group_.numInstance > 0 && group_.particle) {
             group_.particle->Draw(group_.numInstance, mode);
         }
     }
@@ -117,12 +176,12 @@ namespace MiiEngine {
     bool ParticleGroup::IsFinish() const {
         // 停止されている場合、全パーティクルが消えたら終了
         if (isStopped_) {
-            return group_.particles.empty();
+            return group_.particles.IsEmpty();
         }
 
         // バーストモードの場合は全パーティクルが消えたらtrue
         if (definition_.emission.isBurst) {
-            return group_.particles.empty() && group_.hasEmitted;
+            return group_.particles.IsEmpty() && group_.hasEmitted;
         }
 
         // 連続発生モードの場合は常にfalse（手動で停止する必要がある）
@@ -269,13 +328,59 @@ namespace MiiEngine {
         group_.previousEmitterRotation = group_.transform.rotate;
         group_.transform.rotate = rotate;
     }
+    // 予算による発生数の倍率設定
+    void ParticleGroup::SetBudgetScale(float scale) { group_.budgetScale = std::clamp(scale, 0.0f, 1.0f); }
 
     ///-------------------------------------------/// 
     /// Getter
     ///-------------------------------------------///
     const ParticleDefinition& ParticleGroup::GetDefinition() const { return definition_; }
-    uint32_t ParticleGroup::GetActiveParticleCount() const { return static_cast<uint32_t>(group_.particles.size()); }
+    uint32_t ParticleGroup::GetActiveParticleCount() const { return group_.particles.GetCount(); }
     const Vector3& ParticleGroup::GetEmitterPosition() const { return group_.transform.translate; }
+    uint64_t ParticleGroup::GetSeed() const { return seed_; }
+    bool ParticleGroup::IsCulled() const { return group_.isCulled; }
+    float ParticleGroup::GetBudgetScale() const { return group_.budgetScale; }
+    uint32_t ParticleGroup::GetSuppressedCount() const { return group_.suppressedCount; }
+    uint32_t ParticleGroup::GetMaxInstance() const { return group_.maxInstance; }
+
+    ///-------------------------------------------/// 
+    /// バッファの用意
+    ///-------------------------------------------///
+    void ParticleGroup::PrepareBuffers(const ParticleDefinition& definition) {
+        group_.numInstance = 0;
+
+        // 同じ形のバッファならパーティクルを消すだけ
+        if (CanReuseBuffers(definition)) {
+            group_.particles.Clear();
+            return;
+        }
+
+        /// ===最大パーティクル数の設定=== ///
+        group_.maxInstance = definition.maxInstance;
+        group_.particles.Initialize(group_.maxInstance);
+
+        /// ===パーティクルグループの初期化=== ///
+        InstancingInit(definition.modelName, group_.transform.translate, group_.maxInstance, definition.shape);
+    }
+
+    ///-------------------------------------------/// 
+    /// バッファを使い回せるか
+    ///-------------------------------------------///
+    bool ParticleGroup::CanReuseBuffers(const ParticleDefinition& definition) const {
+        if (!group_.particle) {
+            return false;
+        }
+
+        // モデル・形状・最大数が同じならバッファの大きさと中身も同じ
+        if (definition.modelName != definition_.modelName ||
+            definition.shape != definition_.shape ||
+            definition.maxInstance != definition_.maxInstance) {
+            return false;
+        }
+
+        // モデル既定のテクスチャは保持していないため、テクスチャを外す場合は作り直す
+        return !definition.appearance.texturePath.empty() || definition_.appearance.texturePath.empty();
+    }
 
     ///-------------------------------------------/// 
     /// インスタンシング初期化
@@ -290,18 +395,38 @@ namespace MiiEngine {
     ///-------------------------------------------/// 
     /// インスタンシング更新
     ///-------------------------------------------///
-    void ParticleGroup::InstancingUpdate(std::list<ParticleData>::iterator it) {
-        // ワールド行列とWVP行列の計算
-        Matrix4x4 worldMatrix = Math::MakeAffineEulerMatrix(
-            it->transform.scale,
-            it->transform.rotate,
-            it->transform.translate);
-        Matrix4x4 wvpMatrix;
-
-        // カメラが存在する場合はWVP行列を計算
+    void ParticleGroup::InstancingUpdate() {
+        // 描画用バッファがない場合は CPU 側の配列に書き込む
+        if (isHeadless_) {
+            const uint32_t count = group_.particles.GetCount();
+            ParticleKernel::WriteInstances(group_.particles.GetChannels(), count, headlessInstances_.data(), ParticleKernel::GetBestInstructionSet());
+            group_.numInstance = count;
+            return;
+        }
+
+        // カメラ行列は UpdateCulling で1回だけ取得済み（WVP は頂点シェーダーで組み立てる）
+        group_.particle->SetViewProjection(group_.viewProjection);
+
+        // インスタンシングデータを設定
+        group_.numInstance = group_.particle->WriteInstances(group_.particles);
+    }
+
+    ///-------------------------------------------/// 
+    /// カリングとLOD
+    ///-------------------------------------------///
+    void ParticleGroup::UpdateCulling() {
+        // カメラがない場合は常に描画範囲内として扱う
+        if (isHeadless_) {
+            group_.isCulled = false;
+            group_.emissionScale = 1.0f;
+            return;
+        }
+
+        /// ===ビュープロジェクション行列とカメラ位置=== ///
+        Vector3 cameraPosition;
         if (group_.camera) {
-            const Matrix4x4& viewProjectionMatrix = group_.camera->GetViewProjectionMatrix();
-            wvpMatrix = Multiply(worldMatrix, viewProjectionMatrix);
+            group_.viewProjection = group_.camera->GetViewProjectionMatrix();
+            cameraPosition = group_.camera->GetTranslate();
         } else {
             Matrix4x4 viewMatrix = Math::Inverse4x4(
                 Math::MakeAffineEulerMatrix(
@@ -313,12 +438,90 @@ namespace MiiEngine {
                 static_cast<float>(Service::GraphicsResourceGetter::GetWindowWidth()) /
                 static_cast<float>(Service::GraphicsResourceGetter::GetWindowHeight()),
                 0.1f, 100.0f);
-            wvpMatrix = Multiply(worldMatrix, Multiply(viewMatrix, projectionMatrix));
+            group_.viewProjection = Multiply(viewMatrix, projectionMatrix);
+            cameraPosition = group_.cameraTransform.translate;
         }
 
-        // インスタンシングデータを設定
-        group_.particle->SetInstancingData(group_.numInstance, it->color, wvpMatrix, worldMatrix);
-        ++group_.numInstance;
+        const ParticleLodSettings& lod = definition_.lod;
+
+        /// ===視錐台カリング=== ///
+        group_.isCulled = false;
+        if (lod.enableCulling) {
+            const Frustum frustum = Math::MakeFrustum(group_.viewProjection);
+            group_.isCulled = !Math::IsSphereInFrustum(frustum, group_.transform.translate, ComputeBoundsRadius());
+        }
+
+        /// ===距離LOD（距離が帯の開始距離以上なら、その帯の倍率）=== ///
+        group_.emissionScale = 1.0f;
+        if (lod.enableLod) {
+            const float distance = Length(group_.transform.translate - cameraPosition);
+            for (int i = 0; i < ParticleLodSettings::kBandCount; ++i) {
+                if (distance >= lod.bandDistances[i]) {
+                    group_.emissionScale = lod.bandEmissionScales[i];
+                }
+            }
+        }
+    }
+
+    ///-------------------------------------------/// 
+    /// 境界球の半径
+    ///-------------------------------------------///
+    float ParticleGroup::ComputeBoundsRadius() const {
+        if (definition_.lod.boundsRadius > 0.0f) {
+            return definition_.lod.boundsRadius;
+        }
+
+        // 寿命いっぱいまで最大の速度と加速度で進んだ距離に、発生範囲とスケールを足す
+        // （渦巻きなど後から位置を動かす処理は含まないため、必要なら boundsRadius を指定する）
+        const ParticlePhysicsSettings& physics = definition_.physics;
+        auto maxAbs = [](float a, float b) { return (std::max)(std::abs(a), std::abs(b)); };
+        const Vector3 speed = {
+            maxAbs(physics.velocityMin.x, physics.velocityMax.x),
+            maxAbs(physics.velocityMin.y, physics.velocityMax.y) + std::abs(physics.upwardForce),
+            maxAbs(physics.velocityMin.z, physics.velocityMax.z)
+        };
+        const Vector3 acceleration = { physics.acceleration.x, physics.acceleration.y + physics.gravity, physics.acceleration.z };
+        const float lifetime = (std::max)(definition_.emission.lifetimeMin, definition_.emission.lifetimeMax);
+        const float spawnRange = (std::max)({ physics.explosionRange.x, physics.explosionRange.y, physics.explosionRange.z });
+        const Vector3& scaleMax = definition_.appearance.startScaleMax;
+        const Vector3& endScale = definition_.appearance.endScale;
+        const float scale = (std::max)({ scaleMax.x, scaleMax.y, scaleMax.z, endScale.x, endScale.y, endScale.z });
+
+        return spawnRange + Length(speed) * lifetime + 0.5f * Length(acceleration) * lifetime * lifetime + scale;
+    }
+
+    ///-------------------------------------------/// 
+    /// 発生数にLODと予算の倍率を掛ける
+    ///-------------------------------------------///
+    uint32_t ParticleGroup::ScaleEmitCount(uint32_t count) {
+        const float scale = group_.emissionScale * group_.budgetScale;
+        if (scale >= 1.0f) {
+            return count;
+        }
+        const float scaled = static_cast<float>(count) * scale + group_.emissionRemainder;
+        const uint32_t result = static_cast<uint32_t>(scaled);
+        group_.emissionRemainder = scaled - static_cast<float>(result);
+        group_.suppressedCount += count - result;
+        return result;
+    }
+
+    ///-------------------------------------------/// 
+    /// 画面外の更新
+    ///-------------------------------------------///
+    void ParticleGroup::FastForward() {
+        // 見えない場所での一度きりのバーストは発生済みとして省く
+        group_.hasEmitted = true;
+
+        // 寿命だけ進めて、尽きたものを削除
+        group_.particles.AdvanceLifetimes(kDeltaTime_);
+        group_.particles.RemoveExpired();
+
+        // 描画しない
+        group_.numInstance = 0;
+
+        // 画面内に戻った時に追従量が跳ねないよう、エミッタの状態は更新しておく
+        group_.previousEmitterPosition = group_.transform.translate;
+        group_.previousEmitterRotation = group_.transform.rotate;
     }
 
     ///-------------------------------------------/// 
@@ -326,7 +529,7 @@ namespace MiiEngine {
     ///-------------------------------------------///
     ParticleData ParticleGroup::MakeParticle(const Vector3& translate) {
         // 基本パーティクルを生成
-        ParticleData particle = ParticleFactory::CreateParticle(definition_, randomEngine_, translate);
+        ParticleData particle = ParticleFactory::CreateParticle(definition_, random_, translate);
 
         // 軌跡モードの場合、エミッタの回転を考慮
         if (definition_.advanced.isTrajectoryParticle) {
@@ -371,12 +574,10 @@ namespace MiiEngine {
 
                 if (distanceMoved > 0.01f) {
                     // パーティクル生成数
-                    uint32_t particlesPerEmit = definition_.advanced.emissionPattern.particlesPerEmit;
+                    uint32_t particlesPerEmit = ScaleEmitCount(definition_.advanced.emissionPattern.particlesPerEmit);
 
-                    for (uint32_t i = 0; i < particlesPerEmit; ++i) {
-                        if (group_.particles.size() < group_.maxInstance) {
-                            group_.particles.push_back(MakeParticle(group_.transform.translate));
-                        }
+                    for (uint32_t i = 0; i < particlesPerEmit && !group_.particles.IsFull(); ++i) {
+                        group_.particles.Add(MakeParticle(group_.transform.translate));
                     }
                 }
 
@@ -388,13 +589,14 @@ namespace MiiEngine {
         // バーストモード
         if (definition_.emission.isBurst) {
             if (!group_.hasEmitted) {
-                std::list<ParticleData> burstParticles = ParticleFactory::CreateParticleBurst(
+                // プールに直接書き込む（maxInstance を超えた分は発生させない）
+                ParticleFactory::CreateParticleBurst(
                     definition_,
-                    randomEngine_,
+                    random_,
                     group_.transform.translate,
-                    definition_.emission.burstCount);
+                    ScaleEmitCount(definition_.emission.burstCount),
+                    group_.particles);
 
-                group_.particles.splice(group_.particles.end(), burstParticles);
                 group_.hasEmitted = true;
             }
             return;
@@ -404,14 +606,16 @@ namespace MiiEngine {
         group_.frequencyTimer += kDeltaTime_;
 
         if (group_.frequencyTimer >= definition_.emission.frequency) {
-            uint32_t emitCount = static_cast<uint32_t>(
-                definition_.emission.emissionRate * definition_.emission.frequency);
+            uint32_t emitCount = ScaleEmitCount(static_cast<uint32_t>(
+                definition_.emission.emissionRate * definition_.emission.frequency));
 
-            for (uint32_t i = 0; i < emitCount; ++i) {
-                if (group_.particles.size() < group_.maxInstance) {
-                    group_.particles.push_back(MakeParticle(group_.transform.translate));
-                }
-            }
+            // 軌跡モード以外はエミッタの回転を使わないので、バーストと同じくまとめて生成する
+            ParticleFactory::CreateParticleBurst(
+                definition_,
+                random_,
+                group_.transform.translate,
+                emitCount,
+                group_.particles);
 
             group_.frequencyTimer = 0.0f;
         }
@@ -421,56 +625,26 @@ namespace MiiEngine {
     /// パーティクル更新処理
     ///-------------------------------------------///
     void ParticleGroup::UpdateParticles() {
-        group_.numInstance = 0;
+        // 寿命チェック（末尾のパーティクルで詰めるので、以降は [0, count) を順に見るだけ）
+        group_.particles.RemoveExpired();
 
-        // エミッタの移動量計算
+        // 基本更新（ParticleFactory使用。追従・減衰・ビルボード回転もここで処理）
         Vector3 emitterDelta = group_.transform.translate - group_.previousEmitterPosition;
+        ParticleFactory::UpdateParticles(group_.particles, definition_, kDeltaTime_, emitterDelta, random_);
 
-        for (auto it = group_.particles.begin(); it != group_.particles.end();) {
-            // 寿命チェック
-            if (it->currentTime >= it->lifeTime) {
-                it = group_.particles.erase(it);
-                continue;
-            }
-
-            // 基本更新（ParticleFactory使用）
-            ParticleFactory::UpdateParticle(*it, definition_, kDeltaTime_, randomEngine_);
-
-            // 進行度の計算
-            float progress = it->currentTime / it->lifeTime;
-
-            // エミッタ追従
-            if (definition_.advanced.motion.followEmitter) {
-                Vector3 followOffset = emitterDelta * definition_.advanced.motion.followStrength;
-                it->transform.translate += followOffset;
-            }
-
-            // 速度減衰
-            if (definition_.advanced.motion.velocityDamping < 1.0f) {
-                it->velocity = it->velocity * definition_.advanced.motion.velocityDamping;
-            }
-
-            // 渦巻き運動
-            if (definition_.advanced.motion.enableSwirling) {
-                ApplySwirlMotion(*it, progress);
-            }
-
-            // 回転影響
-            if (definition_.advanced.motion.useRotationInfluence) {
-                ApplyRotationInfluence(*it, progress);
-            }
-
-            // ビルボード回転
-            if (definition_.advanced.motion.enableBillboardRotation) {
-                float rotationSpeed = definition_.advanced.motion.billboardRotationSpeed;
-                it->transform.rotate.z += rotationSpeed * kDeltaTime_;
-            }
+        // 渦巻き運動
+        if (definition_.advanced.motion.enableSwirling) {
+            ApplySwirlMotion();
+        }
 
-            // インスタンシング更新
-            InstancingUpdate(it);
-            ++it;
+        // 回転影響
+        if (definition_.advanced.motion.useRotationInfluence) {
+            ApplyRotationInfluence();
         }
 
+        // インスタンシング更新
+        InstancingUpdate();
+
         // 前回の状態を保存
         group_.previousEmitterPosition = group_.transform.translate;
         group_.previousEmitterRotation = group_.transform.rotate;
@@ -479,40 +653,55 @@ namespace MiiEngine {
     ///-------------------------------------------/// 
     /// 渦巻き運動の適用
     ///-------------------------------------------///
-    void ParticleGroup::ApplySwirlMotion(ParticleData& particle, float progress) {
-        float swirl = particle.currentTime * definition_.advanced.motion.swirlingSpeed;
-
-        // エミッタの回転を考慮したローカル空間での渦巻き
-        Vector3 localSwirlingOffset = {
-            std::cos(swirl) * definition_.advanced.motion.expansionRate * progress,
-            std::sin(swirl * 1.3f) * definition_.advanced.motion.expansionRate * progress * 0.5f,
-            std::sin(swirl) * definition_.advanced.motion.expansionRate * progress
-        };
+    void ParticleGroup::ApplySwirlMotion() {
+        ParticlePool::Channels& channels = group_.particles.GetChannels();
+        const uint32_t count = group_.particles.GetCount();
+        const float swirlingSpeed = definition_.advanced.motion.swirlingSpeed;
+        const float expansionRate = definition_.advanced.motion.expansionRate;
 
-        // エミッタの回転をクォータニオンに変換
+        // エミッタの回転をクォータニオンに変換（全パーティクル共通）
         Quaternion emitterRotation = Math::QuaternionFromVector(group_.transform.rotate);
 
-        // ワールド空間に変換して適用
-        Vector3 worldSwirlingOffset = Math::RotateVector(localSwirlingOffset, emitterRotation);
-        particle.transform.translate += worldSwirlingOffset * kDeltaTime_;
+        for (uint32_t i = 0; i < count; ++i) {
+            // 進行度の計算
+            float progress = channels.currentTime[i] / channels.lifeTime[i];
+            float swirl = channels.currentTime[i] * swirlingSpeed;
+
+            // エミッタの回転を考慮したローカル空間での渦巻き
+            Vector3 localSwirlingOffset = {
+                std::cos(swirl) * expansionRate * progress,
+                std::sin(swirl * 1.3f) * expansionRate * progress * 0.5f,
+                std::sin(swirl) * expansionRate * progress
+            };
+
+            // ワールド空間に変換して適用
+            Vector3 worldSwirlingOffset = Math::RotateVector(localSwirlingOffset, emitterRotation) * kDeltaTime_;
+            channels.translate[0][i] += worldSwirlingOffset.x;
+            channels.translate[1][i] += worldSwirlingOffset.y;
+            channels.translate[2][i] += worldSwirlingOffset.z;
+        }
     }
 
     ///-------------------------------------------/// 
     /// 回転影響の適用
     ///-------------------------------------------///
-    void ParticleGroup::ApplyRotationInfluence(ParticleData& particle, float progress) {
-        progress;
-        // 現在と前回のエミッタ回転を比較
+    void ParticleGroup::ApplyRotationInfluence() {
+        ParticlePool::Channels& channels = group_.particles.GetChannels();
+        const uint32_t count = group_.particles.GetCount();
+
+        // 現在と前回のエミッタ回転を比較（全パーティクル共通）
         Quaternion currentRot = Math::QuaternionFromVector(group_.transform.rotate);
         Quaternion previousRot = Math::QuaternionFromVector(group_.previousEmitterRotation);
         Quaternion rotationDelta = Multiply(currentRot, Math::Conjugate(previousRot));
-
-        // 回転による遠心力的な速度を追加
-        Vector3 rotationalVelocity = Math::RotateVector(
-            particle.velocity * definition_.advanced.motion.rotationInfluence,
-            rotationDelta
-        );
-
-        particle.transform.translate += rotationalVelocity * kDeltaTime_ * 0.3f;
+        const float scale = definition_.advanced.motion.rotationInfluence * kDeltaTime_ * 0.3f;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            // 回転による遠心力的な速度を追加
+            Vector3 velocity = { channels.velocity[0][i], channels.velocity[1][i], channels.velocity[2][i] };
+            Vector3 rotationalVelocity = Math::RotateVector(velocity, rotationDelta) * scale;
+            channels.translate[0][i] += rotationalVelocity.x;
+            channels.translate[1][i] += rotationalVelocity.y;
+            channels.translate[2][i] += rotationalVelocity.z;
+        }
     }
-}
+}
\ No newline at end of file
@@ -3,10 +3,10 @@
 #include "ParticleSetUp.h"
 #include "ParticleDefinition.h"
 #include "ParticleParameter.h"
+#include "ParticlePool.h"
+#include "ParticleRandom.h"
 #include "Engine/DataInfo/ParticleData.h"
 // c++
-#include <list>
-#include <random>
 #include <memory>
 
 namespace MiiEngine {
@@ -27,13 +27,35 @@ namespace MiiEngine {
 		/// </summary>
 		/// <param name="translate">発生位置</param>
 		/// <param name="definition">パーティクル定義</param>
-		void Initialize(const Vector3& translate, const ParticleDefinition& definition);
+		/// <param name="seed">乱数のシード（同じ値を渡すと同じ発生を再現できる）</param>
+		void Initialize(const Vector3& translate, const ParticleDefinition& definition, uint64_t seed);
+
+		/// <summary>
+		/// 発生させずに描画用バッファとプールだけを確保（グループプールの事前確保用）
+		/// </summary>
+		/// <param name="definition">パーティクル定義</param>
+		void Prewarm(const ParticleDefinition& definition);
+
+		/// <summary>
+		/// 描画用バッファを作らずに初期化（CPU だけで動かすベンチマーク用。カメラとデルタタイムのサービスも使わない）
+		/// 発生は最初の Update(deltaTime) から行い、インスタンシングデータは CPU 側の配列に書き込む
+		/// </summary>
+		/// <param name="translate">発生位置</param>
+		/// <param name="definition">パーティクル定義</param>
+		/// <param name="seed">乱数のシード</param>
+		void InitializeHeadless(const Vector3& translate, const ParticleDefinition& definition, uint64_t seed);
 
 		/// <summary>
 		/// 更新処理
 		/// </summary>
 		void Update();
 
+		/// <summary>
+		/// デルタタイムを指定した更新処理（固定ステップで進める用）
+		/// </summary>
+		/// <param name="deltaTime">デルタタイム</param>
+		void Update(float deltaTime);
+
 		/// <summary>
 		/// 描画処理
 		/// </summary>
@@ -94,6 +116,12 @@ namespace MiiEngine {
 		/// <param name="rotate">設定する回転ベクトル。const Vector3& で参照渡しされます。</param>
 		void SetEmitterRotate(const Vector3& rotate);
 
+		/// <summary>
+		/// 全体の予算による発生数の倍率を設定（ParticleManager が更新前に毎フレーム設定する）
+		/// </summary>
+		/// <param name="scale">倍率（0～1）</param>
+		void SetBudgetScale(float scale);
+
 	public: /// ===Getter=== ///
 
 		/// <summary>
@@ -111,12 +139,37 @@ namespace MiiEngine {
 		/// </summary>
 		const Vector3& GetEmitterPosition() const;
 
+		/// <summary>
+		/// 初期化時に渡された乱数のシードを取得（リプレイ用）
+		/// </summary>
+		uint64_t GetSeed() const;
+
+		/// <summary>
+		/// 今フレームは視錐台の外でカリングされたか
+		/// </summary>
+		bool IsCulled() const;
+
+		/// <summary>
+		/// 予算による発生数の倍率を取得
+		/// </summary>
+		float GetBudgetScale() const;
+
+		/// <summary>
+		/// 今フレームに LOD と予算で発生を見送った粒子数を取得
+		/// </summary>
+		uint32_t GetSuppressedCount() const;
+
+		/// <summary>
+		/// 保持できる粒子の最大数を取得
+		/// </summary>
+		uint32_t GetMaxInstance() const;
+
 	private:
 
 		/// ===内部構造体=== ///
 		struct Group {
 			std::unique_ptr<ParticleSetUp> particle;     // パーティクル描画セットアップ
-			std::list<ParticleData> particles;           // パーティクルのリスト
+			ParticlePool particles;                      // パーティクルのプール（maxInstance 分を確保済み）
 			EulerTransform transform;                    // エミッタのTransform
 			EulerTransform cameraTransform;              // カメラのTransform（フォールバック用）
 			uint32_t maxInstance;                        // パーティクルの最大数
@@ -129,26 +182,77 @@ namespace MiiEngine {
 			float trajectoryTimer = 0.0f;                // 軌跡タイマー
 			Vector3 previousEmitterPosition = { 0.0f, 0.0f, 0.0f }; // 前回のエミッタ位置
 			Vector3 previousEmitterRotation = { 0.0f, 0.0f, 0.0f }; // 前回のエミッタ回転
+
+			// LOD・カリング用
+			Matrix4x4 viewProjection{};                  // 今フレームのビュープロジェクション行列
+			bool isCulled = false;                       // 今フレームは視錐台の外か
+			float emissionScale = 1.0f;                  // 距離LODによる発生数の倍率
+			float emissionRemainder = 0.0f;              // 倍率を掛けて切り捨てた発生数の端数
+
+			// 全体の予算用
+			float budgetScale = 1.0f;                    // 予算による発生数の倍率
+			uint32_t suppressedCount = 0;                // 今フレームに発生を見送った数
 		};
 
 		Group group_{};
 		ParticleDefinition definition_;     // パーティクル定義
 		float kDeltaTime_ = 1.0f / 60.0f;   // デルタタイム
-		std::mt19937 randomEngine_;         // 乱数生成器
+		ParticleRandom random_;             // 乱数生成器
+		uint64_t seed_ = 0;                 // 初期化時のシード
 
 		bool isStopped_ = false;		// 停止フラグ
 
+		// 描画用バッファを持たない（InitializeHeadless で初期化した）か
+		bool isHeadless_ = false;
+		// 描画用バッファの代わりに書き込むインスタンシングデータ
+		std::vector<ParticleForGPU> headlessInstances_;
+
 	private:
 
+		/// <summary>
+		/// 定義に合わせて描画用バッファとプールを用意（同じ形のバッファを持っていれば作り直さずに使い回す）
+		/// </summary>
+		void PrepareBuffers(const ParticleDefinition& definition);
+
+		/// <summary>
+		/// 定義・乱数・エミッタ・タイマーなど発生ごとの状態を初期化
+		/// </summary>
+		void ResetState(const Vector3& translate, const ParticleDefinition& definition, uint64_t seed);
+
+		/// <summary>
+		/// 今のバッファを指定した定義でそのまま使えるか
+		/// </summary>
+		bool CanReuseBuffers(const ParticleDefinition& definition) const;
+
 		/// <summary>
 		/// モデルのインスタンシングに対する初期化処理
 		/// </summary>
 		void InstancingInit(const std::string& modelName, const Vector3& translate, const uint32_t maxInstance, shapeType type);
 
 		/// <summary>
-		/// モデルのインスタンシングに対する更新処理
+		/// モデルのインスタンシングに対する更新処理（カメラ行列の計算と全パーティクルの書き込み）
+		/// </summary>
+		void InstancingUpdate();
+
+		/// <summary>
+		/// ビュープロジェクション行列の取得と、視錐台カリング・距離LODの判定
+		/// </summary>
+		void UpdateCulling();
+
+		/// <summary>
+		/// エミッタの境界球の半径（定義に指定がなければ発生範囲・速度・寿命から保守的に求める）
+		/// </summary>
+		float ComputeBoundsRadius() const;
+
+		/// <summary>
+		/// 距離LODと予算の倍率を発生数に掛ける（切り捨てた端数は次回に持ち越す）
+		/// </summary>
+		uint32_t ScaleEmitCount(uint32_t count);
+
+		/// <summary>
+		/// 視錐台の外にいる間の更新（発生と移動を止め、寿命だけ進める）
 		/// </summary>
-		void InstancingUpdate(std::list<ParticleData>::iterator it);
+		void FastForward();
 
 		/// <summary>
 		/// パーティクル生成（パラメータ駆動型）
@@ -168,11 +272,11 @@ namespace MiiEngine {
 		/// <summary>
 		/// 渦巻き運動を適用
 		/// </summary>
-		void ApplySwirlMotion(ParticleData& particle, float progress);
+		void ApplySwirlMotion();
 
 		/// <summary>
 		/// エミッタの回転影響を適用
 		/// </summary>
-		void ApplyRotationInfluence(ParticleData& particle, float progress);
+		void ApplyRotationInfluence();
 	};
 }
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+/// ===Include=== ///
+// c++
+#include <cstdint>
+
+namespace MiiEngine {
+    ///=====================================================///
+    /// パーティクル定義の番号
+    /// 名前から1回だけ引いておき、以降の発生・停止・パラメータ変更は番号で行う。
+    /// 定義を削除しても同じ名前には同じ番号が割り当てられたまま
+    ///=====================================================///
+    enum class ParticleDefinitionId : uint32_t {
+        kInvalid = 0xFFFFFFFFu,
+    };
+
+    ///=====================================================///
+    /// 発生させたグループのハンドル
+    /// グループが終了してプールへ戻ると世代が進み、古いハンドルでの操作は無視される
+    ///=====================================================///
+    struct ParticleHandle {
+        static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+        uint32_t index = kInvalidIndex; // ハンドル表の番号
+        uint32_t generation = 0;        // 発生時の世代
+    };
+}
@@ -0,0 +1,286 @@
+#include "ParticleKernel.h"
+// SIMD
+#include "Math/SimdFloat.h"
+// c++
+#include <array>
+#include <utility>
+
+namespace MiiEngine::ParticleKernel {
+    namespace {
+        // 特殊化した関数の型
+        using IntegrateFunction = void(*)(ParticlePool::Channels&, uint32_t, const Params&);
+
+        ///-------------------------------------------///
+        /// V::kWidth 個のパーティクルを進める
+        ///-------------------------------------------///
+        template<class V, uint32_t Features>
+        void Step(ParticlePool::Channels& c, uint32_t i, const Params& p) {
+            const V deltaTime = V::Set1(p.deltaTime);
+
+            /// ===速度と位置（位置は減衰前の速度で進める）=== ///
+            for (int axis = 0; axis < 3; ++axis) {
+                V velocity = V::Load(&c.velocity[axis][i]) + V::Set1(p.acceleration[axis]);
+                V translate = V::Load(&c.translate[axis][i]) + velocity * deltaTime;
+                if constexpr ((Features & kFollowEmitter) != 0) {
+                    translate = translate + V::Set1(p.followOffset[axis]);
+                }
+                if constexpr ((Features & kVelocityDamping) != 0) {
+                    velocity = velocity * V::Set1(p.damping);
+                }
+                velocity.Store(&c.velocity[axis][i]);
+                translate.Store(&c.translate[axis][i]);
+            }
+
+            /// ===時間=== ///
+            const V currentTime = V::Load(&c.currentTime[i]) + deltaTime;
+            currentTime.Store(&c.currentTime[i]);
+
+            /// ===寿命に応じた補間=== ///
+            if constexpr ((Features & (kColorGradient | kScaleAnimation)) != 0) {
+                const V t = currentTime / V::Load(&c.lifeTime[i]);
+                if constexpr ((Features & kColorGradient) != 0) {
+                    for (int k = 0; k < 4; ++k) {
+                        (V::Set1(p.colorStart[k]) + V::Set1(p.colorRange[k]) * t).Store(&c.color[k][i]);
+                    }
+                }
+                if constexpr ((Features & kScaleAnimation) != 0) {
+                    for (int axis = 0; axis < 3; ++axis) {
+                        (V::Set1(p.scaleStart[axis]) + V::Set1(p.scaleRange[axis]) * t).Store(&c.scale[axis][i]);
+                    }
+                }
+            }
+
+            /// ===ビルボード回転=== ///
+            if constexpr ((Features & kBillboardRotation) != 0) {
+                (V::Load(&c.rotate[2][i]) + V::Set1(p.billboardRotation)).Store(&c.rotate[2][i]);
+            }
+        }
+
+        ///-------------------------------------------///
+        /// 全パーティクルを進める（端数はスカラーで処理）
+        ///-------------------------------------------///
+        template<class V, uint32_t Features>
+        void Run(ParticlePool::Channels& c, uint32_t count, const Params& p) {
+            uint32_t i = 0;
+            for (; i + V::kWidth <= count; i += V::kWidth) {
+                Step<V, Features>(c, i, p);
+            }
+            for (; i < count; ++i) {
+                Step<Simd::Float1, Features>(c, i, p);
+            }
+        }
+
+        ///-------------------------------------------///
+        /// 命令セットごとの特殊化の表
+        ///-------------------------------------------///
+        template<class V, uint32_t... Features>
+        constexpr std::array<IntegrateFunction, kVariantCount> MakeTable(std::integer_sequence<uint32_t, Features...>) {
+            return { &Run<V, Features>... };
+        }
+        constexpr auto kScalarTable = MakeTable<Simd::Float1>(std::make_integer_sequence<uint32_t, kVariantCount>{});
+        constexpr auto kSSETable = MakeTable<Simd::Float4>(std::make_integer_sequence<uint32_t, kVariantCount>{});
+        constexpr auto kAVX2Table = MakeTable<Simd::Float8>(std::make_integer_sequence<uint32_t, kVariantCount>{});
+
+        ///-------------------------------------------///
+        /// 寿命が尽きたパーティクルを探す
+        ///-------------------------------------------///
+        template<class V>
+        uint32_t Find(const ParticlePool::Channels& c, uint32_t begin, uint32_t count) {
+            const float* currentTime = c.currentTime.data();
+            const float* lifeTime = c.lifeTime.data();
+            uint32_t i = begin;
+            // 1つも尽きていないブロックは読み飛ばす
+            for (; i + V::kWidth <= count; i += V::kWidth) {
+                const uint32_t mask = V::MoveMask(CmpLE(V::Load(lifeTime + i), V::Load(currentTime + i)));
+                if (mask != 0) {
+                    for (uint32_t lane = 0; lane < static_cast<uint32_t>(V::kWidth); ++lane) {
+                        if ((mask >> lane) & 1u) {
+                            return i + lane;
+                        }
+                    }
+                }
+            }
+            for (; i < count; ++i) {
+                if (currentTime[i] >= lifeTime[i]) {
+                    return i;
+                }
+            }
+            return count;
+        }
+
+        ///-------------------------------------------///
+        /// 1パーティクル分をそのまま書き込む
+        ///-------------------------------------------///
+        void WriteInstance(const ParticlePool::Channels& c, uint32_t i, ParticleForGPU& out) {
+            out.translate = { c.translate[0][i], c.translate[1][i], c.translate[2][i], 0.0f };
+            out.rotate = { c.rotate[0][i], c.rotate[1][i], c.rotate[2][i], 0.0f };
+            out.scale = { c.scale[0][i], c.scale[1][i], c.scale[2][i], 0.0f };
+            out.color = { c.color[0][i], c.color[1][i], c.color[2][i], c.color[3][i] };
+        }
+
+        ///-------------------------------------------///
+        /// 3成分 + 0 を4パーティクル分転置する
+        ///-------------------------------------------///
+        void Transpose3(const std::vector<float>* channel, uint32_t i, __m128 out[4]) {
+            out[0] = _mm_loadu_ps(channel[0].data() + i);
+            out[1] = _mm_loadu_ps(channel[1].data() + i);
+            out[2] = _mm_loadu_ps(channel[2].data() + i);
+            out[3] = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        }
+    }
+
+    ///-------------------------------------------///
+    /// 有効な処理のフラグ
+    ///-------------------------------------------///
+    uint32_t BuildFeatures(const ParticleDefinition& definition) {
+        uint32_t features = 0;
+        if (definition.appearance.useColorGradient) {
+            features |= kColorGradient;
+        }
+        if (definition.appearance.useScaleAnimation) {
+            features |= kScaleAnimation;
+        }
+        if (definition.advanced.motion.followEmitter) {
+            features |= kFollowEmitter;
+        }
+        if (definition.advanced.motion.velocityDamping < 1.0f) {
+            features |= kVelocityDamping;
+        }
+        if (definition.advanced.motion.enableBillboardRotation) {
+            features |= kBillboardRotation;
+        }
+        return features;
+    }
+
+    ///-------------------------------------------///
+    /// 1フレーム分の定数
+    ///-------------------------------------------///
+    Params BuildParams(const ParticleDefinition& definition, float deltaTime, const Vector3& emitterDelta) {
+        Params params;
+        params.deltaTime = deltaTime;
+
+        // 重力と加速度
+        params.acceleration[0] = definition.physics.acceleration.x * deltaTime;
+        params.acceleration[1] = (definition.physics.acceleration.y + definition.physics.gravity) * deltaTime;
+        params.acceleration[2] = definition.physics.acceleration.z * deltaTime;
+
+        // 色のグラデーション
+        const Vector4& startColor = definition.appearance.startColor;
+        const Vector4& endColor = definition.appearance.endColor;
+        const float start[4] = { startColor.x, startColor.y, startColor.z, startColor.w };
+        const float end[4] = { endColor.x, endColor.y, endColor.z, endColor.w };
+        for (int k = 0; k < 4; ++k) {
+            params.colorStart[k] = start[k];
+            params.colorRange[k] = end[k] - start[k];
+        }
+
+        // スケールアニメーション（開始スケールは範囲の中央）
+        const Vector3 startScale = (definition.appearance.startScaleMin + definition.appearance.startScaleMax) * 0.5f;
+        const Vector3 scaleRange = definition.appearance.endScale - startScale;
+        params.scaleStart[0] = startScale.x;
+        params.scaleStart[1] = startScale.y;
+        params.scaleStart[2] = startScale.z;
+        params.scaleRange[0] = scaleRange.x;
+        params.scaleRange[1] = scaleRange.y;
+        params.scaleRange[2] = scaleRange.z;
+
+        // エミッタ追従
+        const Vector3 followOffset = emitterDelta * definition.advanced.motion.followStrength;
+        params.followOffset[0] = followOffset.x;
+        params.followOffset[1] = followOffset.y;
+        params.followOffset[2] = followOffset.z;
+
+        // 速度減衰とビルボード回転
+        params.damping = definition.advanced.motion.velocityDamping;
+        params.billboardRotation = definition.advanced.motion.billboardRotationSpeed * deltaTime;
+        return params;
+    }
+
+    ///-------------------------------------------///
+    /// 使用できる命令セット
+    ///-------------------------------------------///
+    InstructionSet GetBestInstructionSet() {
+        static const InstructionSet best = Simd::DetectAVX2() ? InstructionSet::AVX2 : InstructionSet::SSE;
+        return best;
+    }
+
+    ///-------------------------------------------///
+    /// 積分
+    ///-------------------------------------------///
+    void Integrate(ParticlePool& pool, uint32_t features, const Params& params, InstructionSet set) {
+        ParticlePool::Channels& channels = pool.GetChannels();
+        const uint32_t count = pool.GetCount();
+        const uint32_t variant = features & (kVariantCount - 1);
+
+        switch (set) {
+        case InstructionSet::AVX2:
+            kAVX2Table[variant](channels, count, params);
+            // 以降のSSE命令で遷移ペナルティが出ないよう上位を消去
+            _mm256_zeroupper();
+            break;
+        case InstructionSet::SSE:
+            kSSETable[variant](channels, count, params);
+            break;
+        default:
+            kScalarTable[variant](channels, count, params);
+            break;
+        }
+    }
+
+    ///-------------------------------------------///
+    /// 寿命が尽きたパーティクルの検索
+    ///-------------------------------------------///
+    uint32_t FindExpired(const ParticlePool::Channels& channels, uint32_t begin, uint32_t count, InstructionSet set) {
+        switch (set) {
+        case InstructionSet::AVX2: {
+            const uint32_t index = Find<Simd::Float8>(channels, begin, count);
+            _mm256_zeroupper();
+            return index;
+        }
+        case InstructionSet::SSE:
+            return Find<Simd::Float4>(channels, begin, count);
+        default:
+            return Find<Simd::Float1>(channels, begin, count);
+        }
+    }
+
+    ///-------------------------------------------///
+    /// インスタンシングデータの書き込み
+    ///-------------------------------------------///
+    void WriteInstances(const ParticlePool::Channels& channels, uint32_t count, ParticleForGPU* out, InstructionSet set) {
+        uint32_t i = 0;
+
+        /// ===4パーティクルずつ転置し、1パーティクル分(64バイト)ずつ連続して書き込む=== ///
+        // 書き込み先はアップロードヒープ（書き込み結合メモリ）なので、キャッシュラインを順に埋める
+        if (set != InstructionSet::Scalar) {
+            for (; i + 4 <= count; i += 4) {
+                __m128 translate[4];
+                __m128 rotate[4];
+                __m128 scale[4];
+                __m128 color[4];
+                Transpose3(channels.translate, i, translate);
+                Transpose3(channels.rotate, i, rotate);
+                Transpose3(channels.scale, i, scale);
+                color[0] = _mm_loadu_ps(channels.color[0].data() + i);
+                color[1] = _mm_loadu_ps(channels.color[1].data() + i);
+                color[2] = _mm_loadu_ps(channels.color[2].data() + i);
+                color[3] = _mm_loadu_ps(channels.color[3].data() + i);
+                _MM_TRANSPOSE4_PS(color[0], color[1], color[2], color[3]);
+
+                for (uint32_t lane = 0; lane < 4; ++lane) {
+                    ParticleForGPU& instance = out[i + lane];
+                    _mm_storeu_ps(&instance.translate.x, translate[lane]);
+                    _mm_storeu_ps(&instance.rotate.x, rotate[lane]);
+                    _mm_storeu_ps(&instance.scale.x, scale[lane]);
+                    _mm_storeu_ps(&instance.color.x, color[lane]);
+                }
+            }
+        }
+
+        /// ===端数=== ///
+        for (; i < count; ++i) {
+            WriteInstance(channels, i, out[i]);
+        }
+    }
+}
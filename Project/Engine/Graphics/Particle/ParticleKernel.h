@@ -0,0 +1,94 @@
+#pragma once
+/// ===Include=== ///
+#include "ParticleDefinition.h"
+#include "ParticlePool.h"
+// c++
+#include <cstdint>
+
+///=====================================================///
+/// ParticleKernel
+/// プールのSoA配列をまとめて進める積分処理。有効な機能の組み合わせごとに
+/// 特殊化した関数を スカラー / SSE(4レーン) / AVX2(8レーン) で用意し、
+/// 毎パーティクルの分岐をなくす
+///=====================================================///
+namespace MiiEngine::ParticleKernel {
+
+    /// ===有効にする処理（組み合わせごとに関数を特殊化する）=== ///
+    enum Feature : uint32_t {
+        kColorGradient = 1u << 0,       // 寿命に応じた色の補間
+        kScaleAnimation = 1u << 1,      // 寿命に応じたスケールの補間
+        kFollowEmitter = 1u << 2,       // エミッタの移動量を加算
+        kVelocityDamping = 1u << 3,     // 速度の減衰
+        kBillboardRotation = 1u << 4,   // Z軸回転
+    };
+    // 特殊化の数
+    inline constexpr uint32_t kVariantCount = 1u << 5;
+
+    /// ===使用する命令セット=== ///
+    enum class InstructionSet {
+        Scalar,
+        SSE,
+        AVX2,
+    };
+
+    /// ===1フレーム分の定数（deltaTime を掛けた値を持つ）=== ///
+    struct Params {
+        float deltaTime = 0.0f;
+        float acceleration[3] = {};     // (加速度 + 重力) * deltaTime
+        float colorStart[4] = {};
+        float colorRange[4] = {};       // 終了色 - 開始色
+        float scaleStart[3] = {};
+        float scaleRange[3] = {};       // 終了スケール - 開始スケール
+        float followOffset[3] = {};     // エミッタの移動量 * 追従強度
+        float damping = 1.0f;
+        float billboardRotation = 0.0f; // ビルボード回転速度 * deltaTime
+    };
+
+    /// <summary>
+    /// 定義から有効な処理のフラグを作成
+    /// </summary>
+    /// <param name="definition">パーティクルの定義データ</param>
+    /// <returns>Feature の組み合わせ</returns>
+    uint32_t BuildFeatures(const ParticleDefinition& definition);
+
+    /// <summary>
+    /// 定義から1フレーム分の定数を作成
+    /// </summary>
+    /// <param name="definition">パーティクルの定義データ</param>
+    /// <param name="deltaTime">デルタタイム</param>
+    /// <param name="emitterDelta">前フレームからのエミッタの移動量</param>
+    Params BuildParams(const ParticleDefinition& definition, float deltaTime, const Vector3& emitterDelta);
+
+    /// <summary>
+    /// この CPU で使用できる最も幅の広い命令セット
+    /// </summary>
+    InstructionSet GetBestInstructionSet();
+
+    /// <summary>
+    /// プール内の全パーティクルの速度・位置・時間・色・スケールを進める
+    /// </summary>
+    /// <param name="pool">更新するプール</param>
+    /// <param name="features">有効にする処理（BuildFeatures の戻り値）</param>
+    /// <param name="params">1フレーム分の定数</param>
+    /// <param name="set">使用する命令セット</param>
+    void Integrate(ParticlePool& pool, uint32_t features, const Params& params, InstructionSet set);
+
+    /// <summary>
+    /// 寿命が尽きた最初のパーティクルを探す
+    /// </summary>
+    /// <param name="channels">探すプールの配列</param>
+    /// <param name="begin">探し始める番号</param>
+    /// <param name="count">生きているパーティクル数</param>
+    /// <param name="set">使用する命令セット</param>
+    /// <returns>見つかった番号（ない場合は count）</returns>
+    uint32_t FindExpired(const ParticlePool::Channels& channels, uint32_t begin, uint32_t count, InstructionSet set);
+
+    /// <summary>
+    /// SoA配列をGPU送信用の形式に並べ替えて書き込む（4パーティクルずつ転置する）
+    /// </summary>
+    /// <param name="channels">書き込むプールの配列</param>
+    /// <param name="count">書き込むパーティクル数</param>
+    /// <param name="out">書き込み先（マップ済みのインスタンシングバッファ）</param>
+    /// <param name="set">使用する命令セット（Scalar 以外は SSE で処理）</param>
+    void WriteInstances(const ParticlePool::Channels& channels, uint32_t count, ParticleForGPU* out, InstructionSet set);
+}
@@ -0,0 +1,136 @@
+#include "ParticlePool.h"
+#include "ParticleKernel.h"
+
+namespace MiiEngine {
+    namespace {
+        // 1つの成分を移動
+        void MoveElement(std::vector<float>& channel, uint32_t to, uint32_t from) {
+            channel[to] = channel[from];
+        }
+    }
+
+    ///-------------------------------------------///
+    /// Getter
+    ///-------------------------------------------///
+    ParticlePool::Channels& ParticlePool::GetChannels() { return channels_; }
+    const ParticlePool::Channels& ParticlePool::GetChannels() const { return channels_; }
+    uint32_t ParticlePool::GetCount() const { return count_; }
+    uint32_t ParticlePool::GetCapacity() const { return capacity_; }
+    bool ParticlePool::IsFull() const { return count_ >= capacity_; }
+    bool ParticlePool::IsEmpty() const { return count_ == 0; }
+
+    ///-------------------------------------------///
+    /// 初期化
+    ///-------------------------------------------///
+    void ParticlePool::Initialize(uint32_t capacity) {
+        capacity_ = capacity;
+        count_ = 0;
+
+        // 発生時に確保しないよう最大数分を確保しておく
+        for (int i = 0; i < 3; ++i) {
+            channels_.translate[i].assign(capacity, 0.0f);
+            channels_.rotate[i].assign(capacity, 0.0f);
+            channels_.scale[i].assign(capacity, 0.0f);
+            channels_.velocity[i].assign(capacity, 0.0f);
+        }
+        for (int i = 0; i < 4; ++i) {
+            channels_.color[i].assign(capacity, 0.0f);
+        }
+        channels_.currentTime.assign(capacity, 0.0f);
+        channels_.lifeTime.assign(capacity, 0.0f);
+    }
+
+    ///-------------------------------------------///
+    /// 追加
+    ///-------------------------------------------///
+    bool ParticlePool::Add(const ParticleData& particle) {
+        if (IsFull()) {
+            return false;
+        }
+
+        const uint32_t index = count_++;
+        const float translate[3] = { particle.transform.translate.x, particle.transform.translate.y, particle.transform.translate.z };
+        const float rotate[3] = { particle.transform.rotate.x, particle.transform.rotate.y, particle.transform.rotate.z };
+        const float scale[3] = { particle.transform.scale.x, particle.transform.scale.y, particle.transform.scale.z };
+        const float velocity[3] = { particle.velocity.x, particle.velocity.y, particle.velocity.z };
+        const float color[4] = { particle.color.x, particle.color.y, particle.color.z, particle.color.w };
+        for (int i = 0; i < 3; ++i) {
+            channels_.translate[i][index] = translate[i];
+            channels_.rotate[i][index] = rotate[i];
+            channels_.scale[i][index] = scale[i];
+            channels_.velocity[i][index] = velocity[i];
+        }
+        for (int i = 0; i < 4; ++i) {
+            channels_.color[i][index] = color[i];
+        }
+        channels_.currentTime[index] = particle.currentTime;
+        channels_.lifeTime[index] = particle.lifeTime;
+        return true;
+    }
+
+    ///-------------------------------------------///
+    /// まとめて追加
+    ///-------------------------------------------///
+    uint32_t ParticlePool::Append(uint32_t count) {
+        const uint32_t added = (count < capacity_ - count_) ? count : capacity_ - count_;
+        count_ += added;
+        return added;
+    }
+
+    ///-------------------------------------------///
+    /// 削除
+    ///-------------------------------------------///
+    void ParticlePool::RemoveAt(uint32_t index) {
+        if (index >= count_) {
+            return;
+        }
+
+        /// ===末尾のパーティクルで穴を埋める=== ///
+        const uint32_t last = --count_;
+        if (index == last) {
+            return;
+        }
+        for (int i = 0; i < 3; ++i) {
+            MoveElement(channels_.translate[i], index, last);
+            MoveElement(channels_.rotate[i], index, last);
+            MoveElement(channels_.scale[i], index, last);
+            MoveElement(channels_.velocity[i], index, last);
+        }
+        for (int i = 0; i < 4; ++i) {
+            MoveElement(channels_.color[i], index, last);
+        }
+        MoveElement(channels_.currentTime, index, last);
+        MoveElement(channels_.lifeTime, index, last);
+    }
+
+    ///-------------------------------------------///
+    /// 寿命が尽きたパーティクルの削除
+    ///-------------------------------------------///
+    uint32_t ParticlePool::RemoveExpired() {
+        const uint32_t before = count_;
+        const ParticleKernel::InstructionSet set = ParticleKernel::GetBestInstructionSet();
+
+        // 入れ替えてきた末尾の要素も判定するため、削除した位置から探し直す
+        uint32_t index = ParticleKernel::FindExpired(channels_, 0, count_, set);
+        while (index < count_) {
+            RemoveAt(index);
+            index = ParticleKernel::FindExpired(channels_, index, count_, set);
+        }
+        return before - count_;
+    }
+
+    ///-------------------------------------------///
+    /// 経過時間だけを進める
+    ///-------------------------------------------///
+    void ParticlePool::AdvanceLifetimes(float deltaTime) {
+        float* currentTime = channels_.currentTime.data();
+        for (uint32_t i = 0; i < count_; ++i) {
+            currentTime[i] += deltaTime;
+        }
+    }
+
+    ///-------------------------------------------///
+    /// 全削除
+    ///-------------------------------------------///
+    void ParticlePool::Clear() { count_ = 0; }
+}
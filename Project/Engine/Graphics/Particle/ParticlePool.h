@@ -0,0 +1,93 @@
+#pragma once
+/// ===Include=== ///
+#include "Engine/DataInfo/ParticleData.h"
+// c++
+#include <cstdint>
+#include <vector>
+
+namespace MiiEngine {
+    ///=====================================================///
+    /// パーティクルプール
+    /// 最大数分の配列を初期化時に確保し、成分ごとのSoA配列に詰めて保持する。
+    /// 削除は末尾の要素で穴を埋めるため、生きているパーティクルは常に [0, count) に並ぶ
+    ///=====================================================///
+    class ParticlePool {
+    public:
+
+        /// ===成分ごとのSoA配列=== ///
+        struct Channels {
+            std::vector<float> translate[3];
+            std::vector<float> rotate[3];
+            std::vector<float> scale[3];
+            std::vector<float> velocity[3];
+            std::vector<float> color[4];
+            std::vector<float> currentTime;
+            std::vector<float> lifeTime;
+        };
+
+        ParticlePool() = default;
+        ~ParticlePool() = default;
+
+        /// <summary>
+        /// 初期化処理（最大数分の配列を確保）
+        /// </summary>
+        /// <param name="capacity">保持できるパーティクルの最大数</param>
+        void Initialize(uint32_t capacity);
+
+        /// <summary>
+        /// パーティクルを末尾に追加
+        /// </summary>
+        /// <param name="particle">追加するパーティクルデータ</param>
+        /// <returns>追加できた場合は true（満杯の場合は false）</returns>
+        bool Add(const ParticleData& particle);
+
+        /// <summary>
+        /// 末尾に複数個分の領域を追加（中身は呼び出し側が GetChannels() から書き込む）
+        /// </summary>
+        /// <param name="count">追加したい数</param>
+        /// <returns>追加できた数（空きが足りない場合は空きの数）。追加した領域は [追加前の数, 追加前の数 + 戻り値)</returns>
+        uint32_t Append(uint32_t count);
+
+        /// <summary>
+        /// 指定した番号のパーティクルを削除（末尾のパーティクルが空いた位置に移動します）
+        /// </summary>
+        /// <param name="index">削除する番号</param>
+        void RemoveAt(uint32_t index);
+
+        /// <summary>
+        /// 寿命が尽きたパーティクルをまとめて削除
+        /// </summary>
+        /// <returns>削除した数</returns>
+        uint32_t RemoveExpired();
+
+        /// <summary>
+        /// 経過時間だけを進める（画面外のグループで移動などを省く用）
+        /// </summary>
+        /// <param name="deltaTime">デルタタイム</param>
+        void AdvanceLifetimes(float deltaTime);
+
+        /// <summary>
+        /// 全てのパーティクルを削除（容量は保持）
+        /// </summary>
+        void Clear();
+
+    public: /// ===Getter=== ///
+        // 成分ごとの配列
+        Channels& GetChannels();
+        const Channels& GetChannels() const;
+        // 生きているパーティクル数
+        uint32_t GetCount() const;
+        // 最大数
+        uint32_t GetCapacity() const;
+        // 満杯かどうか
+        bool IsFull() const;
+        // 空かどうか
+        bool IsEmpty() const;
+
+    private: /// ===変数=== ///
+
+        Channels channels_;
+        uint32_t count_ = 0;
+        uint32_t capacity_ = 0;
+    };
+}
@@ -0,0 +1,73 @@
+#include "ParticleRandom.h"
+
+namespace MiiEngine {
+    namespace {
+        // PCG の線形合同法の乗数
+        constexpr uint64_t kMultiplier = 6364136223846793005ull;
+        // 2^-24（仮数部に収まる上位24bitを [0, 1) にする）
+        constexpr float kToUnitFloat = 1.0f / 16777216.0f;
+    }
+
+    ///-------------------------------------------///
+    /// シード設定
+    ///-------------------------------------------///
+    void ParticleRandom::Seed(uint64_t seed, uint64_t stream) {
+        // 増分は奇数である必要がある
+        increment_ = (stream << 1u) | 1u;
+        state_ = 0;
+        NextUInt();
+        state_ += seed;
+        NextUInt();
+    }
+
+    ///-------------------------------------------///
+    /// 32bit の乱数
+    ///-------------------------------------------///
+    uint32_t ParticleRandom::NextUInt() {
+        const uint64_t old = state_;
+        state_ = old * kMultiplier + increment_;
+
+        // 上位ビットを xorshift して、上位5bitで決まる量だけ回転する
+        const uint32_t xorShifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+        const uint32_t rotation = static_cast<uint32_t>(old >> 59u);
+        return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31u));
+    }
+
+    ///-------------------------------------------///
+    /// 64bit の乱数
+    ///-------------------------------------------///
+    uint64_t ParticleRandom::NextUInt64() {
+        const uint64_t high = NextUInt();
+        return (high << 32u) | NextUInt();
+    }
+
+    ///-------------------------------------------///
+    /// [0, 1) の一様乱数
+    ///-------------------------------------------///
+    float ParticleRandom::NextFloat() {
+        return static_cast<float>(NextUInt() >> 8u) * kToUnitFloat;
+    }
+
+    ///-------------------------------------------///
+    /// [min, max) の一様乱数
+    ///-------------------------------------------///
+    float ParticleRandom::Range(float min, float max) {
+        return min + (max - min) * NextFloat();
+    }
+    Vector3 ParticleRandom::Range(const Vector3& min, const Vector3& max) {
+        const float x = Range(min.x, max.x);
+        const float y = Range(min.y, max.y);
+        const float z = Range(min.z, max.z);
+        return { x, y, z };
+    }
+
+    ///-------------------------------------------///
+    /// 配列をまとめて埋める
+    ///-------------------------------------------///
+    void ParticleRandom::FillRange(float* out, uint32_t count, float min, float max) {
+        const float range = max - min;
+        for (uint32_t i = 0; i < count; ++i) {
+            out[i] = min + range * NextFloat();
+        }
+    }
+}
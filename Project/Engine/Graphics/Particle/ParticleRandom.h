@@ -0,0 +1,67 @@
+#pragma once
+/// ===Include=== ///
+// Math
+#include "Math/Vector3.h"
+// c++
+#include <cstdint>
+
+namespace MiiEngine {
+    ///=====================================================///
+    /// パーティクル用の乱数生成器（PCG32 XSH-RR）
+    /// 状態は 16 バイトだけで、同じシードとストリームからは常に同じ列を返す。
+    /// 分布オブジェクトを作らず [min, max) の一様分布を直接求める
+    ///=====================================================///
+    class ParticleRandom {
+    public:
+
+        ParticleRandom() = default;
+        ~ParticleRandom() = default;
+
+        /// <summary>
+        /// シードの設定（同じ値を設定すると同じ列を再現できる）
+        /// </summary>
+        /// <param name="seed">シード</param>
+        /// <param name="stream">ストリーム番号（同じシードでも異なる列を得たい場合に変える）</param>
+        void Seed(uint64_t seed, uint64_t stream = 0);
+
+        /// <summary>
+        /// 32bit の乱数
+        /// </summary>
+        uint32_t NextUInt();
+
+        /// <summary>
+        /// 64bit の乱数（子の生成器のシード用）
+        /// </summary>
+        uint64_t NextUInt64();
+
+        /// <summary>
+        /// [0, 1) の一様乱数
+        /// </summary>
+        float NextFloat();
+
+        /// <summary>
+        /// [min, max) の一様乱数
+        /// </summary>
+        float Range(float min, float max);
+
+        /// <summary>
+        /// 成分ごとに [min, max) の一様乱数
+        /// </summary>
+        Vector3 Range(const Vector3& min, const Vector3& max);
+
+        /// <summary>
+        /// 配列を [min, max) の一様乱数でまとめて埋める（SoA配列の1成分を一度に作る用）
+        /// </summary>
+        /// <param name="out">書き込み先</param>
+        /// <param name="count">個数</param>
+        /// <param name="min">最小値</param>
+        /// <param name="max">最大値</param>
+        void FillRange(float* out, uint32_t count, float min, float max);
+
+    private: /// ===変数=== ///
+
+        // PCG の推奨初期値
+        uint64_t state_ = 0x853c49e6748fea9bull;
+        uint64_t increment_ = 0xda3e39cb94b95bdbull;
+    };
+}
@@ -31,11 +31,13 @@ namespace MiiEngine {
 	/// Setter
 	///-------------------------------------------///
 	// Texture
-	void ParticleSetUp::SetTexture(const std::string& fileName) { modelData_.material.textureFilePath = fileName; }
+	void ParticleSetUp::SetTexture(const std::string& fileName) { textureFilePath_ = fileName; }
 	// Material
 	void ParticleSetUp::SetMaterialData(const Vector4& color, const Matrix4x4& uvTransform) { common_->SetMaterialData(color, uvTransform); }
+	// Camera
+	void ParticleSetUp::SetViewProjection(const Matrix4x4& viewProjection) { common_->SetViewProjection(viewProjection); }
 	// instancing
-	void ParticleSetUp::SetInstancingData(size_t index, const Vector4& color, const Matrix4x4& WVP, const Matrix4x4& World) { common_->SetInstancingData(index, color, WVP, World); }
+	uint32_t ParticleSetUp::WriteInstances(const ParticlePool& pool) { return common_->WriteInstances(pool); }
 
 
 	///-------------------------------------------/// 
@@ -49,8 +51,9 @@ namespace MiiEngine {
 		// 引数の値を代入
 		kNumMaxInstance_ = kNumMaxInstance;
 
-		/// ===モデル読み込み=== ///
-		modelData_ = Service::GraphicsResourceGetter::GetModelData(filename); // ファイルパス
+		/// ===モデル読み込み（共有のデータからバッファへコピーするだけなので保持しない）=== ///
+		std::shared_ptr<const ModelData> modelData = Service::GraphicsResourceGetter::GetModelData(filename); // ファイルパス
+		textureFilePath_ = modelData->material.textureFilePath;
 
 		/// ===生成=== ///
 		vertex_ = std::make_unique<VertexBuffer3D>();
@@ -58,8 +61,8 @@ namespace MiiEngine {
 		common_ = std::make_unique<ParticleCommon>();
 
 		// 円形の場合は必要な頂点数とインデックス数を計算
-		size_t vertexCount = modelData_.vertices.size();
-		size_t indexCount = modelData_.indices.size();
+		size_t vertexCount = modelData->vertices.size();
+		size_t indexCount = modelData->indices.size();
 
 		if (type == shapeType::kCircle) {
 			const uint32_t kRingDivide = 32;
@@ -76,7 +79,7 @@ namespace MiiEngine {
 		vertex_->Create(device, sizeof(VertexData3D) * vertexCount);
 		vertex_->GetBuffer()->Map(0, nullptr, reinterpret_cast<void**>(&vertexData_));
 		// メモリコピー
-		std::memcpy(vertexData_, modelData_.vertices.data(), sizeof(VertexData3D) * modelData_.vertices.size());
+		std::memcpy(vertexData_, modelData->vertices.data(), sizeof(VertexData3D) * modelData->vertices.size());
 		// view
 		vertexBufferView_.BufferLocation = vertex_->GetBuffer()->GetGPUVirtualAddress();
 		vertexBufferView_.SizeInBytes = UINT(sizeof(VertexData3D) * vertexCount);
@@ -86,7 +89,7 @@ namespace MiiEngine {
 		index_->Create(device, sizeof(uint32_t) * indexCount);
 		index_->GetBuffer()->Map(0, nullptr, reinterpret_cast<void**>(&indexData_));
 		// メモリコピー
-		std::memcpy(indexData_, modelData_.indices.data(), sizeof(uint32_t) * modelData_.indices.size());
+		std::memcpy(indexData_, modelData->indices.data(), sizeof(uint32_t) * modelData->indices.size());
 		// view
 		indexBufferView_.BufferLocation = index_->GetBuffer()->GetGPUVirtualAddress();
 		indexBufferView_.SizeInBytes = UINT(sizeof(uint32_t) * indexCount);
@@ -101,9 +104,8 @@ namespace MiiEngine {
 			SetVertexBufferCylinder();
 		}
 
-		// 頂点数とインデックス数を保存
-		modelData_.vertices.resize(vertexCount);
-		modelData_.indices.resize(indexCount);
+		// インデックス数を保存
+		indexCount_ = static_cast<uint32_t>(indexCount);
 
 		/// ===SetUp=== ///
 		common_->Initialize(device, kNumMaxInstance_);
@@ -140,9 +142,9 @@ namespace MiiEngine {
 		// Instancingの設定
 		commandList->SetGraphicsRootDescriptorTable(1, srvData_.srvHandleGPU);
 		// テクスチャの設定
-		Service::Render::SetGraphicsRootDescriptorTable(commandList, 2, modelData_.material.textureFilePath);
+		Service::Render::SetGraphicsRootDescriptorTable(commandList, 2, textureFilePath_);
 		// 描画（Drawコール）
-		commandList->DrawIndexedInstanced(UINT(modelData_.indices.size()), instance, 0, 0, 0);
+		commandList->DrawIndexedInstanced(UINT(indexCount_), instance, 0, 0, 0);
 	}
 
 	///-------------------------------------------/// 
@@ -8,6 +8,7 @@
 #include "Engine/DataInfo/PipelineStateObjectType.h"
 // c++
 #include <memory>
+#include <string>
 
 namespace MiiEngine {
 	/// ===前方宣言=== ///
@@ -43,8 +44,15 @@ namespace MiiEngine {
 		void SetTexture(const std::string& fileName);
 		// Material
 		void SetMaterialData(const Vector4& color, const Matrix4x4& uvTransform);
-		// Instancing
-		void SetInstancingData(size_t index, const Vector4& color, const Matrix4x4& WVP, const Matrix4x4& World);
+		// Camera
+		void SetViewProjection(const Matrix4x4& viewProjection);
+
+		/// <summary>
+		/// プールの全パーティクルをインスタンシングバッファへ直接書き込む
+		/// </summary>
+		/// <param name="pool">書き込むパーティクルのプール</param>
+		/// <returns>書き込んだインスタンス数</returns>
+		uint32_t WriteInstances(const ParticlePool& pool);
 
 	private:
 		/// ===SRV=== ///
@@ -70,7 +78,8 @@ namespace MiiEngine {
 		D3D12_INDEX_BUFFER_VIEW indexBufferView_{};
 
 		/// ===モデルデータ=== ///
-		ModelData modelData_;
+		std::string textureFilePath_; // 描画に使うテクスチャ（初期化時はモデルのテクスチャ）
+		uint32_t indexCount_ = 0;     // 描画するインデックス数
 
 		/// ===モデル情報=== ///
 		uint32_t kNumMaxInstance_;
@@ -34,6 +34,7 @@ namespace MiiEngine {
 		{ PipelineType::Ocean,			 { L"Ocean/Ocean.VS.hlsl",           L"Ocean/Ocean.PS.hlsl"}},
 		{ PipelineType::FFTOcean,		 { L"Ocean/FFTOcean.VS.hlsl",        L"Ocean/FFTOcean.PS.hlsl"}},
 		{ PipelineType::Skinning3D,		 { L"3D/SkinningObj3D.VS.hlsl",      L"3D/SkinningObj3D.PS.hlsl"}},
+		{ PipelineType::SkinningCompact3D, { L"3D/SkinningCompactObj3D.VS.hlsl", L"3D/SkinningObj3D.PS.hlsl"}},
 		{ PipelineType::Line3D,			 { L"3D/Line3D.VS.hlsl",             L"3D/Line3D.PS.hlsl"}},
 		{ PipelineType::Particle,		 { L"Particle/Particle.VS.hlsl",     L"Particle/Particle.PS.hlsl"}},
 		{ PipelineType::OffScreen,		 { L"OffScreen/Fullscreen.VS.hlsl",  L"OffScreen/CopyImage.PS.hlsl"}},
@@ -31,6 +31,7 @@ namespace MiiEngine {
 			{ PipelineType::Particle, CreateDepthDesc(true, D3D12_DEPTH_WRITE_MASK_ZERO, D3D12_COMPARISON_FUNC_LESS_EQUAL) },
 			// Skinning 3D（深度有効, 書き込みあり, 比較LessEqual）
 			{ PipelineType::Skinning3D, CreateDepthDesc(true, D3D12_DEPTH_WRITE_MASK_ALL, D3D12_COMPARISON_FUNC_LESS_EQUAL) },
+			{ PipelineType::SkinningCompact3D, CreateDepthDesc(true, D3D12_DEPTH_WRITE_MASK_ALL, D3D12_COMPARISON_FUNC_LESS_EQUAL) },
 			// Line3D （深度有効, 書き込みなし, 比較LessEqual）
 			{ PipelineType::Line3D, CreateDepthDesc(true, D3D12_DEPTH_WRITE_MASK_ZERO, D3D12_COMPARISON_FUNC_LESS_EQUAL) },
 			// PostEffect 系（深度無効）
@@ -229,7 +229,7 @@ namespace MiiEngine {
 
 
 			// RootParameterの生成
-			D3D12_ROOT_PARAMETER rootParameters[3] = {};
+			D3D12_ROOT_PARAMETER rootParameters[4] = {};
 			rootParameters[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV; // CBVを使う
 			rootParameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_PIXEL; // PixelShaderで使う
 			rootParameters[0].Descriptor.ShaderRegister = 0; // レジスタ番号0を使う
@@ -244,6 +244,10 @@ namespace MiiEngine {
 			rootParameters[2].DescriptorTable.pDescriptorRanges = descriptorRange; // Tableの中身の配列を指定
 			rootParameters[2].DescriptorTable.NumDescriptorRanges = _countof(descriptorRange); // Tableで利用する数
 
+			rootParameters[3].ParameterType = D3D12_ROOT_PARAMETER_TYPE_CBV; // CBVを使う
+			rootParameters[3].ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX; // VertexShaderで使う（カメラ行列）
+			rootParameters[3].Descriptor.ShaderRegister = 0; // レジスタ番号0を使う
+
 
 			// Samplerの設定
 			D3D12_STATIC_SAMPLER_DESC staticSamplers[1] = {};
@@ -864,6 +868,7 @@ namespace MiiEngine {
 			{ PipelineType::FFTOcean,			TypeFFTOcean },
 			{ PipelineType::Particle,			TypeParticle },
 			{ PipelineType::Skinning3D,			TypeSkinning3D  },
+			{ PipelineType::SkinningCompact3D,	TypeSkinning3D  },
 			{ PipelineType::Line3D,				TypeLine3D },
 			{ PipelineType::OffScreen,			TypeOffScreen },
 			{ PipelineType::Grayscale,			TypeOffScreen },
@@ -115,6 +115,7 @@ namespace MiiEngine {
 				{ PipelineType::FFTOcean,	  { inputElementDescs3,      _countof(inputElementDescs3) } },
 				{ PipelineType::Particle,     { inputElementDescs3,      _countof(inputElementDescs3) } },
 				{ PipelineType::Skinning3D,   { inputElementDescs5,		 _countof(inputElementDescs5) } },
+				{ PipelineType::SkinningCompact3D, { inputElementDescs5, _countof(inputElementDescs5) } },
 				{ PipelineType::Line3D,       { inputElementDescsLine,   _countof(inputElementDescsLine)} },
 				{ PipelineType::OffScreen,    { nullptr,                  0 } },
 				{ PipelineType::Grayscale,    { nullptr,                  0 } },
@@ -15,6 +15,7 @@ namespace MiiEngine {
 		{ PipelineType::FFTOcean,			D3D12_CULL_MODE_BACK },
 		{ PipelineType::Particle,			D3D12_CULL_MODE_NONE },
 		{ PipelineType::Skinning3D,			D3D12_CULL_MODE_BACK },
+		{ PipelineType::SkinningCompact3D,	D3D12_CULL_MODE_BACK },
 		{ PipelineType::Line3D,				D3D12_CULL_MODE_NONE },
 		{ PipelineType::OffScreen,			D3D12_CULL_MODE_NONE },
 		{ PipelineType::Grayscale,			D3D12_CULL_MODE_NONE },
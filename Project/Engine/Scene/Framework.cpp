@@ -11,6 +11,9 @@ namespace MiiEngine {
 		// MiiEngine
 		Engine_ = std::make_unique<Mii>();
 		Engine_->Initialize(title, 1920, 1080);
+		// JobSystem
+		jobSystem_ = std::make_unique<JobSystem>();
+		jobSystem_->Initialize();
 		// CameraManager
 		cameraManager_ = std::make_unique<CameraManager>();
 		// ParticleManager
@@ -46,7 +49,8 @@ namespace MiiEngine {
 			particleManager_.get(),
 			colliderManager_.get(),
 			spriteManager_.get(),
-			gameTime_.get()
+			gameTime_.get(),
+			jobSystem_.get()
 		};
 		Service::Locator::ProvideAll(registry);
 	}
@@ -66,6 +70,9 @@ namespace MiiEngine {
 		colliderManager_.reset();
 		// SpriteManager
 		spriteManager_.reset();
+		// JobSystem
+		jobSystem_->Finalize();
+		jobSystem_.reset();
 		// MiiEngine
 		Engine_->Finalize();
 		Engine_.reset();
@@ -80,6 +87,8 @@ namespace MiiEngine {
 		cameraManager_->UpdateAllCameras();
 		// ParticleManager
 		particleManager_->Update();
+		// AnimationManager（全てのAnimationModelのポーズをまとめて更新）
+		Engine_->GetAnimationManager()->Update();
 		// SpriteManager
 		spriteManager_->Update();
 		// ColliderManager
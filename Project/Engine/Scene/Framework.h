@@ -14,6 +14,8 @@
 #include "Engine/System/Managers/SpriteManager.h"
 // DeltaTime
 #include "Engine/System/GameTime/GameTime.h"
+// JobSystem
+#include "Engine/System/Job/JobSystem.h"
 // ｃ++
 #include <memory>
 
@@ -78,6 +80,8 @@ namespace MiiEngine {
 		std::unique_ptr<ColliderManager> colliderManager_;
 		// GameTime
 		std::unique_ptr<GameTime> gameTime_;
+		// JobSystem
+		std::unique_ptr<JobSystem> jobSystem_;
 	protected:
 		// ゲーム終了フラグ
 		bool endRequest_ = false;
@@ -4,6 +4,7 @@
 // Service
 #include "Service/Loader.h"
 #include "Service/Particle.h"
+#include "Service/Collision.h"
 // Logger
 #include "Engine/Core/Logger.h"
 // c++
@@ -203,5 +204,7 @@ namespace MiiEngine {
 		/// ===Game=== ///
 		Loader::LoadLevelJson("Level/StageData2.json");
 		Loader::LoadLevelJson("Level/EntityData2.json");
+		/// ===Collision=== ///
+		Collision::LoadLayerMatrix("CollisionLayer.json");
 	}
 } 
\ No newline at end of file
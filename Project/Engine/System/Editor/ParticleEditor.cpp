@@ -269,8 +269,9 @@ namespace MiiEngine {
 	void ParticleEditor::CreatePreviewParticle() {
 #ifdef USE_IMGUI
 		// ParticleGroupを生成してDefinitionを適用
+		// パラメータを変えた時に見比べやすいよう、プレビューは毎回同じシードで再生する
 		previewParticle_ = std::make_unique<ParticleGroup>();
-		previewParticle_->Initialize(previewPosition_, currentDefinition_);
+		previewParticle_->Initialize(previewPosition_, currentDefinition_, kPreviewSeed);
 
 		// ★テクスチャが指定されていれば明示的に設定（二重適用になるが安全のため）
 		if (!currentDefinition_.appearance.texturePath.empty()) {
@@ -904,6 +905,49 @@ namespace MiiEngine {
 		ImGui::Spacing();
 		ImGui::Separator();
 
+		// LOD・カリング
+		ImGui::SeparatorText("LOD・カリング");
+		ParticleLodSettings& lod = currentDefinition_.lod;
+		bool lodChanged = false;
+		lodChanged |= ImGui::Checkbox("視錐台カリング", &lod.enableCulling);
+		ImGui::TextDisabled("画面外では発生と移動を止め、寿命だけ進める");
+		if (lod.enableCulling) {
+			ImGui::Indent();
+			lodChanged |= ImGui::DragFloat("境界球の半径", &lod.boundsRadius, 0.1f, 0.0f, 1000.0f);
+			ImGui::TextDisabled("0 = 発生範囲・速度・寿命から自動計算（渦巻き・軌跡を使う場合は指定する）");
+			ImGui::Unindent();
+		}
+		lodChanged |= ImGui::Checkbox("距離LOD", &lod.enableLod);
+		if (lod.enableLod) {
+			ImGui::Indent();
+			for (int i = 0; i < ParticleLodSettings::kBandCount; ++i) {
+				ImGui::PushID(i);
+				ImGui::Text("帯 %d", i + 1);
+				lodChanged |= ImGui::DragFloat("開始距離", &lod.bandDistances[i], 0.5f, 0.0f, 1000.0f);
+				lodChanged |= ImGui::SliderFloat("発生数の倍率", &lod.bandEmissionScales[i], 0.0f, 1.0f);
+				ImGui::PopID();
+			}
+			ImGui::TextDisabled("カメラからの距離が開始距離以上の帯のうち、最も遠い帯の倍率を使う");
+			ImGui::Unindent();
+		}
+		if (lodChanged && previewParticle_) {
+			previewParticle_->SetDefinition(currentDefinition_);
+		}
+		ImGui::Spacing();
+		ImGui::Separator();
+
+		// 予算
+		ImGui::SeparatorText("予算");
+		ParticleBudgetSettings& budget = currentDefinition_.budget;
+		ImGui::DragInt("優先度", &budget.priority, 0.1f, -100, 100);
+		int minimumGuarantee = static_cast<int>(budget.minimumGuarantee);
+		if (ImGui::DragInt("最低保証数", &minimumGuarantee, 1.0f, 0, static_cast<int>(currentDefinition_.maxInstance))) {
+			budget.minimumGuarantee = static_cast<uint32_t>(minimumGuarantee);
+		}
+		ImGui::TextDisabled("全体の粒子数が予算を超えた時、優先度の低いグループから発生数を絞る");
+		ImGui::Spacing();
+		ImGui::Separator();
+
 		// プリセットボタン
 		ImGui::SeparatorText("プリセット");
 		if (ImGui::Button("攻撃軌跡プリセット", ImVec2(200, 30))) {
@@ -3,6 +3,7 @@
 #include "Engine/Graphics/Particle/ParticleDefinition.h"
 #include "Engine/DataInfo/BlendModeData.h"
 // c++
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -212,5 +213,6 @@ namespace MiiEngine {
         /// ===定数=== ///
         static constexpr const char* kDefaultSavePath = "Resource/Json/Particles/";
         static constexpr const char* kFileExtension = ".json";
+        static constexpr uint64_t kPreviewSeed = 0x5EED5EEDull;
     };
 }
\ No newline at end of file
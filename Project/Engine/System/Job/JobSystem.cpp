@@ -0,0 +1,219 @@
+#include "JobSystem.h"
+// c++
+#include <algorithm>
+#include <cassert>
+
+namespace MiiEngine {
+	namespace {
+		// 区間を1つの値に詰める
+		uint64_t PackRange(uint32_t begin, uint32_t end) {
+			return (static_cast<uint64_t>(begin) << 32) | end;
+		}
+		uint32_t RangeBegin(uint64_t value) { return static_cast<uint32_t>(value >> 32); }
+		uint32_t RangeEnd(uint64_t value) { return static_cast<uint32_t>(value); }
+	}
+
+	///-------------------------------------------///
+	/// デストラクタ
+	///-------------------------------------------///
+	JobSystem::~JobSystem() { Finalize(); }
+
+	///-------------------------------------------///
+	/// Getter
+	///-------------------------------------------///
+	uint32_t JobSystem::GetThreadCount() const { return static_cast<uint32_t>(workers_.size()) + 1; }
+
+	///-------------------------------------------///
+	/// 初期化
+	///-------------------------------------------///
+	void JobSystem::Initialize(uint32_t workerCount) {
+		assert(workers_.empty());
+
+		// 論理コア数 - 1（呼び出し元のスレッドの分）
+		if (workerCount == 0) {
+			const uint32_t hardware = std::thread::hardware_concurrency();
+			workerCount = (hardware > 1) ? hardware - 1 : 0;
+		}
+
+		isStop_ = false;
+		workers_.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; ++i) {
+			workers_.emplace_back([this, i] { WorkerLoop(i + 1); });
+		}
+	}
+
+	///-------------------------------------------///
+	/// 終了
+	///-------------------------------------------///
+	void JobSystem::Finalize() {
+		{
+			std::lock_guard<std::mutex> lock(queueMutex_);
+			isStop_ = true;
+		}
+		queueCondition_.notify_all();
+		for (std::thread& worker : workers_) {
+			if (worker.joinable()) {
+				worker.join();
+			}
+		}
+		workers_.clear();
+		queue_.clear();
+	}
+
+	///-------------------------------------------///
+	/// 並列処理
+	///-------------------------------------------///
+	void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const RangeFunc& func) {
+		if (count == 0) {
+			return;
+		}
+		grainSize = (std::max)(grainSize, 1u);
+		const uint32_t chunkCount = (count + grainSize - 1) / grainSize;
+
+		/// ===ワーカーがいない、または1チャンクだけの場合はその場で処理=== ///
+		if (workers_.empty() || chunkCount == 1) {
+			for (uint32_t begin = 0; begin < count; begin += grainSize) {
+				func(begin, (std::min)(begin + grainSize, count), 0);
+			}
+			return;
+		}
+
+		/// ===手伝えるワーカーの数だけ参加枠を用意=== ///
+		const uint32_t helperCount = (std::min)(static_cast<uint32_t>(workers_.size()), chunkCount - 1);
+		const uint32_t slotCount = helperCount + 1;
+
+		ForJob job;
+		job.func = &func;
+		job.count = count;
+		job.grainSize = grainSize;
+		job.remainingChunks = chunkCount;
+
+		// 参加枠ごとに連続したチャンクを配る（来なかったワーカーの分は他のスレッドが盗む）
+		job.ranges = std::vector<ChunkRange>(slotCount);
+		for (uint32_t slot = 0; slot < slotCount; ++slot) {
+			const uint32_t begin = static_cast<uint32_t>(static_cast<uint64_t>(chunkCount) * slot / slotCount);
+			const uint32_t end = static_cast<uint32_t>(static_cast<uint64_t>(chunkCount) * (slot + 1) / slotCount);
+			job.ranges[slot].value.store(PackRange(begin, end), std::memory_order_relaxed);
+		}
+
+		/// ===ワーカーへ登録=== ///
+		{
+			std::lock_guard<std::mutex> lock(queueMutex_);
+			for (uint32_t i = 0; i < helperCount; ++i) {
+				queue_.push_back(&job);
+			}
+		}
+		if (helperCount == 1) {
+			queueCondition_.notify_one();
+		} else {
+			queueCondition_.notify_all();
+		}
+
+		/// ===呼び出し元も処理する=== ///
+		RunChunks(job, 0, 0);
+
+		/// ===まだ取り出されていない登録を取り消す=== ///
+		{
+			std::lock_guard<std::mutex> lock(queueMutex_);
+			std::erase(queue_, &job);
+		}
+
+		/// ===取り出したワーカーが全て抜けるまで待つ=== ///
+		std::unique_lock<std::mutex> lock(doneMutex_);
+		doneCondition_.wait(lock, [&job] { return job.activeHelpers.load() == 0; });
+		assert(job.remainingChunks.load() == 0);
+	}
+
+	///-------------------------------------------///
+	/// ワーカースレッドの処理
+	///-------------------------------------------///
+	void JobSystem::WorkerLoop(uint32_t threadIndex) {
+		while (true) {
+			ForJob* job = nullptr;
+			uint32_t slot = 0;
+			{
+				std::unique_lock<std::mutex> lock(queueMutex_);
+				queueCondition_.wait(lock, [this] { return isStop_ || !queue_.empty(); });
+				if (isStop_ && queue_.empty()) {
+					return;
+				}
+				job = queue_.front();
+				queue_.pop_front();
+				// ロック中に参加を記録し、呼び出し元が先に戻らないようにする
+				job->activeHelpers.fetch_add(1);
+				slot = job->nextSlot.fetch_add(1);
+			}
+
+			RunChunks(*job, slot, threadIndex);
+
+			{
+				std::lock_guard<std::mutex> lock(doneMutex_);
+				job->activeHelpers.fetch_sub(1);
+			}
+			doneCondition_.notify_all();
+		}
+	}
+
+	///-------------------------------------------///
+	/// チャンクの処理
+	///-------------------------------------------///
+	void JobSystem::RunChunks(ForJob& job, uint32_t slot, uint32_t threadIndex) {
+		const uint32_t slotCount = static_cast<uint32_t>(job.ranges.size());
+		auto run = [&job, threadIndex](uint32_t chunk) {
+			const uint32_t begin = chunk * job.grainSize;
+			(*job.func)(begin, (std::min)(begin + job.grainSize, job.count), threadIndex);
+			job.remainingChunks.fetch_sub(1);
+		};
+
+		/// ===自分の区間を先頭から処理=== ///
+		uint32_t chunk = 0;
+		while (PopFront(job.ranges[slot], chunk)) {
+			run(chunk);
+		}
+
+		/// ===他の区間の末尾から盗む=== ///
+		// 区間は縮むだけなので、1周して空にした区間に再び仕事が入ることはない
+		for (uint32_t offset = 1; offset < slotCount; ++offset) {
+			ChunkRange& victim = job.ranges[(slot + offset) % slotCount];
+			while (StealBack(victim, chunk)) {
+				run(chunk);
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// 先頭から取り出す
+	///-------------------------------------------///
+	bool JobSystem::PopFront(ChunkRange& range, uint32_t& outChunk) {
+		uint64_t value = range.value.load(std::memory_order_acquire);
+		while (true) {
+			const uint32_t begin = RangeBegin(value);
+			const uint32_t end = RangeEnd(value);
+			if (begin >= end) {
+				return false;
+			}
+			if (range.value.compare_exchange_weak(value, PackRange(begin + 1, end), std::memory_order_acq_rel)) {
+				outChunk = begin;
+				return true;
+			}
+		}
+	}
+
+	///-------------------------------------------///
+	/// 末尾から盗む
+	///-------------------------------------------///
+	bool JobSystem::StealBack(ChunkRange& range, uint32_t& outChunk) {
+		uint64_t value = range.value.load(std::memory_order_acquire);
+		while (true) {
+			const uint32_t begin = RangeBegin(value);
+			const uint32_t end = RangeEnd(value);
+			if (begin >= end) {
+				return false;
+			}
+			if (range.value.compare_exchange_weak(value, PackRange(begin, end - 1), std::memory_order_acq_rel)) {
+				outChunk = end - 1;
+				return true;
+			}
+		}
+	}
+}
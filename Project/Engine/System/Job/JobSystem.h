@@ -0,0 +1,114 @@
+#pragma once
+/// ===Include=== ///
+// c++
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MiiEngine {
+	///=====================================================///
+	/// JobSystem
+	/// ワーカースレッドのプール。範囲を分割して並列に処理し、呼び出し元は完了まで待つ。
+	/// チャンクは参加するスレッドごとに連続した区間として先に配り、自分の区間を使い切った
+	/// スレッドは他のスレッドの区間の末尾から盗む（ワークスティーリング）
+	///=====================================================///
+	class JobSystem {
+	public:
+
+		JobSystem() = default;
+		~JobSystem();
+
+		// 範囲処理の関数型（begin, end, スレッド番号）
+		using RangeFunc = std::function<void(uint32_t begin, uint32_t end, uint32_t threadIndex)>;
+
+		/// <summary>
+		/// 初期化処理
+		/// </summary>
+		/// <param name="workerCount">ワーカースレッド数。0 の場合は論理コア数 - 1。</param>
+		void Initialize(uint32_t workerCount = 0);
+
+		/// <summary>
+		/// 終了処理。全てのワーカースレッドを停止します。
+		/// </summary>
+		void Finalize();
+
+		/// <summary>
+		/// [0, count) を grainSize ごとに分割して並列に処理し、全て終わるまで待ちます。
+		/// 呼び出し元のスレッドも処理に参加します（スレッド番号 0）。
+		/// </summary>
+		/// <param name="count">要素数。</param>
+		/// <param name="grainSize">1回に処理する要素数。分割の単位で、結果を並べ直す単位にもなります。</param>
+		/// <param name="func">範囲処理。begin は grainSize の倍数になります。</param>
+		void ParallelFor(uint32_t count, uint32_t grainSize, const RangeFunc& func);
+
+	public: /// ===Getter=== ///
+		// 処理に参加するスレッド数（ワーカー + 呼び出し元）
+		uint32_t GetThreadCount() const;
+
+	private: /// ===変数=== ///
+
+		/// ===スレッドごとの未処理チャンクの区間 [begin, end)=== ///
+		// 上位32bitが begin、下位32bitが end。持ち主は先頭から、他のスレッドは末尾から取り出す。
+		// begin は増えるだけ、end は減るだけなので、CAS で同じ値に戻ることはない
+		// 偽共有を避けるため1キャッシュラインを占有させる（パディングを明示して、alignas による暗黙のパディング警告 C4324 を出さない）
+		struct alignas(64) ChunkRange {
+			std::atomic<uint64_t> value = 0;
+			char pad[64 - sizeof(std::atomic<uint64_t>)] = {};
+		};
+
+		/// ===ParallelFor 1回分の状態=== ///
+		struct ForJob {
+			const RangeFunc* func = nullptr;
+			uint32_t count = 0;
+			uint32_t grainSize = 1;
+			std::vector<ChunkRange> ranges;            // 参加枠ごとの区間（0 は呼び出し元）
+			std::atomic<uint32_t> nextSlot = 1;        // ワーカーに割り当てる次の参加枠
+			std::atomic<uint32_t> remainingChunks = 0; // 未完了のチャンク数
+			std::atomic<uint32_t> activeHelpers = 0;   // 処理中のワーカー数
+		};
+
+		// ワーカースレッド
+		std::vector<std::thread> workers_;
+		// ワーカーへ配るジョブ
+		std::deque<ForJob*> queue_;
+		std::mutex queueMutex_;
+		std::condition_variable queueCondition_;
+		// 完了待ち
+		std::mutex doneMutex_;
+		std::condition_variable doneCondition_;
+		// 停止フラグ
+		bool isStop_ = false;
+
+	private: /// ===関数=== ///
+
+		/// <summary>
+		/// ワーカースレッドの処理
+		/// </summary>
+		/// <param name="threadIndex">スレッド番号（1 から）。</param>
+		void WorkerLoop(uint32_t threadIndex);
+
+		/// <summary>
+		/// チャンクを取り出せる限り処理（自分の区間を使い切ったら他の区間から盗む）
+		/// </summary>
+		/// <param name="slot">参加枠の番号。</param>
+		/// <param name="threadIndex">スレッド番号。</param>
+		void RunChunks(ForJob& job, uint32_t slot, uint32_t threadIndex);
+
+		/// <summary>
+		/// 区間の先頭からチャンクを1つ取り出す
+		/// </summary>
+		/// <returns>取り出せた場合は true</returns>
+		static bool PopFront(ChunkRange& range, uint32_t& outChunk);
+
+		/// <summary>
+		/// 区間の末尾からチャンクを1つ盗む
+		/// </summary>
+		/// <returns>盗めた場合は true</returns>
+		static bool StealBack(ChunkRange& range, uint32_t& outChunk);
+	};
+}
@@ -1,12 +1,23 @@
 #include "AnimationManager.h"
 // c++
 #include <fstream>
+#include <chrono>
+#include <algorithm>
+// Engine
+#include "Engine/Graphics/3d/Model/AnimationSampler.h"
+#include "Engine/Graphics/3d/Model/AnimationModel.h"
+#include "Engine/System/Job/JobSystem.h"
+// Service
+#include "Service/Locator.h"
 
 namespace MiiEngine {
 	///-------------------------------------------/// 
 	/// デストラクタ
 	///-------------------------------------------///
 	AnimationManager::~AnimationManager() {
+		pendingModels_.clear();
+		models_.clear();
+		animationClips_.clear();
 		animationDatas_.clear();
 	}
 
@@ -26,16 +37,94 @@ namespace MiiEngine {
 		animationData = LoadAnimation(baseDirectoryPath, filename);
 
 		// アニメーションをMapコンテナに格納
-		animationDatas_[Key] = animationData;
+		animationDatas_[Key] = std::make_shared<const std::map<std::string, Animation>>(std::move(animationData));
+		// 作成済みのクリップは古いデータのものなので破棄
+		animationClips_.erase(Key);
 	}
 
 	///-------------------------------------------/// 
 	/// Getter
 	///-------------------------------------------///
-	std::map<std::string, Animation> AnimationManager::GetAnimation(const std::string& directorPath) {
+	std::shared_ptr<const std::map<std::string, Animation>> AnimationManager::GetAnimation(const std::string& directorPath) {
 		assert(animationDatas_.contains(directorPath));
 		return animationDatas_.at(directorPath);
 	}
+	std::shared_ptr<const AnimationClip> AnimationManager::GetAnimationClip(const std::string& directorPath, const std::string& animationName, const Skeleton& skeleton) {
+		// 作成済みなら共有する
+		std::shared_ptr<const AnimationClip>& clip = animationClips_[directorPath][animationName];
+		if (clip) {
+			return clip;
+		}
+
+		// アニメーションを探してSkeletonに対応付ける
+		auto data = animationDatas_.find(directorPath);
+		if (data == animationDatas_.end()) {
+			return nullptr;
+		}
+		auto animation = data->second->find(animationName);
+		if (animation == data->second->end()) {
+			return nullptr;
+		}
+		clip = std::make_shared<const AnimationClip>(AnimationSampler::CreateClip(animation->second, skeleton));
+		return clip;
+	}
+
+	///-------------------------------------------/// 
+	/// 一括更新の登録
+	///-------------------------------------------///
+	void AnimationManager::Register(AnimationModel* model) {
+		assert(model);
+		if (std::find(models_.begin(), models_.end(), model) == models_.end()) {
+			models_.push_back(model);
+		}
+	}
+	void AnimationManager::Unregister(AnimationModel* model) {
+		// 順番は関係ないので末尾と入れ替えて削除
+		auto it = std::find(models_.begin(), models_.end(), model);
+		if (it != models_.end()) {
+			*it = models_.back();
+			models_.pop_back();
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// 全てのAnimationModelのポーズの更新
+	///-------------------------------------------///
+	void AnimationManager::Update() {
+		using Clock = std::chrono::high_resolution_clock;
+		const Clock::time_point start = Clock::now();
+
+		JobSystem* jobSystem = useParallelUpdate_ ? Service::Locator::GetJobSystem() : nullptr;
+		threadUpdateTimes_.assign(jobSystem ? jobSystem->GetThreadCount() : 1, 0.0);
+
+		/// ===今フレームにUpdateが呼ばれたモデルを集める=== ///
+		pendingModels_.clear();
+		for (AnimationModel* model : models_) {
+			if (model->ConsumePoseRequest()) {
+				pendingModels_.push_back(model);
+			}
+		}
+		const uint32_t count = static_cast<uint32_t>(pendingModels_.size());
+
+		/// ===モデルごとに更新=== ///
+		// 各モデルは自分のSkeleton・カーソル・マップ済みのパレットだけを書き換え、
+		// クリップは読み取りのみなので、モデル同士で書き込み先が重なることはない
+		auto updateRange = [this](uint32_t begin, uint32_t end, uint32_t threadIndex) {
+			const Clock::time_point rangeStart = Clock::now();
+			for (uint32_t i = begin; i < end; ++i) {
+				pendingModels_[i]->UpdatePose();
+			}
+			threadUpdateTimes_[threadIndex] += std::chrono::duration<double, std::milli>(Clock::now() - rangeStart).count();
+		};
+		if (jobSystem) {
+			jobSystem->ParallelFor(count, kUpdateGrainSize, updateRange);
+		} else {
+			updateRange(0, count, 0);
+		}
+
+		updatedModelCount_ = count;
+		updateTime_ = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
 
 	///-------------------------------------------/// 
 	/// アニメーションファイル読み込み
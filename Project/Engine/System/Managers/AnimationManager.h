@@ -8,8 +8,14 @@
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
+// c++
+#include <memory>
+#include <vector>
 
 namespace MiiEngine {
+	/// ===前方宣言=== ///
+	class AnimationModel;
+
 	///=====================================================/// 
 	/// アニメーションマネージャ
 	///=====================================================///
@@ -29,16 +35,73 @@ namespace MiiEngine {
 		void Load(const std::string& Key, const std::string& baseDirectoryPath, const std::string& filename);
 
 		/// <summary>
-		/// 格納しているアニメーションの取得
+		/// 格納しているアニメーションの取得（読み込み済みのデータを共有し、コピーはしない）
 		/// </summary>
 		/// <param name="filename">読み込むアニメーションファイルのパスまたはファイル名。</param>
-		/// <returns>ファイルに含まれる各アニメーションを、名前（std::string）をキー、対応する Animation オブジェクトを値とする std::map。</returns>
-		std::map<std::string, Animation> GetAnimation(const std::string& filename);
+		/// <returns>ファイルに含まれる各アニメーションを、名前（std::string）をキー、対応する Animation オブジェクトを値とする std::map への共有ポインタ。</returns>
+		std::shared_ptr<const std::map<std::string, Animation>> GetAnimation(const std::string& filename);
+
+		/// <summary>
+		/// Skeletonに対応付けたクリップの取得（初回だけ作成し、以降は同じクリップを共有する）
+		/// </summary>
+		/// <param name="filename">アニメーションを読み込んだ時のキー。</param>
+		/// <param name="animationName">ファイル内のアニメーションの名前。</param>
+		/// <param name="skeleton">対応付けるSkeleton。同じファイルのモデルから作成したものであること。</param>
+		/// <returns>クリップへの共有ポインタ。アニメーションが見つからない場合は nullptr。</returns>
+		std::shared_ptr<const AnimationClip> GetAnimationClip(const std::string& filename, const std::string& animationName, const Skeleton& skeleton);
+
+		/// <summary>
+		/// 一括更新するAnimationModelの登録（AnimationModelの初期化時に呼ばれる）
+		/// </summary>
+		/// <param name="model">登録するモデル。登録解除するまで有効であること。</param>
+		void Register(AnimationModel* model);
+
+		/// <summary>
+		/// 一括更新するAnimationModelの登録解除（AnimationModelの破棄時に呼ばれる）
+		/// </summary>
+		/// <param name="model">登録解除するモデル。</param>
+		void Unregister(AnimationModel* model);
+
+		/// <summary>
+		/// 今フレームにUpdateが呼ばれたAnimationModelのポーズをまとめて更新（ジョブシステムで並列に処理）
+		/// 全てのオブジェクトの更新後、描画の前に呼ぶ
+		/// </summary>
+		void Update();
+
+	public: /// ===Getter=== ///
+		// 今フレームにポーズを更新したモデルの数
+		uint32_t GetUpdatedModelCount() const { return updatedModelCount_; }
+		// 今フレームの更新全体の時間（ms）
+		double GetUpdateTime() const { return updateTime_; }
+		// 今フレームのスレッドごとの更新時間（ms）
+		const std::vector<double>& GetThreadUpdateTimes() const { return threadUpdateTimes_; }
+
+	public: /// ===Setter=== ///
+		// ジョブシステムで並列に更新するか
+		void SetUseParallelUpdate(bool useParallelUpdate) { useParallelUpdate_ = useParallelUpdate; }
 
 	private: /// ===Variables(変数)=== ///
 
-		// アニメーションデータ	
-		std::map<std::string, std::map<std::string, Animation>> animationDatas_;
+		// アニメーションデータ（読み込み後は変更しないので、全てのインスタンスで共有する）
+		std::map<std::string, std::shared_ptr<const std::map<std::string, Animation>>> animationDatas_;
+		// Skeletonに対応付けたクリップ（ファイルのキー、アニメーション名の順で引く）
+		std::map<std::string, std::map<std::string, std::shared_ptr<const AnimationClip>>> animationClips_;
+
+		/// ===一括更新=== ///
+		// 1チャンクで処理するモデル数（Joint数の違いによる負荷の差はワークスティーリングでならす）
+		static constexpr uint32_t kUpdateGrainSize = 1;
+		// 登録されている全てのAnimationModel
+		std::vector<AnimationModel*> models_;
+		// 今フレームにポーズを更新するモデル（Update で毎フレーム作り直す）
+		std::vector<AnimationModel*> pendingModels_;
+		// ジョブシステムで並列に更新するか
+		bool useParallelUpdate_ = true;
+		// 今フレームのスレッドごとの更新時間（ms、番号はジョブシステムのスレッド番号）
+		std::vector<double> threadUpdateTimes_;
+		// 今フレームの更新全体の時間（ms）
+		double updateTime_ = 0.0;
+		// 今フレームにポーズを更新したモデルの数
+		uint32_t updatedModelCount_ = 0;
 
 	private: /// ===Functions(関数)=== ///
 
@@ -1,31 +1,51 @@
 #include "ColliderManager.h"
 // c++
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 // ColliderType
 #include "Engine/Collider/SphereCollider.h"
 #include "Engine/Collider/AABBCollider.h"
 #include "Engine/Collider/OBBCollider.h"
+// NarrowPhase
+#include "Engine/Collider/NarrowPhase/NarrowPhaseMath.h"
+// Continuous
+#include "Engine/Collider/Continuous/SweepTest.h"
+// Job
+#include "Engine/System/Job/JobSystem.h"
+// Service
+#include "Service/Locator.h"
 // Math
 #include "Math/sMath.h"
+// ImGui
+#ifdef USE_IMGUI
+#include <imgui.h>
+#endif // USE_IMGUI
 
 namespace MiiEngine {
 	///-------------------------------------------/// 
 	/// デストラクタ
 	///-------------------------------------------///
-	ColliderManager::~ColliderManager() { colliders_.clear(); }
+	ColliderManager::~ColliderManager() { registry_.Clear(); }
 
 	///-------------------------------------------/// 
 	/// Setter
 	///-------------------------------------------///
 	// Lightの設定
 	void ColliderManager::SetLight(LightType type) {
-		for (auto itA = colliders_.begin(); itA != colliders_.end(); ++itA) {
-			(*itA)->SetLight(type);
+		for (const ColliderProxy& proxy : registry_.GetProxies()) {
+			proxy.owner->SetLight(type);
+		}
+		for (Collider* collider : staticColliders_) {
+			collider->SetLight(type);
 		}
 	}
 	void ColliderManager::SetLightData(LightInfo light) {
-		for (auto itA = colliders_.begin(); itA != colliders_.end(); ++itA) {
-			(*itA)->SetLightData(light);
+		for (const ColliderProxy& proxy : registry_.GetProxies()) {
+			proxy.owner->SetLightData(light);
+		}
+		for (Collider* collider : staticColliders_) {
+			collider->SetLightData(light);
 		}
 	}
 
@@ -52,57 +72,133 @@ namespace MiiEngine {
 
 		collisionTable_[(int)ColliderType::AABB][(int)ColliderType::OBB] = &ColliderManager::AABB_OBB;
 		collisionTable_[(int)ColliderType::OBB][(int)ColliderType::AABB] = &ColliderManager::OBB_AABB;
+
+		// 呼び出し元スレッドの作業領域（ワーカー分は判定時に追加）
+		contexts_.resize(1);
 	}
 
 	///-------------------------------------------/// 
 	/// リセット
 	///-------------------------------------------///
 	void ColliderManager::Reset() {
-		// リストを空っぽにする
-		colliders_.clear();
+		// 登録を空っぽにする（発行済みのハンドルは全て無効になる）
+		registry_.Clear();
+		staticColliders_.clear();
+		// ブロードフェーズも破棄
+		broadPhase_.Clear();
+		staticBroadPhase_.Clear();
+		isStaticDirty_ = false;
+		// 衝突ペアも破棄
+		contactCache_.Clear();
+		contactSolver_.Clear();
+		sweepStates_.clear();
 	}
 
 	///-------------------------------------------/// 
 	/// 削除
 	///-------------------------------------------///
 	void ColliderManager::RemoveCollider(Collider* collider) {
-		//引数コライダーを削除
-		colliders_.remove(collider);
+		// 衝突ペアから外す
+		contactCache_.RemoveCollider(collider);
+		contactSolver_.RemoveCollider(collider);
+
+		// 静的コライダーの場合はBVHを作り直す
+		if (collider->GetIsStatic()) {
+			auto staticIt = std::find(staticColliders_.begin(), staticColliders_.end(), collider);
+			if (staticIt != staticColliders_.end()) {
+				staticColliders_.erase(staticIt);
+				RemoveFromStaticBroadPhase(collider);
+				isStaticDirty_ = true;
+			}
+			return;
+		}
+
+		// 削除済み・リセット済みのハンドルは何もしない
+		const ColliderHandle handle = collider->GetColliderHandle();
+		ColliderProxy* proxy = registry_.GetProxy(handle);
+		if (!proxy || proxy->owner != collider) {
+			return;
+		}
+
+		// プロキシを木から外す
+		if (proxy->treeProxyId != DynamicAABBTree::kNullNode) {
+			broadPhase_.DestroyProxy(proxy->treeProxyId);
+		}
+		// 登録を解除（末尾のプロキシが空いた位置に詰められる）
+		registry_.Remove(handle);
+		collider->SetColliderHandle(ColliderHandle{});
+		// 次に追加された時は移動前の位置から掃引しない
+		sweepStates_.erase(collider);
 	}
 
 	///-------------------------------------------/// 
 	/// コライダーの追加
 	///-------------------------------------------///
 	void ColliderManager::AddCollider(Collider* collider) {
-		// 引数のコライダーをpush_back
-		colliders_.push_back(collider);
+		// 静的コライダーは別リストで管理
+		if (collider->GetIsStatic()) {
+			if (std::find(staticColliders_.begin(), staticColliders_.end(), collider) == staticColliders_.end()) {
+				staticColliders_.push_back(collider);
+				isStaticDirty_ = true;
+			}
+			return;
+		}
+
+		// 登録済みなら何もしない
+		if (registry_.IsAlive(collider->GetColliderHandle())) {
+			return;
+		}
+
+		// ハンドルを発行（木のプロキシは最初の判定時に形状が確定してから生成する）
+		collider->SetColliderHandle(registry_.Add(collider));
+	}
+
+	///-------------------------------------------/// 
+	/// ハンドルの確認
+	///-------------------------------------------///
+	bool ColliderManager::IsColliderAlive(ColliderHandle handle) const {
+		return registry_.IsAlive(handle);
+	}
+	Collider* ColliderManager::GetCollider(ColliderHandle handle) const {
+		return registry_.GetOwner(handle);
+	}
+
+	///-------------------------------------------/// 
+	/// 静的コライダーの構築要求
+	///-------------------------------------------///
+	void ColliderManager::BuildStaticColliders() {
+		// 形状が確定した次の判定時に構築する
+		isStaticDirty_ = true;
 	}
 
 	///-------------------------------------------/// 
 	/// ペアの当たり判定
 	///-------------------------------------------///
 	void ColliderManager::CheckPairCollision(Collider* colliderA, Collider* colliderB) {
-		int typeA = static_cast<int>(colliderA->GetColliderType());
-		int typeB = static_cast<int>(colliderB->GetColliderType());
-
-		// 登録されている関数を取得
-		auto func = collisionTable_[typeA][typeB];
-		if (!func) {
-			// 関数が登録されていない場合は何もしない
+		// レイヤーマトリクスで判定不要なペアを除外
+		ColliderName nameA = colliderA->GetColliderName();
+		ColliderName nameB = colliderB->GetColliderName();
+		if (!layerMatrix_.ShouldCollide(nameA, nameB)) {
+			layerMatrix_.RecordCulled(nameA, nameB);
 			return;
 		}
 
-		// 衝突判定の結果を受け取る
-		bool isHit = (this->*func)(colliderA, colliderB);
-
+		// 登録されている関数がない場合は何もしない
+		if (!collisionTable_[static_cast<int>(colliderA->GetColliderType())][static_cast<int>(colliderB->GetColliderType())]) {
+			return;
+		}
 
-		// Colliderが持っているフラグを変更
-		colliderA->SetIsCollision(isHit);
-		colliderB->SetIsCollision(isHit);
+		// 衝突判定の結果を受け取る（すり抜けた場合は掃引して判定）
+		ContactCache::Contact contact{ colliderA, colliderB };
+		bool isHit = TestPairScalar(colliderA, colliderB);
+		if (!isHit) {
+			isHit = TestSwept(colliderA, colliderB, contact);
+		}
+		layerMatrix_.RecordTest(nameA, nameB, isHit);
 
+		// 衝突したペアを記録（通知は DispatchContacts でまとめて行う）
 		if (isHit) {
-			colliderA->OnCollision(colliderB);
-			colliderB->OnCollision(colliderA);
+			contactCache_.AddContact(contact);
 		}
 	}
 
@@ -110,13 +206,673 @@ namespace MiiEngine {
 	/// 全てのColliderの当たり判定
 	///-------------------------------------------///
 	void ColliderManager::CheckAllCollisions() {
-		for (auto itA = colliders_.begin(); itA != colliders_.end(); ++itA) {
-			auto itB = itA;
-			++itB;
-			for (; itB != colliders_.end(); ++itB) {
-				CheckPairCollision(*itA, *itB);
+		// フレーム単位の統計をリセット
+		layerMatrix_.ResetFrameStats();
+		// 前フレームの衝突ペアを保存
+		contactCache_.BeginFrame();
+
+		/// ===スナップショットの作成=== ///
+		BuildSnapshot();
+		ApplySweptBounds();
+
+		/// ===ブロードフェーズの更新=== ///
+		if (isStaticDirty_) {
+			RebuildStaticBroadPhase();
+		}
+		UpdateBroadPhase();
+
+		/// ===候補ペアのみ判定=== ///
+		auto start = std::chrono::high_resolution_clock::now();
+		if (useSimdNarrowPhase_) {
+			// 候補をまとめて判定（ジョブシステムで並列）
+			RunBatchNarrowPhase();
+		} else {
+			// ペアごとに判定（従来の処理）
+			NarrowPhaseContext& context = contexts_.front();
+			const uint32_t dynamicCount = registry_.GetCount();
+			for (uint32_t orderA = 0; orderA < dynamicCount; ++orderA) {
+				Collider* colliderA = snapshot_.GetSlot(static_cast<int32_t>(orderA)).collider;
+				QueryCandidates(static_cast<int32_t>(orderA), context);
+				for (int32_t index : context.staticQueryBuffer) {
+					CheckPairCollision(static_cast<Collider*>(staticBroadPhase_.GetUserData(index)), colliderA);
+				}
+				for (int32_t proxyId : context.queryBuffer) {
+					CheckPairCollision(colliderA, static_cast<Collider*>(broadPhase_.GetUserData(proxyId)));
+				}
 			}
 		}
+		narrowPhaseTime_ = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+		/// ===次フレームの連続判定用に位置を記録=== ///
+		RecordSweepStates();
+
+		/// ===衝突イベントの通知=== ///
+		DispatchContacts();
+
+		/// ===通知中に追加された押し戻しをまとめて解消=== ///
+		contactSolver_.Solve();
+	}
+
+	///-------------------------------------------/// 
+	/// 判定候補の取得
+	///-------------------------------------------///
+	void ColliderManager::QueryCandidates(int32_t slotA, NarrowPhaseContext& context) const {
+		const AABB& boundsA = snapshot_.GetBounds(slotA);
+		const uint32_t orderA = static_cast<uint32_t>(slotA);
+
+		// 静的コライダーの候補（静的同士は判定しない）
+		context.staticQueryBuffer.clear();
+		staticBroadPhase_.Query(boundsA, context.staticQueryBuffer);
+		std::sort(context.staticQueryBuffer.begin(), context.staticQueryBuffer.end());
+
+		// 動的コライダーの候補
+		context.queryBuffer.clear();
+		broadPhase_.Query(boundsA, context.queryBuffer);
+
+		// プロキシ配列で自分より後ろにいる相手だけを残し、配列順に並べる
+		std::erase_if(context.queryBuffer, [&](int32_t proxyId) { return proxyOrder_[proxyId] <= orderA; });
+		std::sort(context.queryBuffer.begin(), context.queryBuffer.end(), [&](int32_t a, int32_t b) { return proxyOrder_[a] < proxyOrder_[b]; });
+	}
+
+	///-------------------------------------------/// 
+	/// バッチ判定（並列）
+	///-------------------------------------------///
+	void ColliderManager::RunBatchNarrowPhase() {
+		const uint32_t dynamicCount = registry_.GetCount();
+		if (dynamicCount == 0) {
+			return;
+		}
+
+		/// ===スレッドごとの作業領域を用意=== ///
+		JobSystem* jobSystem = useParallelNarrowPhase_ ? Service::Locator::GetJobSystem() : nullptr;
+		PrepareContexts(jobSystem ? jobSystem->GetThreadCount() : 1);
+		for (NarrowPhaseContext& context : contexts_) {
+			context.counters.Reset();
+			context.mismatch = 0;
+		}
+
+		/// ===チャンクごとの出力先を用意=== ///
+		const uint32_t chunkCount = (dynamicCount + kNarrowPhaseGrainSize - 1) / kNarrowPhaseGrainSize;
+		if (chunkContacts_.size() < chunkCount) {
+			chunkContacts_.resize(chunkCount);
+		}
+		for (uint32_t i = 0; i < chunkCount; ++i) {
+			chunkContacts_[i].clear();
+		}
+
+		/// ===判定（各チャンクは自分の出力先にだけ書き込む）=== ///
+		auto testRange = [this](uint32_t begin, uint32_t end, uint32_t threadIndex) {
+			NarrowPhaseContext& context = contexts_[threadIndex];
+			std::vector<ContactCache::Contact>& contacts = chunkContacts_[begin / kNarrowPhaseGrainSize];
+			for (uint32_t slotA = begin; slotA < end; ++slotA) {
+				QueryCandidates(static_cast<int32_t>(slotA), context);
+				TestCandidatesBatch(static_cast<int32_t>(slotA), context, contacts);
+			}
+		};
+		if (jobSystem) {
+			jobSystem->ParallelFor(dynamicCount, kNarrowPhaseGrainSize, testRange);
+		} else {
+			for (uint32_t begin = 0; begin < dynamicCount; begin += kNarrowPhaseGrainSize) {
+				testRange(begin, (std::min)(begin + kNarrowPhaseGrainSize, dynamicCount), 0);
+			}
+		}
+
+		/// ===チャンク順に結合（スレッド数に関係なく逐次処理と同じ順序）=== ///
+		for (uint32_t i = 0; i < chunkCount; ++i) {
+			for (const ContactCache::Contact& contact : chunkContacts_[i]) {
+				contactCache_.AddContact(contact);
+			}
+		}
+		for (const NarrowPhaseContext& context : contexts_) {
+			layerMatrix_.Accumulate(context.counters);
+		#ifdef _DEBUG
+			narrowPhaseMismatch_ += context.mismatch;
+		#endif // _DEBUG
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// 連続判定用の境界の拡張
+	///-------------------------------------------///
+	void ColliderManager::ApplySweptBounds() {
+		if (sweepStates_.empty()) {
+			return;
+		}
+		for (int32_t slot = 0; slot < staticSlotBase_; ++slot) {
+			const ColliderSnapshot::Slot& info = snapshot_.GetSlot(slot);
+			auto it = sweepStates_.find(info.collider);
+			if (it == sweepStates_.end()) {
+				continue;
+			}
+
+			// 前フレームの位置に今フレームの大きさを置いた境界
+			const SweepState& state = it->second;
+			Vector3 extent{};
+			switch (info.type) {
+			case ColliderType::Sphere: {
+				const float radius = static_cast<SphereCollider*>(info.collider)->GetSphere().radius;
+				extent = { radius, radius, radius };
+				break;
+			}
+			case ColliderType::AABB: {
+				const AABB aabb = static_cast<AABBCollider*>(info.collider)->GetAABB();
+				extent = (aabb.max - aabb.min) * 0.5f;
+				break;
+			}
+			case ColliderType::OBB: {
+				const Vector3 half = static_cast<OBBCollider*>(info.collider)->GetOBB().halfSize;
+				extent = AABBUtil::OBBExtent(state.axis, half);
+				break;
+			}
+			default:
+				continue;
+			}
+			snapshot_.ExpandBounds(slot, { state.center - extent, state.center + extent });
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// 連続判定用の位置の記録
+	///-------------------------------------------///
+	void ColliderManager::RecordSweepStates() {
+		for (int32_t slot = 0; slot < staticSlotBase_; ++slot) {
+			const ColliderSnapshot::Slot& info = snapshot_.GetSlot(slot);
+			if (!info.collider->GetIsContinuous()) {
+				continue;
+			}
+
+			SweepState& state = sweepStates_[info.collider];
+			switch (info.type) {
+			case ColliderType::Sphere:
+				state.center = static_cast<SphereCollider*>(info.collider)->GetSphere().center;
+				break;
+			case ColliderType::AABB: {
+				const AABB aabb = static_cast<AABBCollider*>(info.collider)->GetAABB();
+				state.center = (aabb.min + aabb.max) * 0.5f;
+				break;
+			}
+			case ColliderType::OBB: {
+				const OBB obb = static_cast<OBBCollider*>(info.collider)->GetOBB();
+				state.center = obb.center;
+				for (int i = 0; i < 3; ++i) {
+					state.axis[i] = obb.axis[i];
+				}
+				break;
+			}
+			default:
+				break;
+			}
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// 掃引による判定
+	///-------------------------------------------///
+	bool ColliderManager::TestSwept(Collider* colliderA, Collider* colliderB, ContactCache::Contact& outContact) const {
+		// 両方が連続判定を行う場合は先に当たった方を採用
+		float time = 0.0f;
+		Vector3 center{};
+		if (colliderA->GetIsContinuous() && SweepCollider(colliderA, colliderB, time, center)) {
+			outContact.timeOfImpact = time;
+			outContact.sweptCollider = colliderA;
+			outContact.impactPosition = center;
+		}
+		if (colliderB->GetIsContinuous() && SweepCollider(colliderB, colliderA, time, center) &&
+			(!outContact.sweptCollider || time < outContact.timeOfImpact)) {
+			outContact.timeOfImpact = time;
+			outContact.sweptCollider = colliderB;
+			outContact.impactPosition = center;
+		}
+		return outContact.sweptCollider != nullptr;
+	}
+	bool ColliderManager::SweepCollider(Collider* mover, Collider* target, float& outTime, Vector3& outCenter) const {
+		// 前フレームの位置がない（追加された直後）場合は掃引しない
+		auto it = sweepStates_.find(mover);
+		if (it == sweepStates_.end()) {
+			return false;
+		}
+		const SweepState& state = it->second;
+
+		bool isHit = false;
+		Vector3 endCenter{};
+		switch (mover->GetColliderType()) {
+		case ColliderType::Sphere: {
+			const Sphere sphere = static_cast<SphereCollider*>(mover)->GetSphere();
+			endCenter = sphere.center;
+			isHit = SweepTest::SweptSphere({ state.center, sphere.radius }, sphere.center, target, outTime);
+			break;
+		}
+		case ColliderType::AABB: {
+			const OBB end = SceneQueryMath::ToOBB(static_cast<AABBCollider*>(mover)->GetAABB());
+			OBB start = end;
+			start.center = state.center;
+			endCenter = end.center;
+			isHit = SweepTest::SweptOBB(start, end, target, outTime);
+			break;
+		}
+		case ColliderType::OBB: {
+			const OBB end = static_cast<OBBCollider*>(mover)->GetOBB();
+			OBB start = end;
+			start.center = state.center;
+			for (int i = 0; i < 3; ++i) {
+				start.axis[i] = state.axis[i];
+			}
+			endCenter = end.center;
+			isHit = SweepTest::SweptOBB(start, end, target, outTime);
+			break;
+		}
+		default:
+			return false;
+		}
+
+		// 当たった時刻の中心（移動は直線で補間）
+		if (isHit) {
+			outCenter = state.center + (endCenter - state.center) * outTime;
+		}
+		return isHit;
+	}
+
+	///-------------------------------------------/// 
+	/// スレッドごとの作業領域の用意
+	///-------------------------------------------///
+	void ColliderManager::PrepareContexts(uint32_t threadCount) {
+		if (contexts_.size() >= threadCount) {
+			return;
+		}
+		const bool useAVX2 = contexts_.front().narrowPhase.GetUseAVX2();
+		contexts_.resize(threadCount);
+		for (NarrowPhaseContext& context : contexts_) {
+			context.narrowPhase.SetUseAVX2(useAVX2);
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// 候補のまとめて判定
+	///-------------------------------------------///
+	void ColliderManager::TestCandidatesBatch(int32_t slotA, NarrowPhaseContext& context, std::vector<ContactCache::Contact>& outContacts) {
+		const ColliderSnapshot::Slot& a = snapshot_.GetSlot(slotA);
+
+		/// ===レイヤーマトリクスで除外（静的 → 動的の順）=== ///
+		context.candidateSlots.clear();
+		auto addCandidate = [&](int32_t slotB) {
+			const ColliderName nameB = snapshot_.GetSlot(slotB).name;
+			if (!layerMatrix_.ShouldCollide(a.name, nameB)) {
+				context.counters.RecordCulled(a.name, nameB);
+				return;
+			}
+			context.candidateSlots.push_back(slotB);
+		};
+		for (int32_t index : context.staticQueryBuffer) {
+			addCandidate(staticSlotBase_ + index);
+		}
+		for (int32_t proxyId : context.queryBuffer) {
+			addCandidate(static_cast<int32_t>(proxyOrder_[proxyId]));
+		}
+		if (context.candidateSlots.empty()) {
+			return;
+		}
+
+		/// ===判定=== ///
+		context.narrowPhase.Test(snapshot_, slotA, context.candidateSlots, context.candidateHits);
+
+		/// ===結果の記録（候補の並び順）=== ///
+		for (size_t i = 0; i < context.candidateSlots.size(); ++i) {
+			const ColliderSnapshot::Slot& b = snapshot_.GetSlot(context.candidateSlots[i]);
+			bool isHit = context.candidateHits[i] != 0;
+			// 静的コライダーとのペアは従来通り静的側を先にする
+			const bool isStaticB = context.candidateSlots[i] >= staticSlotBase_;
+			Collider* first = isStaticB ? b.collider : a.collider;
+			Collider* second = isStaticB ? a.collider : b.collider;
+
+		#ifdef _DEBUG
+			// ペアごとの判定と一致するか確認
+			if (isVerifyNarrowPhase_ && TestPairScalar(first, second) != isHit) {
+				++context.mismatch;
+			}
+		#endif // _DEBUG
+
+			// すり抜けた場合は掃引して判定
+			ContactCache::Contact contact{ first, second };
+			if (!isHit && (a.collider->GetIsContinuous() || b.collider->GetIsContinuous())) {
+				isHit = TestSwept(first, second, contact);
+			}
+
+			context.counters.RecordTest(a.name, b.name, isHit);
+			if (isHit) {
+				outContacts.push_back(contact);
+			}
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// ペアごとの判定
+	///-------------------------------------------///
+	bool ColliderManager::TestPairScalar(Collider* colliderA, Collider* colliderB) {
+		auto func = collisionTable_[static_cast<int>(colliderA->GetColliderType())][static_cast<int>(colliderB->GetColliderType())];
+		if (!func) {
+			return false;
+		}
+		return (this->*func)(colliderA, colliderB);
+	}
+
+	///-------------------------------------------/// 
+	/// スナップショットの作成
+	///-------------------------------------------///
+	void ColliderManager::BuildSnapshot() {
+		snapshot_.Clear();
+		// 動的コライダーはプロキシ配列順、静的コライダーはその後ろ
+		for (const ColliderProxy& proxy : registry_.GetProxies()) {
+			snapshot_.Add(proxy.owner);
+		}
+		staticSlotBase_ = snapshot_.GetSlotCount();
+		for (Collider* collider : staticColliders_) {
+			snapshot_.Add(collider);
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// 衝突イベントの通知
+	///-------------------------------------------///
+	void ColliderManager::DispatchContacts() {
+		// 衝突フラグはペアごとに上書きせず、1つでも衝突していれば立てる
+		for (const ColliderProxy& proxy : registry_.GetProxies()) {
+			proxy.owner->SetIsCollision(false);
+		}
+		for (Collider* collider : staticColliders_) {
+			collider->SetIsCollision(false);
+		}
+		for (const ContactCache::Contact& contact : contactCache_.GetContacts()) {
+			contact.a->SetIsCollision(true);
+			contact.b->SetIsCollision(true);
+		}
+
+		// 連続判定で最初に当たった時刻と位置（通知の中で位置を当たった所まで戻せるよう、通知より前に設定）
+		for (const ColliderProxy& proxy : registry_.GetProxies()) {
+			if (proxy.owner->GetIsContinuous()) {
+				proxy.owner->SetImpact(1.0f, proxy.owner->GetImpactPosition());
+			}
+		}
+		for (const ContactCache::Contact& contact : contactCache_.GetContacts()) {
+			if (contact.sweptCollider && contact.timeOfImpact < contact.sweptCollider->GetTimeOfImpact()) {
+				contact.sweptCollider->SetImpact(contact.timeOfImpact, contact.impactPosition);
+			}
+		}
+
+		// Enter/Stay/Exit をまとめて通知
+		contactCache_.Dispatch();
+	}
+
+	///-------------------------------------------/// 
+	/// 押し戻しを行うペアの追加
+	///-------------------------------------------///
+	void ColliderManager::AddSolverContact(Collider* colliderA, Collider* colliderB) {
+		contactSolver_.AddContact(colliderA, colliderB);
+	}
+
+	///-------------------------------------------/// 
+	/// レイヤーマトリクスの読み込み
+	///-------------------------------------------///
+	void ColliderManager::LoadLayerMatrix(const std::string& jsonPath) {
+		layerMatrix_.LoadFromJson(jsonPath);
+	}
+
+	///-------------------------------------------/// 
+	/// ImGui情報の更新
+	///-------------------------------------------///
+	void ColliderManager::Information() {
+	#ifdef USE_IMGUI
+		ImGui::Begin("Collision");
+		ImGui::Text("Dynamic : %u", registry_.GetCount());
+		ImGui::Text("Static  : %d", static_cast<int>(staticColliders_.size()));
+		ImGui::Text("TreeHeight : %d", broadPhase_.GetHeight());
+
+		/// ===ナローフェーズ=== ///
+		if (ImGui::TreeNode("NarrowPhase")) {
+			ImGui::Text("Time : %.4f ms", narrowPhaseTime_);
+			ImGui::Checkbox("UseSIMD", &useSimdNarrowPhase_);
+			ImGui::Checkbox("UseParallel", &useParallelNarrowPhase_);
+			ImGui::Text("Threads : %d", static_cast<int>(contexts_.size()));
+			if (contexts_.front().narrowPhase.IsAVX2Supported()) {
+				bool useAVX2 = contexts_.front().narrowPhase.GetUseAVX2();
+				if (ImGui::Checkbox("UseAVX2", &useAVX2)) {
+					for (NarrowPhaseContext& context : contexts_) {
+						context.narrowPhase.SetUseAVX2(useAVX2);
+					}
+				}
+			} else {
+				ImGui::Text("AVX2 : not supported (SSE)");
+			}
+		#ifdef _DEBUG
+			ImGui::Checkbox("Verify", &isVerifyNarrowPhase_);
+			ImGui::Text("Mismatch : %u", narrowPhaseMismatch_);
+		#endif // _DEBUG
+			ImGui::TreePop();
+		}
+
+		contactSolver_.Information();
+		layerMatrix_.Information();
+		ImGui::End();
+	#endif // USE_IMGUI
+	}
+
+	///-------------------------------------------/// 
+	/// レイキャスト
+	///-------------------------------------------///
+	bool ColliderManager::Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, RaycastHit& outHit, LayerMask layerMask) {
+		return CastShape(origin, 0.0f, direction, maxDistance, layerMask, contexts_.front(), outHit, nullptr);
+	}
+	void ColliderManager::RaycastAll(const Vector3& origin, const Vector3& direction, float maxDistance, std::vector<RaycastHit>& outHits, LayerMask layerMask) {
+		RaycastHit hit;
+		CastShape(origin, 0.0f, direction, maxDistance, layerMask, contexts_.front(), hit, &outHits);
+	}
+
+	///-------------------------------------------/// 
+	/// スフィアキャスト
+	///-------------------------------------------///
+	bool ColliderManager::SphereCast(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, RaycastHit& outHit, LayerMask layerMask) {
+		return CastShape(origin, radius, direction, maxDistance, layerMask, contexts_.front(), outHit, nullptr);
+	}
+	void ColliderManager::SphereCastAll(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, std::vector<RaycastHit>& outHits, LayerMask layerMask) {
+		RaycastHit hit;
+		CastShape(origin, radius, direction, maxDistance, layerMask, contexts_.front(), hit, &outHits);
+	}
+
+	///-------------------------------------------/// 
+	/// オーバーラップ
+	///-------------------------------------------///
+	void ColliderManager::OverlapSphere(const Sphere& sphere, std::vector<Collider*>& outColliders, LayerMask layerMask) {
+		const AABB bounds = { sphere.center - sphere.radius, sphere.center + sphere.radius };
+		OverlapShape(bounds, layerMask, [&sphere](Collider* collider) { return SceneQueryMath::OverlapSphere(sphere, collider); }, outColliders);
+	}
+	void ColliderManager::OverlapOBB(const OBB& obb, std::vector<Collider*>& outColliders, LayerMask layerMask) {
+		const AABB bounds = AABBUtil::FromOBB(obb);
+		OverlapShape(bounds, layerMask, [&obb](Collider* collider) { return SceneQueryMath::OverlapOBB(obb, collider); }, outColliders);
+	}
+
+	///-------------------------------------------/// 
+	/// まとめてキャスト
+	///-------------------------------------------///
+	void ColliderManager::RaycastBatch(const std::vector<Ray>& rays, std::vector<RaycastHit>& outHits, LayerMask layerMask) {
+		SphereCastBatch(rays, 0.0f, outHits, layerMask);
+	}
+	void ColliderManager::SphereCastBatch(const std::vector<Ray>& rays, float radius, std::vector<RaycastHit>& outHits, LayerMask layerMask) {
+		outHits.assign(rays.size(), RaycastHit{});
+		if (rays.empty()) {
+			return;
+		}
+
+		JobSystem* jobSystem = Service::Locator::GetJobSystem();
+		PrepareContexts(jobSystem ? jobSystem->GetThreadCount() : 1);
+
+		// 各キャストは自分の出力先にだけ書き込む
+		auto castRange = [&](uint32_t begin, uint32_t end, uint32_t threadIndex) {
+			for (uint32_t i = begin; i < end; ++i) {
+				const Ray& ray = rays[i];
+				CastShape(ray.origin, radius, ray.direction, ray.maxDistance, layerMask, contexts_[threadIndex], outHits[i], nullptr);
+			}
+		};
+		const uint32_t count = static_cast<uint32_t>(rays.size());
+		if (jobSystem) {
+			jobSystem->ParallelFor(count, kQueryGrainSize, castRange);
+		} else {
+			castRange(0, count, 0);
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// キャスト1回分
+	///-------------------------------------------///
+	bool ColliderManager::CastShape(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, LayerMask layerMask,
+		NarrowPhaseContext& context, RaycastHit& outHit, std::vector<RaycastHit>* outAllHits) const {
+		outHit = RaycastHit{};
+		const float length = Length(direction);
+		if (length <= 0.0f || maxDistance < 0.0f) {
+			return false;
+		}
+		const Vector3 dir = direction / length;
+
+		/// ===ブロードフェーズで候補を取得=== ///
+		context.staticQueryBuffer.clear();
+		staticBroadPhase_.RayQuery(origin, dir, maxDistance, radius, context.staticQueryBuffer);
+		std::sort(context.staticQueryBuffer.begin(), context.staticQueryBuffer.end());
+		context.queryBuffer.clear();
+		broadPhase_.RayQuery(origin, dir, maxDistance, radius, context.queryBuffer);
+
+		/// ===形状で判定=== ///
+		bool isHit = false;
+		const size_t firstHit = outAllHits ? outAllHits->size() : 0;
+		auto test = [&](Collider* collider) {
+			if ((layerMask & ToLayerMask(collider->GetColliderName())) == 0) {
+				return;
+			}
+			float distance = 0.0f;
+			Vector3 normal{};
+			const bool hit = (radius > 0.0f)
+				? SceneQueryMath::SphereCast(origin, radius, dir, maxDistance, collider, distance, normal)
+				: SceneQueryMath::Raycast(origin, dir, maxDistance, collider, distance, normal);
+			if (!hit) {
+				return;
+			}
+
+			RaycastHit result;
+			result.collider = collider;
+			result.handle = collider->GetColliderHandle();
+			result.distance = distance;
+			result.normal = normal;
+			// スフィアキャストは球の中心から法線の逆方向に半径分進んだ点
+			result.point = origin + dir * distance - normal * radius;
+
+			if (!isHit || result.distance < outHit.distance) {
+				outHit = result;
+			}
+			isHit = true;
+			if (outAllHits) {
+				outAllHits->push_back(result);
+			}
+		};
+		for (int32_t index : context.staticQueryBuffer) {
+			test(static_cast<Collider*>(staticBroadPhase_.GetUserData(index)));
+		}
+		for (int32_t proxyId : context.queryBuffer) {
+			test(static_cast<Collider*>(broadPhase_.GetUserData(proxyId)));
+		}
+
+		// 近い順に並べる
+		if (outAllHits) {
+			std::stable_sort(outAllHits->begin() + firstHit, outAllHits->end(),
+				[](const RaycastHit& a, const RaycastHit& b) { return a.distance < b.distance; });
+		}
+		return isHit;
+	}
+
+	///-------------------------------------------/// 
+	/// 重なり判定の共通処理
+	///-------------------------------------------///
+	template<class TestFunc>
+	void ColliderManager::OverlapShape(const AABB& bounds, LayerMask layerMask, const TestFunc& test, std::vector<Collider*>& outColliders) {
+		NarrowPhaseContext& context = contexts_.front();
+		context.staticQueryBuffer.clear();
+		staticBroadPhase_.Query(bounds, context.staticQueryBuffer);
+		std::sort(context.staticQueryBuffer.begin(), context.staticQueryBuffer.end());
+		context.queryBuffer.clear();
+		broadPhase_.Query(bounds, context.queryBuffer);
+
+		auto add = [&](Collider* collider) {
+			if ((layerMask & ToLayerMask(collider->GetColliderName())) != 0 && test(collider)) {
+				outColliders.push_back(collider);
+			}
+		};
+		for (int32_t index : context.staticQueryBuffer) {
+			add(static_cast<Collider*>(staticBroadPhase_.GetUserData(index)));
+		}
+		for (int32_t proxyId : context.queryBuffer) {
+			add(static_cast<Collider*>(broadPhase_.GetUserData(proxyId)));
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// ブロードフェーズの更新
+	///-------------------------------------------///
+	void ColliderManager::UpdateBroadPhase() {
+		std::vector<ColliderProxy>& proxies = registry_.GetProxies();
+		for (uint32_t order = 0; order < static_cast<uint32_t>(proxies.size()); ++order) {
+			ColliderProxy& proxy = proxies[order];
+			const AABB& bounds = snapshot_.GetBounds(static_cast<int32_t>(order));
+			Vector3 center = (bounds.min + bounds.max) * 0.5f;
+
+			if (proxy.treeProxyId == DynamicAABBTree::kNullNode) {
+				// 初回はプロキシを生成
+				proxy.treeProxyId = broadPhase_.CreateProxy(bounds, proxy.owner);
+			} else {
+				// 太らせたAABBからはみ出した時だけ組み替える
+				broadPhase_.MoveProxy(proxy.treeProxyId, bounds, center - proxy.lastCenter);
+			}
+			proxy.lastCenter = center;
+			proxy.bounds = bounds;
+			proxy.layer = snapshot_.GetSlot(static_cast<int32_t>(order)).name;
+
+			// 配列順の記録
+			if (proxyOrder_.size() < static_cast<size_t>(broadPhase_.GetNodeCapacity())) {
+				proxyOrder_.resize(broadPhase_.GetNodeCapacity());
+			}
+			proxyOrder_[proxy.treeProxyId] = order;
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// 静的BVHの構築
+	///-------------------------------------------///
+	void ColliderManager::RebuildStaticBroadPhase() {
+		std::vector<AABB> bounds;
+		std::vector<void*> userData;
+		bounds.reserve(staticColliders_.size());
+		userData.reserve(staticColliders_.size());
+		for (size_t i = 0; i < staticColliders_.size(); ++i) {
+			bounds.push_back(snapshot_.GetBounds(staticSlotBase_ + static_cast<int32_t>(i)));
+			userData.push_back(staticColliders_[i]);
+		}
+		staticBroadPhase_.Build(bounds, userData);
+		isStaticDirty_ = false;
+	}
+
+	///-------------------------------------------/// 
+	/// 静的BVHから取り除く
+	///-------------------------------------------///
+	void ColliderManager::RemoveFromStaticBroadPhase(Collider* collider) {
+		// 次の判定を待たずにシーンクエリが呼ばれても解放済みのポインタを返さないよう、
+		// BVHが保持している境界（静的コライダーは動かない）から対象を除いてすぐに作り直す
+		std::vector<AABB> bounds;
+		std::vector<void*> userData;
+		bounds.reserve(staticBroadPhase_.GetCount());
+		userData.reserve(staticBroadPhase_.GetCount());
+		for (int32_t index = 0; index < staticBroadPhase_.GetCount(); ++index) {
+			if (staticBroadPhase_.GetUserData(index) == collider) {
+				continue;
+			}
+			bounds.push_back(staticBroadPhase_.GetBounds(index));
+			userData.push_back(staticBroadPhase_.GetUserData(index));
+		}
+		staticBroadPhase_.Build(bounds, userData);
 	}
 
 	///-------------------------------------------/// 
@@ -238,50 +994,19 @@ namespace MiiEngine {
 	/// SATによるOBBvsOBB判定
 	///-------------------------------------------///
 	bool ColliderManager::OBBSATCollision(const OBB& a, const OBB& b) {
-		const float EPSILON = 1e-6f;
-
-		Vector3 axes[15] = {};
-		int axisCount = 0;
-
-		// 3軸 + 3軸
-		for (int i = 0; i < 3; ++i) {
-			axes[axisCount++] = a.axis[i];
-			axes[axisCount++] = b.axis[i];
-		}
-
-		// 交差軸
+		using V = Simd::Float1;
+		V aCenter[3] = { V::Set1(a.center.x), V::Set1(a.center.y), V::Set1(a.center.z) };
+		V bCenter[3] = { V::Set1(b.center.x), V::Set1(b.center.y), V::Set1(b.center.z) };
+		V aHalf[3] = { V::Set1(a.halfSize.x), V::Set1(a.halfSize.y), V::Set1(a.halfSize.z) };
+		V bHalf[3] = { V::Set1(b.halfSize.x), V::Set1(b.halfSize.y), V::Set1(b.halfSize.z) };
+		V aAxis[3][3];
+		V bAxis[3][3];
 		for (int i = 0; i < 3; ++i) {
-			for (int j = 0; j < 3; ++j) {
-				Vector3 cross = Math::Cross(a.axis[i], b.axis[j]);
-				if (Dot(cross) > EPSILON) {
-					axes[axisCount++] = Normalize(cross);
-				}
-			}
+			aAxis[i][0] = V::Set1(a.axis[i].x); aAxis[i][1] = V::Set1(a.axis[i].y); aAxis[i][2] = V::Set1(a.axis[i].z);
+			bAxis[i][0] = V::Set1(b.axis[i].x); bAxis[i][1] = V::Set1(b.axis[i].y); bAxis[i][2] = V::Set1(b.axis[i].z);
 		}
 
-		for (int i = 0; i < axisCount; ++i) {
-			const Vector3& axis = axes[i];
-
-			float aMin, aMax, bMin, bMax;
-			ProjectOBBOntoAxis(a, axis, aMin, aMax);
-			ProjectOBBOntoAxis(b, axis, bMin, bMax);
-
-			if (aMax < bMin || bMax < aMin) {
-				return false; // 分離軸あり → 衝突していない
-			}
-		}
-
-		return true; // 全軸で重なりあり → 衝突
-	}
-	void ColliderManager::ProjectOBBOntoAxis(const OBB& obb, const Vector3& axis, float& outMin, float& outMax) {
-		float centerProjection = Dot(obb.center, axis);
-
-		float extents =
-			std::abs(Dot(obb.axis[0] * obb.halfSize.x, axis)) +
-			std::abs(Dot(obb.axis[1] * obb.halfSize.y, axis)) +
-			std::abs(Dot(obb.axis[2] * obb.halfSize.z, axis));
-
-		outMin = centerProjection - extents;
-		outMax = centerProjection + extents;
+		// 15軸SAT（交差軸の正規化なし）
+		return NarrowPhaseMath::BoxBox(aCenter, aAxis, aHalf, bCenter, bAxis, bHalf);
 	}
 }
\ No newline at end of file
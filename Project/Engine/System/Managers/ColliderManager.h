@@ -1,9 +1,26 @@
 #pragma once
 /// ===Include=== ///
 // c++
-#include <list>
+#include <vector>
+#include <unordered_map>
 // Collider
 #include "Engine/Collider/Base/Collider.h"
+// Registry
+#include "Engine/Collider/Registry/ColliderRegistry.h"
+// BroadPhase
+#include "Engine/Collider/BroadPhase/DynamicAABBTree.h"
+#include "Engine/Collider/BroadPhase/StaticBVH.h"
+// Layer
+#include "Engine/Collider/Layer/CollisionLayerMatrix.h"
+// Contact
+#include "Engine/Collider/Contact/ContactCache.h"
+// NarrowPhase
+#include "Engine/Collider/NarrowPhase/ColliderSnapshot.h"
+#include "Engine/Collider/NarrowPhase/NarrowPhaseBatch.h"
+// Query
+#include "Engine/Collider/Query/SceneQuery.h"
+// Solver
+#include "Engine/Collider/Solver/ContactSolver.h"
 
 namespace MiiEngine {
 	/// ===前方宣言=== ///
@@ -31,7 +48,7 @@ namespace MiiEngine {
 		void Reset();
 
 		/// <summary>
-		/// コライダーの削除処理
+		/// コライダーの削除処理。動的コライダーはハンドルから O(1) で削除し、ハンドルを無効にします。
 		/// </summary>
 		/// <param name="collider">削除対象の Collider へのポインタ。</param>
 		void RemoveCollider(Collider* collider);
@@ -39,21 +56,125 @@ namespace MiiEngine {
 		/// <summary>
 		/// コライダーの追加処理
 		/// </summary>
-		/// <param name="collider">追加する Collider オブジェクトへのポインタ。nullptr の扱いは実装依存です。</param>
+		/// <param name="collider">追加する Collider オブジェクトへのポインタ。静的フラグが立っている場合は静的コライダーとして登録されます。</param>
 		void AddCollider(Collider* collider);
 
 		/// <summary>
-		/// 二つのコライダー間の衝突判定処理
+		/// ハンドルのコライダーがまだ登録されているか（削除済み・リセット済みなら false）
+		/// </summary>
+		/// <param name="handle">Collider::GetColliderHandle で取得したハンドル。</param>
+		bool IsColliderAlive(ColliderHandle handle) const;
+
+		/// <summary>
+		/// ハンドルからコライダーを取得
+		/// </summary>
+		/// <param name="handle">Collider::GetColliderHandle で取得したハンドル。</param>
+		/// <returns>登録されていない場合は nullptr。</returns>
+		Collider* GetCollider(ColliderHandle handle) const;
+
+		/// <summary>
+		/// 静的コライダーの加速構造の構築を要求します。
+		/// 形状が確定した次の判定時に一度だけ構築され、以降は静的コライダー同士の判定や再構築を行いません。
+		/// </summary>
+		void BuildStaticColliders();
+
+		/// <summary>
+		/// 二つのコライダー間の衝突判定処理。衝突していた場合はペアを記録し、通知は判定後にまとめて行います。
 		/// </summary>
 		/// <param name="colliderA">衝突判定対象の最初の Collider へのポインタ。</param>
 		/// <param name="colliderB">衝突判定対象の2番目の Collider へのポインタ。</param>
 		void CheckPairCollision(Collider* colliderA, Collider* colliderB);
 
 		/// <summary>
-		/// 全てのコライダー間の衝突判定処理
+		/// 全てのコライダー間の衝突判定処理。ブロードフェーズで候補ペアを絞り込んでから判定し、
+		/// 最後に Enter/Stay/Exit をまとめて通知します。
 		/// </summary>
 		void CheckAllCollisions();
 
+		/// <summary>
+		/// 押し戻しを行うペアを追加します。OnCollision 内で呼び出すと、その判定の通知後にまとめて解消されます。
+		/// </summary>
+		/// <param name="colliderA">1番目のコライダー。</param>
+		/// <param name="colliderB">2番目のコライダー。</param>
+		void AddSolverContact(Collider* colliderA, Collider* colliderB);
+
+		/// <summary>
+		/// レイヤーマトリクスをJSONから読み込み
+		/// </summary>
+		/// <param name="jsonPath">読み込むJSONファイルのパス。</param>
+		void LoadLayerMatrix(const std::string& jsonPath);
+
+		/// <summary>
+		/// ImGui情報の更新
+		/// </summary>
+		void Information();
+
+		/// ===シーンクエリ=== ///
+		// ブロードフェーズは直前の CheckAllCollisions 時点のものを使用し、形状は現在の値で判定します。
+		// それ以降に追加された動的コライダーは対象になりません。ジョブの中からは呼び出さないでください。
+
+		/// <summary>
+		/// レイを飛ばして最も近い衝突を取得
+		/// </summary>
+		/// <param name="origin">始点。</param>
+		/// <param name="direction">方向（正規化は不要）。</param>
+		/// <param name="maxDistance">最大距離。</param>
+		/// <param name="outHit">最も近い衝突の出力先。</param>
+		/// <param name="layerMask">対象にするレイヤー。</param>
+		/// <returns>当たった場合は true。</returns>
+		bool Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, RaycastHit& outHit, LayerMask layerMask = kLayerMaskAll);
+
+		/// <summary>
+		/// レイを飛ばして全ての衝突を近い順に取得
+		/// </summary>
+		/// <param name="outHits">衝突の出力先。呼び出し側でクリアしてください。</param>
+		void RaycastAll(const Vector3& origin, const Vector3& direction, float maxDistance, std::vector<RaycastHit>& outHits, LayerMask layerMask = kLayerMaskAll);
+
+		/// <summary>
+		/// 球を移動させて最初に接触する衝突を取得
+		/// </summary>
+		/// <param name="origin">球の中心の始点。</param>
+		/// <param name="radius">球の半径。</param>
+		/// <param name="direction">方向（正規化は不要）。</param>
+		/// <param name="maxDistance">最大距離。</param>
+		/// <param name="outHit">最も近い衝突の出力先。</param>
+		/// <param name="layerMask">対象にするレイヤー。</param>
+		/// <returns>接触した場合は true。</returns>
+		bool SphereCast(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, RaycastHit& outHit, LayerMask layerMask = kLayerMaskAll);
+
+		/// <summary>
+		/// 球を移動させて接触する全ての衝突を近い順に取得
+		/// </summary>
+		/// <param name="outHits">衝突の出力先。呼び出し側でクリアしてください。</param>
+		void SphereCastAll(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, std::vector<RaycastHit>& outHits, LayerMask layerMask = kLayerMaskAll);
+
+		/// <summary>
+		/// 球と重なっているコライダーを取得
+		/// </summary>
+		/// <param name="outColliders">重なっているコライダーの出力先。呼び出し側でクリアしてください。</param>
+		void OverlapSphere(const Sphere& sphere, std::vector<Collider*>& outColliders, LayerMask layerMask = kLayerMaskAll);
+
+		/// <summary>
+		/// OBBと重なっているコライダーを取得
+		/// </summary>
+		/// <param name="outColliders">重なっているコライダーの出力先。呼び出し側でクリアしてください。</param>
+		void OverlapOBB(const OBB& obb, std::vector<Collider*>& outColliders, LayerMask layerMask = kLayerMaskAll);
+
+		/// <summary>
+		/// 複数のレイをまとめて飛ばす（ジョブシステムで並列に処理）
+		/// </summary>
+		/// <param name="rays">飛ばすレイ。</param>
+		/// <param name="outHits">レイごとの最も近い衝突。当たらなかったレイは collider が nullptr になります。</param>
+		void RaycastBatch(const std::vector<Ray>& rays, std::vector<RaycastHit>& outHits, LayerMask layerMask = kLayerMaskAll);
+
+		/// <summary>
+		/// 複数のスフィアキャストをまとめて行う（ジョブシステムで並列に処理）
+		/// </summary>
+		/// <param name="rays">球の中心の移動。</param>
+		/// <param name="radius">球の半径。</param>
+		/// <param name="outHits">キャストごとの最も近い衝突。当たらなかったものは collider が nullptr になります。</param>
+		void SphereCastBatch(const std::vector<Ray>& rays, float radius, std::vector<RaycastHit>& outHits, LayerMask layerMask = kLayerMaskAll);
+
 	public: /// ===Setter=== ///
 		// Lightの設定
 		void SetLight(LightType type);
@@ -61,8 +182,71 @@ namespace MiiEngine {
 
 	private: /// ===変数=== ///
 
-		// コライダーのリスト
-		std::list<Collider*> colliders_;
+		// 動的コライダー（世代付きハンドルで引き、プロキシは詰めて並ぶ）
+		ColliderRegistry registry_;
+		// 静的コライダーのリスト（ハンドルは発行しない）
+		std::vector<Collider*> staticColliders_;
+
+		/// ===ブロードフェーズ=== ///
+		// 動的AABB木
+		DynamicAABBTree broadPhase_;
+		// 木のプロキシIDごとのプロキシ配列内の位置（判定順を配列順に揃えるために使用）
+		std::vector<uint32_t> proxyOrder_;
+		// 静的コライダー用BVH
+		StaticBVH staticBroadPhase_;
+		// 静的BVHの再構築が必要か
+		bool isStaticDirty_ = false;
+
+		// レイヤーマトリクス
+		CollisionLayerMatrix layerMatrix_;
+		// 衝突ペアのキャッシュ
+		ContactCache contactCache_;
+		// 押し戻しのソルバー
+		ContactSolver contactSolver_;
+
+		/// ===ナローフェーズ=== ///
+		// 今フレームの形状（スロットは動的コライダーのプロキシ配列順、静的コライダーはその後ろ）
+		ColliderSnapshot snapshot_;
+		// 静的コライダーの先頭スロット
+		int32_t staticSlotBase_ = 0;
+		// スレッドごとの作業領域（スレッド番号 0 は呼び出し元）
+		struct NarrowPhaseContext {
+			std::vector<int32_t> queryBuffer;         // 動的コライダーの検索結果
+			std::vector<int32_t> staticQueryBuffer;   // 静的コライダーの検索結果
+			std::vector<int32_t> candidateSlots;      // 判定候補
+			std::vector<uint8_t> candidateHits;       // 判定結果
+			NarrowPhaseBatch narrowPhase;             // 1対多のバッチ判定
+			CollisionLayerMatrix::FrameCounters counters; // レイヤーペアごとの回数
+			uint32_t mismatch = 0;                    // 照合で不一致だった回数
+		};
+		std::vector<NarrowPhaseContext> contexts_;
+		// チャンクごとの衝突ペア（チャンク順に結合することで逐次処理と同じ順序になる）
+		std::vector<std::vector<ContactCache::Contact>> chunkContacts_;
+		// 1チャンクで処理する動的コライダー数
+		static constexpr uint32_t kNarrowPhaseGrainSize = 16;
+		// 1チャンクで処理するクエリ数
+		static constexpr uint32_t kQueryGrainSize = 8;
+		// バッチ判定を使用するか（false でペアごとの判定）
+		bool useSimdNarrowPhase_ = true;
+		// ジョブシステムで並列に判定するか（バッチ判定時のみ）
+		bool useParallelNarrowPhase_ = true;
+		// 今フレームの判定時間（ms）
+		double narrowPhaseTime_ = 0.0;
+
+		/// ===連続判定=== ///
+		// 前フレームの判定時点の位置と向き（連続判定を行う動的コライダーのみ）
+		struct SweepState {
+			Vector3 center{};
+			Vector3 axis[3]{};
+		};
+		std::unordered_map<Collider*, SweepState> sweepStates_;
+
+	#ifdef _DEBUG
+		// ペアごとの判定と結果を照合するか
+		bool isVerifyNarrowPhase_ = false;
+		// 照合で不一致だった回数
+		uint32_t narrowPhaseMismatch_ = 0;
+	#endif // _DEBUG
 
 		// 衝突判定関数の型定義
 		using CollisionFunc = bool (ColliderManager::*)(Collider*, Collider*);
@@ -72,6 +256,106 @@ namespace MiiEngine {
 
 	private: /// ===関数=== ///
 
+		/// <summary>
+		/// 全コライダーの形状をスナップショットに書き出す
+		/// </summary>
+		void BuildSnapshot();
+
+		/// <summary>
+		/// 動的コライダーの判定候補をブロードフェーズから取得（自分より後ろの動的コライダーと静的コライダー）
+		/// </summary>
+		/// <param name="slotA">判定する側のスロット番号。</param>
+		/// <param name="context">結果を書き込む作業領域。</param>
+		void QueryCandidates(int32_t slotA, NarrowPhaseContext& context) const;
+
+		/// <summary>
+		/// ブロードフェーズの候補をまとめて判定し、衝突したペアを出力（複数スレッドから同時に呼び出せます）
+		/// </summary>
+		/// <param name="slotA">判定する側のスロット番号。</param>
+		/// <param name="context">このスレッドの作業領域。</param>
+		/// <param name="outContacts">衝突したペアの出力先。</param>
+		void TestCandidatesBatch(int32_t slotA, NarrowPhaseContext& context, std::vector<ContactCache::Contact>& outContacts);
+
+		/// <summary>
+		/// バッチ判定で全ての動的コライダーを判定し、結果を登録順に結合
+		/// </summary>
+		void RunBatchNarrowPhase();
+
+		/// <summary>
+		/// 連続判定を行うコライダーの境界を、前フレームの形状を含むように広げる
+		/// </summary>
+		void ApplySweptBounds();
+
+		/// <summary>
+		/// 連続判定を行うコライダーの今フレームの位置と向きを記録
+		/// </summary>
+		void RecordSweepStates();
+
+		/// <summary>
+		/// どちらかが連続判定を行う場合に、前フレームからの移動を掃引して判定（複数スレッドから同時に呼び出せます）
+		/// </summary>
+		/// <param name="outContact">接触していた場合に、当たった時刻・掃引した側・その時の中心を書き込む出力先。</param>
+		/// <returns>移動中に接触していた場合は true。</returns>
+		bool TestSwept(Collider* colliderA, Collider* colliderB, ContactCache::Contact& outContact) const;
+
+		/// <summary>
+		/// 移動するコライダーを、止まっている相手に対して掃引
+		/// </summary>
+		/// <param name="mover">連続判定を行うコライダー。</param>
+		/// <param name="target">相手のコライダー（今フレームの形状）。</param>
+		/// <param name="outTime">接触した時刻 [0, 1]。</param>
+		/// <param name="outCenter">接触した時刻での mover の中心。</param>
+		/// <returns>移動中に接触していた場合は true。</returns>
+		bool SweepCollider(Collider* mover, Collider* target, float& outTime, Vector3& outCenter) const;
+
+		/// <summary>
+		/// スレッドごとの作業領域を指定数まで用意
+		/// </summary>
+		void PrepareContexts(uint32_t threadCount);
+
+		/// <summary>
+		/// レイ・スフィアキャスト1回分の処理
+		/// </summary>
+		/// <param name="radius">0 の場合はレイ。</param>
+		/// <param name="context">検索結果の作業領域。</param>
+		/// <param name="outHit">最も近い衝突の出力先。</param>
+		/// <param name="outAllHits">全ての衝突の出力先（nullptr の場合は最も近い衝突のみ）。</param>
+		/// <returns>当たった場合は true。</returns>
+		bool CastShape(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, LayerMask layerMask,
+			NarrowPhaseContext& context, RaycastHit& outHit, std::vector<RaycastHit>* outAllHits) const;
+
+		/// <summary>
+		/// AABBと重なる候補のうち、判定式を満たすコライダーを出力（静的 → 動的の順）
+		/// </summary>
+		template<class TestFunc>
+		void OverlapShape(const AABB& bounds, LayerMask layerMask, const TestFunc& test, std::vector<Collider*>& outColliders);
+
+		/// <summary>
+		/// 登録されている判定関数でペアを判定（記録は行わない）
+		/// </summary>
+		/// <returns>衝突している場合は true。</returns>
+		bool TestPairScalar(Collider* colliderA, Collider* colliderB);
+
+		/// <summary>
+		/// ブロードフェーズの更新処理。各動的コライダーのプロキシを生成・移動します。
+		/// </summary>
+		void UpdateBroadPhase();
+
+		/// <summary>
+		/// 静的コライダーのBVHを構築
+		/// </summary>
+		void RebuildStaticBroadPhase();
+
+		/// <summary>
+		/// 静的コライダーのBVHから指定したコライダーを取り除く
+		/// </summary>
+		void RemoveFromStaticBroadPhase(Collider* collider);
+
+		/// <summary>
+		/// 衝突フラグを更新し、記録したペアの衝突イベントを通知
+		/// </summary>
+		void DispatchContacts();
+
 		// 各当たり判定関数（Collider*を受け取るラッパー）
 		bool Sphere_Sphere(Collider* a, Collider* b);
 		bool AABB_AABB(Collider* a, Collider* b);
@@ -133,20 +417,12 @@ namespace MiiEngine {
 
 		/// <summary>
 		/// 分離軸定理（SAT）に基づいて、2つのOBB（向き付き境界ボックス）間の衝突（交差）を判定します。
+		/// 軸が正規化・直交済みである前提で、15軸を正規化せずに判定します。
 		/// </summary>
 		/// <param name="a">判定対象の最初のOBB。const参照で渡され、関数内で変更されません。</param>
 		/// <param name="b">判定対象の2番目のOBB。const参照で渡され、関数内で変更されません。</param>
 		/// <returns>2つのOBBが交差している場合はtrue、交差していない場合はfalseを返します。</returns>
 		bool OBBSATCollision(const OBB& a, const OBB& b);
-
-		/// <summary>
-		/// OBB（向き付き境界ボックス）を指定した軸に射影し、軸上の最小・最大スカラー値を計算します。
-		/// </summary>
-		/// <param name="obb">射影される向き付き境界ボックス（const参照）。</param>
-		/// <param name="axis">射影に用いる軸ベクトル（const参照）。通常は単位ベクトルを渡しますが、非正規化ベクトルも扱えます。</param>
-		/// <param name="outMin">出力パラメーター。軸上の最小射影値を格納する参照。</param>
-		/// <param name="outMax">出力パラメーター。軸上の最大射影値を格納する参照。</param>
-		void ProjectOBBOntoAxis(const OBB& obb, const Vector3& axis, float& outMin, float& outMax);
 	};
 }
 
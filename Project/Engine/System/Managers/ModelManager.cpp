@@ -45,13 +45,13 @@ namespace MiiEngine {
 		}
 
 		// モデルをMapコンテナに格納
-		modelDates_[Key] = modelDate;
+		modelDates_[Key] = std::make_shared<const ModelData>(std::move(modelDate));
 	}
 
 	///-------------------------------------------/// 
 	/// Getter
 	///-------------------------------------------///
-	ModelData ModelManager::GetModelData(const std::string& directorPath) {
+	std::shared_ptr<const ModelData> ModelManager::GetModelData(const std::string& directorPath) {
 		assert(modelDates_.contains(directorPath));
 		return modelDates_.at(directorPath);
 	}
@@ -8,6 +8,7 @@
 // C++
 #include <string>
 #include <map>
+#include <memory>
 // assimp
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
@@ -43,19 +44,19 @@ namespace MiiEngine {
 		void Load(const std::string& Key, const std::string& baseDirectoryPath, const std::string& filename);
 
 		/// <summary>
-		/// モデルデータの取得
+		/// モデルデータの取得（読み込み済みのデータを共有し、コピーはしない）
 		/// </summary>
 		/// <param name="filename">読み込むモデルファイルのパスまたはファイル名（const std::string&）。</param>
-		/// <returns>読み込まれたモデル情報を含む ModelData オブジェクト。読み込み失敗時の挙動（例: 例外を投げる、空の ModelData を返すなど）は実装依存です。</returns>
-		ModelData GetModelData(const std::string& filename);
+		/// <returns>読み込まれたモデル情報を含む ModelData への共有ポインタ。内容は変更できません。</returns>
+		std::shared_ptr<const ModelData> GetModelData(const std::string& filename);
 
 	private:/// ===Variables(変数)=== ///
 
 		// テクスチャマネージャ
 		TextureManager* textureManager_ = nullptr;
 
-		// モデルデータ
-		std::map<std::string, ModelData> modelDates_;
+		// モデルデータ（読み込み後は変更しないので、全てのインスタンスで共有する）
+		std::map<std::string, std::shared_ptr<const ModelData>> modelDates_;
 
 	private:/// ===Functions(関数)=== ///
 
@@ -1,15 +1,39 @@
 #include "ParticleManager.h"
 // c++
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <cassert>
+#include <random>
+// Job
+#include "Engine/System/Job/JobSystem.h"
+// Service
+#include "Service/Locator.h"
+// ImGui
+#ifdef USE_IMGUI
+#include "imgui.h"
+#endif // USE_IMGUI
 
 namespace MiiEngine {
+	///-------------------------------------------/// 
+	/// コンストラクタ
+	///-------------------------------------------///
+	ParticleManager::ParticleManager() {
+		// シードを指定しない場合は起動ごとに異なる発生にする
+		std::random_device seedGenerator;
+		const uint64_t seed = (static_cast<uint64_t>(seedGenerator()) << 32) | seedGenerator();
+		seedGenerator_.Seed(seed);
+	}
+
 	///-------------------------------------------/// 
 	/// デストラクタ
 	///-------------------------------------------///
 	ParticleManager::~ParticleManager() {
-		definitions_.clear();
 		activeParticles_.clear();
+		activeEntries_.clear();
+		handleSlots_.clear();
+		definitionSlots_.clear();
+		definitionIds_.clear();
 	}
 
 	///-------------------------------------------/// 
@@ -33,11 +57,11 @@ namespace MiiEngine {
 			// JSONからParticleDefinitionを生成
 			ParticleDefinition def = ParticleDefinition::FromJson(j);
 			// すでに定義が存在していたらreturn
-			if (definitions_.find(def.name) != definitions_.end()) {
+			if (HasDefinition(def.name)) {
 				return;
 			}
 			// 定義を追加
-			definitions_[def.name] = def;
+			AddParticleDefinition(def.name, def);
 
 		} catch (const std::exception& e) {
 			// エラーハンドリング（ログ出力など）
@@ -50,46 +74,191 @@ namespace MiiEngine {
 	/// パーティクル定義の追加（直接指定）
 	///-------------------------------------------///
 	void ParticleManager::AddParticleDefinition(const std::string& name, const ParticleDefinition& definition) {
-		definitions_[name] = definition;
+		DefinitionSlot* slot = GetSlot(GetDefinitionId(name));
+		if (slot->definition) {
+			*slot->definition = definition;
+		} else {
+			slot->definition = std::make_unique<ParticleDefinition>(definition);
+		}
 	}
 
 	///-------------------------------------------/// 
 	/// 発生
 	///-------------------------------------------///
-	ParticleGroup* ParticleManager::Emit(const std::string& name, const Vector3& translate) {
+	ParticleHandle ParticleManager::Emit(const std::string& name, const Vector3& translate) {
+		return Emit(name, translate, seedGenerator_.NextUInt64());
+	}
+	ParticleHandle ParticleManager::Emit(const std::string& name, const Vector3& translate, uint64_t seed) {
+		return Emit(FindDefinitionId(name), translate, seed);
+	}
+	ParticleHandle ParticleManager::Emit(ParticleDefinitionId id, const Vector3& translate) {
+		return Emit(id, translate, seedGenerator_.NextUInt64());
+	}
+	ParticleHandle ParticleManager::Emit(ParticleDefinitionId id, const Vector3& translate, uint64_t seed) {
 		// 定義が存在するか確認
-		auto it = definitions_.find(name);
-		if (it == definitions_.end()) {
-			return nullptr; // 定義が見つからない
+		DefinitionSlot* slot = GetSlot(id);
+		if (!slot || !slot->definition) {
+			return {}; // 定義が見つからない
 		}
 
-		// 新しいParticleGroupを作成
-		auto particleGroup = std::make_unique<ParticleGroup>();
-		particleGroup->Initialize(translate, it->second);
+		// プールにあれば使い回し、なければ新しく作成
+		GroupPool& pool = slot->pool;
+		std::unique_ptr<ParticleGroup> particleGroup;
+		if (!pool.freeGroups.empty()) {
+			particleGroup = std::move(pool.freeGroups.back());
+			pool.freeGroups.pop_back();
+			++pool.hitCount;
+		} else {
+			particleGroup = std::make_unique<ParticleGroup>();
+			++pool.missCount;
+		}
+		particleGroup->Initialize(translate, *slot->definition, seed);
 
-		// ポインタを保存してから返す
+		// ハンドルを割り当て、定義ごとの一覧にも登録
 		ParticleGroup* ptr = particleGroup.get();
+		const ParticleHandle handle = AcquireHandle(ptr);
+		slot->activeGroups.push_back(ptr);
 		activeParticles_.push_back(std::move(particleGroup));
+		activeEntries_.push_back({ id, handle.index });
 
-		return ptr;
+		return handle;
+	}
+
+	///-------------------------------------------/// 
+	/// グループプールの事前確保
+	///-------------------------------------------///
+	void ParticleManager::PrewarmGroups(const std::string& name, uint32_t count) {
+		DefinitionSlot* slot = GetSlot(FindDefinitionId(name));
+		if (!slot || !slot->definition) {
+			return;
+		}
+
+		GroupPool& pool = slot->pool;
+		count = (std::min)(count, kMaxPooledGroups);
+		while (pool.freeGroups.size() < count) {
+			auto particleGroup = std::make_unique<ParticleGroup>();
+			particleGroup->Prewarm(*slot->definition);
+			pool.freeGroups.push_back(std::move(particleGroup));
+		}
 	}
 
 	///-------------------------------------------/// 
 	/// 全てのParticleの更新
 	///-------------------------------------------///
 	void ParticleManager::Update() {
-		// 完了したパーティクルを削除
-		activeParticles_.erase(
-			std::remove_if(activeParticles_.begin(), activeParticles_.end(),
-				[](const std::unique_ptr<ParticleGroup>& particle) {
-					return particle->IsFinish();
-				}),
-			activeParticles_.end()
-		);
-
-		// アクティブなパーティクルを更新
-		for (auto& particle : activeParticles_) {
-			particle->Update();
+		using Clock = std::chrono::high_resolution_clock;
+		const Clock::time_point start = Clock::now();
+
+		JobSystem* jobSystem = useParallelUpdate_ ? Service::Locator::GetJobSystem() : nullptr;
+		threadUpdateTimes_.assign(jobSystem ? jobSystem->GetThreadCount() : 1, 0.0);
+
+		// 予算に合わせて各グループの発生数の倍率を決める
+		UpdateBudget();
+
+		const uint32_t count = static_cast<uint32_t>(activeParticles_.size());
+		finishedFlags_.assign(count, 0);
+
+		/// ===グループごとに更新=== ///
+		// 各グループは自分のプール・乱数・インスタンシングバッファだけを書き換えるため、
+		// グループ同士で書き込み先が重なることはない（描画は全て終わった後にメインスレッドで行う）
+		auto updateRange = [this](uint32_t begin, uint32_t end, uint32_t threadIndex) {
+			const Clock::time_point rangeStart = Clock::now();
+			for (uint32_t i = begin; i < end; ++i) {
+				ParticleGroup* particle = activeParticles_[i].get();
+				particle->Update();
+				finishedFlags_[i] = particle->IsFinish() ? 1 : 0;
+			}
+			threadUpdateTimes_[threadIndex] += std::chrono::duration<double, std::milli>(Clock::now() - rangeStart).count();
+		};
+		if (jobSystem) {
+			jobSystem->ParallelFor(count, kUpdateGrainSize, updateRange);
+		} else {
+			updateRange(0, count, 0);
+		}
+
+		/// ===終了したグループを1回の走査でまとめてプールへ戻す（残りの順番は保持）=== ///
+		uint32_t aliveCount = 0;
+		totalParticleCount_ = 0;
+		suppressedParticleCount_ = 0;
+		for (uint32_t i = 0; i < count; ++i) {
+			suppressedParticleCount_ += activeParticles_[i]->GetSuppressedCount();
+			if (finishedFlags_[i] != 0) {
+				DetachGroup(activeEntries_[i], activeParticles_[i].get());
+				RecycleGroup(activeEntries_[i].id, std::move(activeParticles_[i]));
+				continue;
+			}
+			totalParticleCount_ += activeParticles_[i]->GetActiveParticleCount();
+			if (aliveCount != i) {
+				activeParticles_[aliveCount] = std::move(activeParticles_[i]);
+				activeEntries_[aliveCount] = activeEntries_[i];
+			}
+			++aliveCount;
+		}
+		activeParticles_.resize(aliveCount);
+		activeEntries_.resize(aliveCount);
+
+		updateTime_ = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	///-------------------------------------------/// 
+	/// 予算の配分
+	///-------------------------------------------///
+	void ParticleManager::UpdateBudget() {
+		const uint32_t count = static_cast<uint32_t>(activeParticles_.size());
+
+		/// ===絞らなかった場合の粒子数を推定=== ///
+		// 前フレームの倍率で割り戻す（倍率が小さく粒子が残っていない場合は最大数とみなす）
+		budgetDemands_.resize(count);
+		float totalDemand = 0.0f;
+		for (uint32_t i = 0; i < count; ++i) {
+			const ParticleGroup* particle = activeParticles_[i].get();
+			const float capacity = static_cast<float>(particle->GetMaxInstance());
+			const float alive = static_cast<float>(particle->GetActiveParticleCount());
+			const float scale = particle->GetBudgetScale();
+			float demand = alive;
+			if (scale < 1.0f) {
+				demand = (alive > 0.0f) ? alive / (std::max)(scale, kMinEstimateScale) : capacity;
+			}
+			budgetDemands_[i] = (std::min)(demand, capacity);
+			totalDemand += budgetDemands_[i];
+		}
+
+		/// ===予算内なら絞らない=== ///
+		isOverBudget_ = (particleBudget_ != 0) && (totalDemand > static_cast<float>(particleBudget_));
+		if (!isOverBudget_) {
+			for (const auto& particle : activeParticles_) {
+				particle->SetBudgetScale(1.0f);
+			}
+			return;
+		}
+
+		/// ===最低保証分を先に確保=== ///
+		float remaining = static_cast<float>(particleBudget_);
+		for (uint32_t i = 0; i < count; ++i) {
+			const float guarantee = static_cast<float>(activeParticles_[i]->GetDefinition().budget.minimumGuarantee);
+			remaining -= (std::min)(guarantee, budgetDemands_[i]);
+		}
+		remaining = (std::max)(remaining, 0.0f);
+
+		/// ===残りを優先度の高い順に割り当てる（同じ優先度は先に発生した順）=== ///
+		budgetOrder_.resize(count);
+		for (uint32_t i = 0; i < count; ++i) {
+			budgetOrder_[i] = i;
+		}
+		std::stable_sort(budgetOrder_.begin(), budgetOrder_.end(), [this](uint32_t a, uint32_t b) {
+			return activeParticles_[a]->GetDefinition().budget.priority > activeParticles_[b]->GetDefinition().budget.priority;
+		});
+		for (uint32_t index : budgetOrder_) {
+			ParticleGroup* particle = activeParticles_[index].get();
+			const float demand = budgetDemands_[index];
+			if (demand <= 0.0f) {
+				particle->SetBudgetScale(1.0f);
+				continue;
+			}
+			const float guarantee = (std::min)(static_cast<float>(particle->GetDefinition().budget.minimumGuarantee), demand);
+			const float extra = (std::min)(demand - guarantee, remaining);
+			remaining -= extra;
+			particle->SetBudgetScale((guarantee + extra) / demand);
 		}
 	}
 
@@ -106,202 +275,411 @@ namespace MiiEngine {
 	/// 停止処理
 	///-------------------------------------------///
 	void ParticleManager::StopParticle(const std::string& name) {
-		// アクティブなパーティクルから該当する名前のものを全て停止
-		for (auto& particle : activeParticles_) {
-			if (particle->GetDefinition().name == name) {
+		StopParticle(FindDefinitionId(name));
+	}
+	void ParticleManager::StopParticle(ParticleDefinitionId id) {
+		// 定義ごとの一覧から該当するものを全て停止
+		if (DefinitionSlot* slot = GetSlot(id)) {
+			for (ParticleGroup* particle : slot->activeGroups) {
 				particle->Stop();
 			}
 		}
 	}
+	void ParticleManager::Stop(ParticleHandle handle) {
+		if (ParticleGroup* particle = GetGroup(handle)) {
+			particle->Stop();
+		}
+	}
 
 	///-------------------------------------------/// 
 	/// パーティクル削除
 	///-------------------------------------------///
 	void ParticleManager::RemoveParticleDefinition(const std::string& name) {
-		// 定義から削除
-		definitions_.erase(name);
+		const ParticleDefinitionId id = FindDefinitionId(name);
+		DefinitionSlot* slot = GetSlot(id);
+		if (!slot) {
+			return;
+		}
 
-		// アクティブなパーティクルからも該当するものを削除
-		activeParticles_.erase(
-			std::remove_if(activeParticles_.begin(), activeParticles_.end(),
-				[&name](const std::unique_ptr<ParticleGroup>& particle) {
-					return particle->GetDefinition().name == name;
-				}),
-			activeParticles_.end()
-		);
+		// 定義から削除（番号は同じ名前のために残す）
+		slot->definition.reset();
+		slot->pool = GroupPool{};
+
+		// アクティブなパーティクルからも該当するものを削除（残りの順番は保持）
+		uint32_t aliveCount = 0;
+		for (uint32_t i = 0; i < activeParticles_.size(); ++i) {
+			if (activeEntries_[i].id == id) {
+				DetachGroup(activeEntries_[i], activeParticles_[i].get());
+				activeParticles_[i].reset();
+				continue;
+			}
+			if (aliveCount != i) {
+				activeParticles_[aliveCount] = std::move(activeParticles_[i]);
+				activeEntries_[aliveCount] = activeEntries_[i];
+			}
+			++aliveCount;
+		}
+		activeParticles_.resize(aliveCount);
+		activeEntries_.resize(aliveCount);
 	}
 
 	///-------------------------------------------/// 
 	/// 全てのパーティクルを削除
 	///-------------------------------------------///
 	void ParticleManager::RemoveAllParticles() {
+		for (size_t i = 0; i < activeParticles_.size(); ++i) {
+			DetachGroup(activeEntries_[i], activeParticles_[i].get());
+			RecycleGroup(activeEntries_[i].id, std::move(activeParticles_[i]));
+		}
 		activeParticles_.clear();
+		activeEntries_.clear();
+	}
+
+	///-------------------------------------------/// 
+	/// グループにハンドルを割り当てる
+	///-------------------------------------------///
+	ParticleHandle ParticleManager::AcquireHandle(ParticleGroup* particle) {
+		uint32_t index;
+		if (!freeHandleSlots_.empty()) {
+			index = freeHandleSlots_.back();
+			freeHandleSlots_.pop_back();
+		} else {
+			index = static_cast<uint32_t>(handleSlots_.size());
+			handleSlots_.emplace_back();
+		}
+		handleSlots_[index].group = particle;
+		return { index, handleSlots_[index].generation };
+	}
+
+	///-------------------------------------------/// 
+	/// アクティブな一覧から外したグループの後始末
+	///-------------------------------------------///
+	void ParticleManager::DetachGroup(const ActiveEntry& entry, const ParticleGroup* particle) {
+		// ハンドルを無効化（世代を進めて空きに戻す）
+		HandleSlot& handleSlot = handleSlots_[entry.handleIndex];
+		handleSlot.group = nullptr;
+		++handleSlot.generation;
+		freeHandleSlots_.push_back(entry.handleIndex);
+
+		// 定義ごとの一覧から外す（順番は問わないので末尾と入れ替える）
+		std::vector<ParticleGroup*>& groups = definitionSlots_[static_cast<uint32_t>(entry.id)].activeGroups;
+		auto it = std::find(groups.begin(), groups.end(), particle);
+		if (it != groups.end()) {
+			*it = groups.back();
+			groups.pop_back();
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// グループをプールへ戻す
+	///-------------------------------------------///
+	void ParticleManager::RecycleGroup(ParticleDefinitionId id, std::unique_ptr<ParticleGroup> particle) {
+		// 定義が削除されている場合は破棄
+		DefinitionSlot* slot = GetSlot(id);
+		if (!slot || !slot->definition) {
+			return;
+		}
+		if (slot->pool.freeGroups.size() < kMaxPooledGroups) {
+			slot->pool.freeGroups.push_back(std::move(particle));
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// ImGui情報の更新
+	///-------------------------------------------///
+	void ParticleManager::Information() {
+	#ifdef USE_IMGUI
+		ImGui::Begin("Particle");
+		int culledCount = 0;
+		for (const auto& particle : activeParticles_) {
+			if (particle->IsCulled()) {
+				++culledCount;
+			}
+		}
+		ImGui::Text("Groups : %d (Culled %d)", static_cast<int>(activeParticles_.size()), culledCount);
+
+		/// ===予算=== ///
+		if (ImGui::TreeNode("Budget")) {
+			int budget = static_cast<int>(particleBudget_);
+			if (ImGui::DragInt("Budget", &budget, 64.0f, 0, 1 << 20)) {
+				particleBudget_ = static_cast<uint32_t>(budget);
+			}
+			ImGui::Text("Active : %u / Suppressed : %u", totalParticleCount_, suppressedParticleCount_);
+			ImGui::Text("OverBudget : %s", isOverBudget_ ? "true" : "false");
+			for (const auto& particle : activeParticles_) {
+				if (particle->GetBudgetScale() < 1.0f) {
+					ImGui::Text("%s : x%.2f (Priority %d)", particle->GetDefinition().name.c_str(),
+						particle->GetBudgetScale(), particle->GetDefinition().budget.priority);
+				}
+			}
+			ImGui::TreePop();
+		}
+
+		/// ===更新時間=== ///
+		if (ImGui::TreeNode("Update")) {
+			ImGui::Checkbox("UseParallel", &useParallelUpdate_);
+			ImGui::Text("Time : %.4f ms", updateTime_);
+			for (size_t i = 0; i < threadUpdateTimes_.size(); ++i) {
+				ImGui::Text("Thread %d : %.4f ms", static_cast<int>(i), threadUpdateTimes_[i]);
+			}
+			ImGui::TreePop();
+		}
+
+		/// ===グループプール=== ///
+		if (ImGui::TreeNode("GroupPool")) {
+			for (const DefinitionSlot& slot : definitionSlots_) {
+				if (!slot.definition) {
+					continue;
+				}
+				const GroupPool& pool = slot.pool;
+				const uint32_t total = pool.hitCount + pool.missCount;
+				const float hitRate = (total > 0) ? 100.0f * static_cast<float>(pool.hitCount) / static_cast<float>(total) : 0.0f;
+				ImGui::Text("%s : Free %d / Hit %u / Miss %u (%.1f%%)",
+					slot.name.c_str(), static_cast<int>(pool.freeGroups.size()), pool.hitCount, pool.missCount, hitRate);
+			}
+			ImGui::TreePop();
+		}
+		ImGui::End();
+	#endif // USE_IMGUI
 	}
 
 	///-------------------------------------------/// 
 	/// テクスチャ設定
 	///-------------------------------------------///
 	void ParticleManager::SetTexture(const std::string& name, const std::string& textureName) {
+		DefinitionSlot* slot = GetSlot(FindDefinitionId(name));
+		if (!slot) {
+			return;
+		}
+
 		// 定義を更新
-		auto defIt = definitions_.find(name);
-		if (defIt != definitions_.end()) {
-			defIt->second.appearance.texturePath = textureName;
+		if (slot->definition) {
+			slot->definition->appearance.texturePath = textureName;
 		}
 
 		// アクティブなパーティクルにも適用
-		for (auto& particle : activeParticles_) {
-			if (particle->GetDefinition().name == name) {
-				particle->SetTexture(textureName);
-			}
+		for (ParticleGroup* particle : slot->activeGroups) {
+			particle->SetTexture(textureName);
 		}
 	}
 
+	///-------------------------------------------/// 
+	/// シード設定
+	///-------------------------------------------///
+	void ParticleManager::SetSeed(uint64_t seed) {
+		seedGenerator_.Seed(seed);
+	}
+
+	///-------------------------------------------/// 
+	/// 粒子数の予算を設定
+	///-------------------------------------------///
+	void ParticleManager::SetParticleBudget(uint32_t budget) {
+		particleBudget_ = budget;
+	}
+
 	///-------------------------------------------/// 
 	/// パラメータ設定（型安全版）
 	///-------------------------------------------///
 	void ParticleManager::SetParameter(const std::string& name, ParticleParameter param, float value) {
+		SetParameter(FindDefinitionId(name), param, value);
+	}
+	void ParticleManager::SetParameter(ParticleDefinitionId id, ParticleParameter param, float value) {
+		DefinitionSlot* slot = GetSlot(id);
+		if (!slot) {
+			return;
+		}
+
 		// 定義を更新
-		auto defIt = definitions_.find(name);
-		if (defIt != definitions_.end()) {
+		if (slot->definition) {
+			ParticleDefinition& definition = *slot->definition;
 			// 定義内のパラメータを更新（次回発生時に反映）
 			switch (param) {
 				// 物理パラメータ
 			case ParticleParameter::Gravity:
-				defIt->second.physics.gravity = value;
+				definition.physics.gravity = value;
 				break;
 			case ParticleParameter::ExplosionRadiusX:
-				defIt->second.physics.explosionRange.x = value;
+				definition.physics.explosionRange.x = value;
 				break;
 			case ParticleParameter::ExplosionRadiusY:
-				defIt->second.physics.explosionRange.y = value;
+				definition.physics.explosionRange.y = value;
 				break;
 			case ParticleParameter::ExplosionRadiusZ:
-				defIt->second.physics.explosionRange.z = value;
+				definition.physics.explosionRange.z = value;
 				break;
 			case ParticleParameter::UpwardForce:
-				defIt->second.physics.upwardForce = value;
+				definition.physics.upwardForce = value;
 				break;
 			case ParticleParameter::AccelerationX:
-				defIt->second.physics.acceleration.x = value;
+				definition.physics.acceleration.x = value;
 				break;
 			case ParticleParameter::AccelerationY:
-				defIt->second.physics.acceleration.y = value;
+				definition.physics.acceleration.y = value;
 				break;
 			case ParticleParameter::AccelerationZ:
-				defIt->second.physics.acceleration.z = value;
+				definition.physics.acceleration.z = value;
 				break;
 
 				// 発生パラメータ
 			case ParticleParameter::EmissionRate:
-				defIt->second.emission.emissionRate = value;
+				definition.emission.emissionRate = value;
 				break;
 			case ParticleParameter::Frequency:
-				defIt->second.emission.frequency = value;
+				definition.emission.frequency = value;
 				break;
 			case ParticleParameter::LifetimeMin:
-				defIt->second.emission.lifetimeMin = value;
+				definition.emission.lifetimeMin = value;
 				break;
 			case ParticleParameter::LifetimeMax:
-				defIt->second.emission.lifetimeMax = value;
+				definition.emission.lifetimeMax = value;
 				break;
 			case ParticleParameter::BurstCount:
-				defIt->second.emission.burstCount = static_cast<uint32_t>(value);
+				definition.emission.burstCount = static_cast<uint32_t>(value);
 				break;
 
 				// 見た目パラメータ
 			case ParticleParameter::StartColorR:
-				defIt->second.appearance.startColor.x = value;
+				definition.appearance.startColor.x = value;
 				break;
 			case ParticleParameter::StartColorG:
-				defIt->second.appearance.startColor.y = value;
+				definition.appearance.startColor.y = value;
 				break;
 			case ParticleParameter::StartColorB:
-				defIt->second.appearance.startColor.z = value;
+				definition.appearance.startColor.z = value;
 				break;
 			case ParticleParameter::StartColorA:
-				defIt->second.appearance.startColor.w = value;
+				definition.appearance.startColor.w = value;
 				break;
 			case ParticleParameter::EndColorR:
-				defIt->second.appearance.endColor.x = value;
+				definition.appearance.endColor.x = value;
 				break;
 			case ParticleParameter::EndColorG:
-				defIt->second.appearance.endColor.y = value;
+				definition.appearance.endColor.y = value;
 				break;
 			case ParticleParameter::EndColorB:
-				defIt->second.appearance.endColor.z = value;
+				definition.appearance.endColor.z = value;
 				break;
 			case ParticleParameter::EndColorA:
-				defIt->second.appearance.endColor.w = value;
+				definition.appearance.endColor.w = value;
 				break;
 
 				// 回転パラメータ
 			case ParticleParameter::RotationSpeedX:
-				defIt->second.rotation.rotationSpeedMin.x = value;
+				definition.rotation.rotationSpeedMin.x = value;
 				break;
 			case ParticleParameter::RotationSpeedY:
-				defIt->second.rotation.rotationSpeedMin.y = value;
+				definition.rotation.rotationSpeedMin.y = value;
 				break;
 			case ParticleParameter::RotationSpeedZ:
-				defIt->second.rotation.rotationSpeedMin.z = value;
+				definition.rotation.rotationSpeedMin.z = value;
 				break;
 
 				// 速度パラメータ
 			case ParticleParameter::VelocityMinX:
-				defIt->second.physics.velocityMin.x = value;
+				definition.physics.velocityMin.x = value;
 				break;
 			case ParticleParameter::VelocityMinY:
-				defIt->second.physics.velocityMin.y = value;
+				definition.physics.velocityMin.y = value;
 				break;
 			case ParticleParameter::VelocityMinZ:
-				defIt->second.physics.velocityMin.z = value;
+				definition.physics.velocityMin.z = value;
 				break;
 			case ParticleParameter::VelocityMaxX:
-				defIt->second.physics.velocityMax.x = value;
+				definition.physics.velocityMax.x = value;
 				break;
 			case ParticleParameter::VelocityMaxY:
-				defIt->second.physics.velocityMax.y = value;
+				definition.physics.velocityMax.y = value;
 				break;
 			case ParticleParameter::VelocityMaxZ:
-				defIt->second.physics.velocityMax.z = value;
+				definition.physics.velocityMax.z = value;
 				break;
 			}
 		}
 
 		// アクティブなパーティクルにも適用
-		for (auto& particle : activeParticles_) {
-			if (particle->GetDefinition().name == name) {
-				particle->SetParameter(param, value);
-			}
+		for (ParticleGroup* particle : slot->activeGroups) {
+			particle->SetParameter(param, value);
 		}
 	}
+	void ParticleManager::SetParameter(ParticleHandle handle, ParticleParameter param, float value) {
+		if (ParticleGroup* particle = GetGroup(handle)) {
+			particle->SetParameter(param, value);
+		}
+	}
+
+	///-------------------------------------------/// 
+	/// 名前から定義の番号を取得
+	///-------------------------------------------///
+	ParticleDefinitionId ParticleManager::GetDefinitionId(const std::string& name) {
+		auto it = definitionIds_.find(name);
+		if (it != definitionIds_.end()) {
+			return it->second;
+		}
+
+		// 初めての名前には新しい番号を割り当てる
+		const ParticleDefinitionId id = static_cast<ParticleDefinitionId>(definitionSlots_.size());
+		definitionSlots_.emplace_back().name = name;
+		definitionIds_.emplace(name, id);
+		return id;
+	}
+	ParticleDefinitionId ParticleManager::FindDefinitionId(const std::string& name) const {
+		auto it = definitionIds_.find(name);
+		return (it != definitionIds_.end()) ? it->second : ParticleDefinitionId::kInvalid;
+	}
+
+	///-------------------------------------------/// 
+	/// 番号から定義ごとの情報を取得
+	///-------------------------------------------///
+	ParticleManager::DefinitionSlot* ParticleManager::GetSlot(ParticleDefinitionId id) {
+		const uint32_t index = static_cast<uint32_t>(id);
+		return (index < definitionSlots_.size()) ? &definitionSlots_[index] : nullptr;
+	}
+	const ParticleManager::DefinitionSlot* ParticleManager::GetSlot(ParticleDefinitionId id) const {
+		const uint32_t index = static_cast<uint32_t>(id);
+		return (index < definitionSlots_.size()) ? &definitionSlots_[index] : nullptr;
+	}
+
+	///-------------------------------------------/// 
+	/// ハンドルからグループを取得
+	///-------------------------------------------///
+	ParticleGroup* ParticleManager::GetGroup(ParticleHandle handle) const {
+		if (handle.index >= handleSlots_.size()) {
+			return nullptr;
+		}
+		const HandleSlot& slot = handleSlots_[handle.index];
+		return (slot.generation == handle.generation) ? slot.group : nullptr;
+	}
+	bool ParticleManager::IsAlive(ParticleHandle handle) const {
+		return GetGroup(handle) != nullptr;
+	}
 
 	///-------------------------------------------/// 
 	/// 情報取得
 	///-------------------------------------------///
 	const ParticleDefinition* ParticleManager::GetDefinition(const std::string& name) const {
-		auto it = definitions_.find(name);
-		if (it != definitions_.end()) {
-			return &it->second;
-		}
-		return nullptr;
+		const DefinitionSlot* slot = GetSlot(FindDefinitionId(name));
+		return slot ? slot->definition.get() : nullptr;
 	}
 
 	///-------------------------------------------/// 
 	/// パーティクル定義が登録されているか確認
 	///-------------------------------------------///
 	bool ParticleManager::HasDefinition(const std::string& name) const {
-		return definitions_.find(name) != definitions_.end();
+		return GetDefinition(name) != nullptr;
 	}
 
 	///-------------------------------------------/// 
 	/// アクティブなパーティクル数を取得
 	///-------------------------------------------///
 	uint32_t ParticleManager::GetActiveParticleCount(const std::string& name) const {
+		return GetActiveParticleCount(FindDefinitionId(name));
+	}
+	uint32_t ParticleManager::GetActiveParticleCount(ParticleDefinitionId id) const {
 		uint32_t totalCount = 0;
 
-		// vectorを線形探索して該当する名前のパーティクルをカウント
-		for (const auto& particle : activeParticles_) {
-			if (particle && particle->GetDefinition().name == name) {
+		// 定義ごとの一覧だけを数える
+		if (const DefinitionSlot* slot = GetSlot(id)) {
+			for (const ParticleGroup* particle : slot->activeGroups) {
 				totalCount += particle->GetActiveParticleCount();
 			}
 		}
@@ -314,12 +692,16 @@ namespace MiiEngine {
 	///-------------------------------------------///
 	std::vector<std::string> ParticleManager::GetDefinitionNames() const {
 		std::vector<std::string> names;
-		names.reserve(definitions_.size());
+		names.reserve(definitionSlots_.size());
 
-		for (const auto& [name, def] : definitions_) {
-			names.push_back(name);
+		for (const DefinitionSlot& slot : definitionSlots_) {
+			if (slot.definition) {
+				names.push_back(slot.name);
+			}
 		}
 
+		// 名前順で返す
+		std::sort(names.begin(), names.end());
 		return names;
 	}
 
@@ -327,15 +709,17 @@ namespace MiiEngine {
 	/// アクティブなパーティクルグループ数を取得
 	///-------------------------------------------///
 	size_t ParticleManager::GetActiveGroupCount(const std::string& name) const {
-		size_t count = 0;
-
-		// vectorを線形探索して該当する名前のグループをカウント
-		for (const auto& particle : activeParticles_) {
-			if (particle && particle->GetDefinition().name == name) {
-				++count;
-			}
-		}
-
-		return count;
+		return GetActiveGroupCount(FindDefinitionId(name));
 	}
+	size_t ParticleManager::GetActiveGroupCount(ParticleDefinitionId id) const {
+		const DefinitionSlot* slot = GetSlot(id);
+		return slot ? slot->activeGroups.size() : 0;
+	}
+
+	///-------------------------------------------/// 
+	/// 予算の統計を取得
+	///-------------------------------------------///
+	uint32_t ParticleManager::GetTotalParticleCount() const { return totalParticleCount_; }
+	uint32_t ParticleManager::GetSuppressedParticleCount() const { return suppressedParticleCount_; }
+	bool ParticleManager::IsOverBudget() const { return isOverBudget_; }
 }
\ No newline at end of file
@@ -3,11 +3,12 @@
 // ParticleGroup
 #include "Engine/Graphics/Particle/ParticleGroup.h"
 #include "Engine/Graphics/Particle/ParticleDefinition.h"
+#include "Engine/Graphics/Particle/ParticleHandle.h"
 #include "Engine/Graphics/Particle/ParticleParameter.h"
 // c++
-#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace MiiEngine {
@@ -16,7 +17,7 @@ namespace MiiEngine {
 	///=====================================================///
 	class ParticleManager {
 	public:
-		ParticleManager() = default;
+		ParticleManager();
 		~ParticleManager();
 
 		/// <summary>
@@ -38,11 +39,44 @@ namespace MiiEngine {
 		/// </summary>
 		/// <param name="name">発生させるパーティクルの名前</param>
 		/// <param name="translate">発生させる場所</param>
-		/// <returns>生成されたParticleGroupへのポインタ（nullptrの場合は失敗）</returns>
-		ParticleGroup* Emit(const std::string& name, const Vector3& translate);
+		/// <returns>発生させたグループのハンドル（失敗した場合は無効なハンドル）</returns>
+		ParticleHandle Emit(const std::string& name, const Vector3& translate);
 
 		/// <summary>
-		/// パーティクル全体の更新処理
+		/// シードを指定したパーティクルの発生処理（同じシードなら同じ発生を再現できる）
+		/// </summary>
+		/// <param name="name">発生させるパーティクルの名前</param>
+		/// <param name="translate">発生させる場所</param>
+		/// <param name="seed">グループの乱数のシード</param>
+		/// <returns>発生させたグループのハンドル（失敗した場合は無効なハンドル）</returns>
+		ParticleHandle Emit(const std::string& name, const Vector3& translate, uint64_t seed);
+
+		/// <summary>
+		/// 番号を指定したパーティクルの発生処理（文字列の検索を行わない）
+		/// </summary>
+		/// <param name="id">GetDefinitionId で取得した定義の番号</param>
+		/// <param name="translate">発生させる場所</param>
+		/// <returns>発生させたグループのハンドル（失敗した場合は無効なハンドル）</returns>
+		ParticleHandle Emit(ParticleDefinitionId id, const Vector3& translate);
+
+		/// <summary>
+		/// 番号とシードを指定したパーティクルの発生処理
+		/// </summary>
+		/// <param name="id">GetDefinitionId で取得した定義の番号</param>
+		/// <param name="translate">発生させる場所</param>
+		/// <param name="seed">グループの乱数のシード</param>
+		/// <returns>発生させたグループのハンドル（失敗した場合は無効なハンドル）</returns>
+		ParticleHandle Emit(ParticleDefinitionId id, const Vector3& translate, uint64_t seed);
+
+		/// <summary>
+		/// グループプールの事前確保（シーンの読み込み時に、よく発生させる定義のバッファを先に作っておく）
+		/// </summary>
+		/// <param name="name">パーティクルの名前</param>
+		/// <param name="count">プールに用意しておくグループ数</param>
+		void PrewarmGroups(const std::string& name, uint32_t count);
+
+		/// <summary>
+		/// パーティクル全体の更新処理（グループ単位でジョブシステムに分配し、終了したグループをまとめてプールへ戻す）
 		/// </summary>
 		void Update();
 
@@ -57,6 +91,13 @@ namespace MiiEngine {
 		/// </summary>
 		/// <param name="name">停止するパーティクルの名前</param>
 		void StopParticle(const std::string& name);
+		void StopParticle(ParticleDefinitionId id);
+
+		/// <summary>
+		/// ハンドルで指定したグループを停止（終了済みの場合は何もしない）
+		/// </summary>
+		/// <param name="handle">停止するグループのハンドル</param>
+		void Stop(ParticleHandle handle);
 
 		/// <summary>
 		/// パーティクル定義の削除
@@ -69,8 +110,25 @@ namespace MiiEngine {
 		/// </summary>
 		void RemoveAllParticles();
 
+		/// <summary>
+		/// ImGui情報の更新
+		/// </summary>
+		void Information();
+
 	public: /// ===設定=== ///
 
+		/// <summary>
+		/// シード未指定の Emit で使うシード列を設定（リプレイで全体の発生を再現する用）
+		/// </summary>
+		/// <param name="seed">シード列のシード</param>
+		void SetSeed(uint64_t seed);
+
+		/// <summary>
+		/// 全グループ合計の粒子数の予算を設定（超える場合は優先度の低いグループから発生数を絞る）
+		/// </summary>
+		/// <param name="budget">粒子数の上限（0 の場合は制限しない）</param>
+		void SetParticleBudget(uint32_t budget);
+
 		/// <summary>
 		/// パーティクルのテクスチャを設定
 		/// </summary>
@@ -85,9 +143,39 @@ namespace MiiEngine {
 		/// <param name="param">変更するパラメータ</param>
 		/// <param name="value">設定する値</param>
 		void SetParameter(const std::string& name, ParticleParameter param, float value);
+		void SetParameter(ParticleDefinitionId id, ParticleParameter param, float value);
+
+		/// <summary>
+		/// ハンドルで指定したグループだけパラメータを変更（定義は変更しない）
+		/// </summary>
+		/// <param name="handle">対象グループのハンドル</param>
+		/// <param name="param">変更するパラメータ</param>
+		/// <param name="value">設定する値</param>
+		void SetParameter(ParticleHandle handle, ParticleParameter param, float value);
 
 	public: /// ===情報取得=== ///
 
+		/// <summary>
+		/// 名前から定義の番号を取得（未登録の名前にも番号を割り当てるため、定義の読み込み前に取得してよい）
+		/// </summary>
+		/// <param name="name">パーティクルの名前</param>
+		/// <returns>定義の番号</returns>
+		ParticleDefinitionId GetDefinitionId(const std::string& name);
+
+		/// <summary>
+		/// ハンドルからグループを取得
+		/// </summary>
+		/// <param name="handle">グループのハンドル</param>
+		/// <returns>グループへのポインタ（終了済み、または無効なハンドルの場合はnullptr）</returns>
+		ParticleGroup* GetGroup(ParticleHandle handle) const;
+
+		/// <summary>
+		/// ハンドルのグループがまだ生存しているか
+		/// </summary>
+		/// <param name="handle">グループのハンドル</param>
+		/// <returns>生存している場合はtrue</returns>
+		bool IsAlive(ParticleHandle handle) const;
+
 		/// <summary>
 		/// パーティクル定義を取得
 		/// </summary>
@@ -108,6 +196,7 @@ namespace MiiEngine {
 		/// <param name="name">対象パーティクルの名前</param>
 		/// <returns>アクティブなパーティクルの総数</returns>
 		uint32_t GetActiveParticleCount(const std::string& name) const;
+		uint32_t GetActiveParticleCount(ParticleDefinitionId id) const;
 
 		/// <summary>
 		/// 登録されているパーティクル定義の一覧を取得
@@ -121,12 +210,130 @@ namespace MiiEngine {
 		/// <param name="name">対象パーティクルの名前</param>
 		/// <returns>アクティブなグループ数</returns>
 		size_t GetActiveGroupCount(const std::string& name) const;
+		size_t GetActiveGroupCount(ParticleDefinitionId id) const;
+
+		/// <summary>
+		/// 全グループ合計の生きている粒子数を取得（直前の Update 時点）
+		/// </summary>
+		uint32_t GetTotalParticleCount() const;
+
+		/// <summary>
+		/// 直前の Update で LOD と予算により発生を見送った粒子数を取得
+		/// </summary>
+		uint32_t GetSuppressedParticleCount() const;
+
+		/// <summary>
+		/// 直前の Update で予算を超えて発生数を絞っていたか
+		/// </summary>
+		bool IsOverBudget() const;
 
 	private:
-		// 定義ベース
-		std::map<std::string, ParticleDefinition> definitions_;
+		/// ===グループプール=== ///
+		// 定義ごとの使い終わったグループ（描画用バッファを保持したまま再利用する）
+		struct GroupPool {
+			std::vector<std::unique_ptr<ParticleGroup>> freeGroups;
+			uint32_t hitCount = 0;  // プールから取り出せた回数
+			uint32_t missCount = 0; // 新しく作った回数
+		};
+		// 1つの定義でプールに残しておく最大数（超えた分は破棄）
+		static constexpr uint32_t kMaxPooledGroups = 32;
+
+		/// ===定義=== ///
+		// 定義ごとの情報（ParticleDefinitionId が添字）
+		struct DefinitionSlot {
+			std::string name;
+			std::unique_ptr<ParticleDefinition> definition; // 未登録・削除済みの場合は nullptr
+			std::vector<ParticleGroup*> activeGroups;        // この定義のアクティブなグループ
+			GroupPool pool;
+		};
+		std::vector<DefinitionSlot> definitionSlots_;
+		// 名前から番号への変換（文字列の検索は GetDefinitionId と名前指定の関数だけで行う）
+		std::unordered_map<std::string, ParticleDefinitionId> definitionIds_;
+
+		/// ===ハンドル=== ///
+		// ハンドル表の要素（グループが終了したら世代を進めて空きに戻す）
+		struct HandleSlot {
+			ParticleGroup* group = nullptr;
+			uint32_t generation = 0;
+		};
+		std::vector<HandleSlot> handleSlots_;
+		std::vector<uint32_t> freeHandleSlots_;
+
+		// シード未指定の Emit で各グループに配るシード
+		ParticleRandom seedGenerator_;
 
 		// アクティブなパーティクル
 		std::vector<std::unique_ptr<ParticleGroup>> activeParticles_;
+		// アクティブなグループの定義の番号とハンドル（activeParticles_ と同じ並び）
+		struct ActiveEntry {
+			ParticleDefinitionId id;
+			uint32_t handleIndex;
+		};
+		std::vector<ActiveEntry> activeEntries_;
+
+	private: /// ===関数=== ///
+
+		/// <summary>
+		/// 登録済みの名前から番号を検索（未登録の場合は kInvalid、番号の割り当ては行わない）
+		/// </summary>
+		ParticleDefinitionId FindDefinitionId(const std::string& name) const;
+
+		/// <summary>
+		/// 番号から定義ごとの情報を取得（範囲外の場合は nullptr）
+		/// </summary>
+		DefinitionSlot* GetSlot(ParticleDefinitionId id);
+		const DefinitionSlot* GetSlot(ParticleDefinitionId id) const;
+
+		/// <summary>
+		/// グループにハンドルを割り当てる
+		/// </summary>
+		ParticleHandle AcquireHandle(ParticleGroup* particle);
+
+		/// <summary>
+		/// アクティブな一覧から外したグループの後始末（ハンドルの無効化と、定義ごとの一覧からの削除）
+		/// </summary>
+		/// <param name="entry">外したグループの番号とハンドル</param>
+		/// <param name="particle">外したグループ</param>
+		void DetachGroup(const ActiveEntry& entry, const ParticleGroup* particle);
+
+		/// <summary>
+		/// 終了したグループをプールへ戻す（定義が削除済み、またはプールが満杯の場合は破棄）
+		/// </summary>
+		/// <param name="id">グループの定義の番号</param>
+		/// <param name="particle">戻すグループ</param>
+		void RecycleGroup(ParticleDefinitionId id, std::unique_ptr<ParticleGroup> particle);
+
+		/// <summary>
+		/// 予算の配分（各グループの発生数の倍率を決める）
+		/// </summary>
+		void UpdateBudget();
+
+		/// ===予算=== ///
+		// 既定の予算（全グループ合計の粒子数）
+		static constexpr uint32_t kDefaultParticleBudget = 16384;
+		// 発生数の倍率から本来の粒子数を推定する時の、倍率の下限（小さい倍率で推定値が跳ねないように）
+		static constexpr float kMinEstimateScale = 0.1f;
+		// 粒子数の上限（0 の場合は制限しない）
+		uint32_t particleBudget_ = kDefaultParticleBudget;
+		// 絞らなかった場合の粒子数の推定値（グループの番号に対応）
+		std::vector<float> budgetDemands_;
+		// 予算を割り当てる順番（優先度の高い順）
+		std::vector<uint32_t> budgetOrder_;
+		// 直前の Update の統計
+		uint32_t totalParticleCount_ = 0;
+		uint32_t suppressedParticleCount_ = 0;
+		bool isOverBudget_ = false;
+
+		/// ===並列更新=== ///
+		// 1チャンクで処理するグループ数（グループごとの負荷の差はワークスティーリングでならす）
+		static constexpr uint32_t kUpdateGrainSize = 1;
+		// ジョブシステムで並列に更新するか
+		bool useParallelUpdate_ = true;
+		// 更新後に終了していたグループ（グループの番号に対応、各スレッドは自分の担当分だけ書き込む）
+		std::vector<uint8_t> finishedFlags_;
+		// 今フレームのスレッドごとの更新時間（ms、番号はジョブシステムのスレッド番号）
+		std::vector<double> threadUpdateTimes_;
+		// 今フレームの更新全体の時間（ms）
+		double updateTime_ = 0.0;
 	};
 }
\ No newline at end of file
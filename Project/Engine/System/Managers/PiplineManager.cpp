@@ -3,6 +3,13 @@
 #include <cassert>
 
 namespace MiiEngine {
+	namespace {
+		// 起動時には作らず、初めて使う時に作成するパイプライン（既定では使われないもの）
+		bool IsCreatedOnDemand(PipelineType type) {
+			return type == PipelineType::SkinningCompact3D;
+		}
+	}
+
 	///-------------------------------------------/// 
 	/// コンストラクタ、デストラクタ
 	///-------------------------------------------///
@@ -17,26 +24,15 @@ namespace MiiEngine {
 	/// 初期化
 	///-------------------------------------------///
 	void PipelineManager::Initialize(DXCommon* dxCommon) {
+		dxCommon_ = dxCommon;
+
 		/// ===GSPipeline=== ///
 		for (PipelineType type : AllPipelineTypes()) {
-			// Compilerの作成と初期化
-			auto compiler = std::make_unique<Compiler>();
-			compiler->Initialize(dxCommon, type);
-			compiler_[type] = std::move(compiler);
-
-			// BlendMode毎にパイプラインを作成
-			for (BlendMode mode : AllBlendModes()) {
-
-				// ペアのキーをｓ作成
-				auto key = std::make_pair(type, mode);
-
-				// パイプラインの作成
-				auto gsPipeline = std::make_unique<GSPSOCommon>();
-				gsPipeline->Create(dxCommon, compiler_[type].get(), type, mode);
-
-				// パイプラインの追加
-				graphicsPipelines_[key] = std::move(gsPipeline);
+			// 使う時に作成するものはシェーダーのコンパイルを後回しにする
+			if (IsCreatedOnDemand(type)) {
+				continue;
 			}
+			CreateGSPipelines(type);
 		}
 
 		/// ===CSPipeline=== ///
@@ -69,8 +65,12 @@ namespace MiiEngine {
 	///-------------------------------------------///
 	void PipelineManager::SetPipeline(ID3D12GraphicsCommandList* commandList, PipelineType type, BlendMode mode, D3D12_PRIMITIVE_TOPOLOGY topology) {
 
-		// Graphicsパイプラインの取得
+		// Graphicsパイプラインの取得（初めて使うものはここで作成）
 		GSPSOCommon* GSPipeline = GetGSPipeline(type, mode);
+		if (GSPipeline == nullptr && IsCreatedOnDemand(type) && compiler_.find(type) == compiler_.end()) {
+			CreateGSPipelines(type);
+			GSPipeline = GetGSPipeline(type, mode);
+		}
 		assert(GSPipeline != nullptr);
 
 		// PSO を設定
@@ -93,6 +93,30 @@ namespace MiiEngine {
 		CSPipeline->SetPSO(commandList);
 	}
 
+	///-------------------------------------------/// 
+	/// Graphicsパイプラインの作成
+	///-------------------------------------------///
+	void PipelineManager::CreateGSPipelines(PipelineType type) {
+		// Compilerの作成と初期化
+		auto compiler = std::make_unique<Compiler>();
+		compiler->Initialize(dxCommon_, type);
+		compiler_[type] = std::move(compiler);
+
+		// BlendMode毎にパイプラインを作成
+		for (BlendMode mode : AllBlendModes()) {
+
+			// ペアのキーをｓ作成
+			auto key = std::make_pair(type, mode);
+
+			// パイプラインの作成
+			auto gsPipeline = std::make_unique<GSPSOCommon>();
+			gsPipeline->Create(dxCommon_, compiler_[type].get(), type, mode);
+
+			// パイプラインの追加
+			graphicsPipelines_[key] = std::move(gsPipeline);
+		}
+	}
+
 	///-------------------------------------------/// 
 	/// タイプとモードを取得
 	///-------------------------------------------///
@@ -72,6 +72,9 @@ namespace MiiEngine {
         void SetCSPipeline(ID3D12GraphicsCommandList* commandList, CSPipelineType type, const std::wstring& kernelName);
 
     private:/// ===変数=== ///
+        // 使う時にパイプラインを作成するためのDXCommon
+        DXCommon* dxCommon_ = nullptr;
+
         /// パイプラインの管理
         // Graphicsパイプライン
         std::unordered_map<std::pair<PipelineType, BlendMode>, std::unique_ptr<GSPSOCommon>> graphicsPipelines_;
@@ -85,6 +88,12 @@ namespace MiiEngine {
 		std::unordered_map<CSPipelineType, std::unique_ptr<CSCompiler>> csCompiler_;
 
     private:/// ===関数=== ///
+        /// <summary>
+        /// 指定された PipelineType のシェーダーをコンパイルし、BlendMode 毎のパイプラインを作成
+        /// </summary>
+        /// <param name="type">作成するパイプラインの種類を示す値。</param>
+        void CreateGSPipelines(PipelineType type);
+
         /// <summary>
         /// 指定された PipelineType と BlendMode に基づいてパイプライン状態オブジェクトを取得
         /// </summary>
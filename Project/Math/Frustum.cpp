@@ -0,0 +1,48 @@
+#include "Frustum.h"
+
+#include <cmath>
+
+///=====================================================///
+/// 視錐台の作成
+///=====================================================///
+Frustum Math::MakeFrustum(const Matrix4x4& viewProjection) {
+	const auto& m = viewProjection.m;
+
+	// クリップ座標は clip = (x, y, z, 1) * m なので、各成分は m の列との内積になる
+	auto column = [&m](int j) { return Vector4{ m[0][j], m[1][j], m[2][j], m[3][j] }; };
+	const Vector4 x = column(0);
+	const Vector4 y = column(1);
+	const Vector4 z = column(2);
+	const Vector4 w = column(3);
+
+	Frustum frustum;
+	frustum.planes[0] = { w.x + x.x, w.y + x.y, w.z + x.z, w.w + x.w }; // 左  (-w <= x)
+	frustum.planes[1] = { w.x - x.x, w.y - x.y, w.z - x.z, w.w - x.w }; // 右  (x <= w)
+	frustum.planes[2] = { w.x + y.x, w.y + y.y, w.z + y.z, w.w + y.w }; // 下  (-w <= y)
+	frustum.planes[3] = { w.x - y.x, w.y - y.y, w.z - y.z, w.w - y.w }; // 上  (y <= w)
+	frustum.planes[4] = { z.x, z.y, z.z, z.w };                         // 手前 (0 <= z)
+	frustum.planes[5] = { w.x - z.x, w.y - z.y, w.z - z.z, w.w - z.w }; // 奥  (z <= w)
+
+	// 距離を比較できるよう法線を正規化
+	for (Vector4& plane : frustum.planes) {
+		const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+		if (length > 0.0f) {
+			const float inverse = 1.0f / length;
+			plane = { plane.x * inverse, plane.y * inverse, plane.z * inverse, plane.w * inverse };
+		}
+	}
+	return frustum;
+}
+
+///=====================================================///
+/// 球と視錐台の判定
+///=====================================================///
+bool Math::IsSphereInFrustum(const Frustum& frustum, const Vector3& center, float radius) {
+	for (const Vector4& plane : frustum.planes) {
+		// どれか1枚の平面の完全に外側なら見えない
+		if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) {
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Matrix4x4.h"
+
+/// <summary>
+/// 視錐台（6枚の平面。xyz が内向きの法線、w が距離で、dot(xyz, p) + w >= 0 が内側）
+/// </summary>
+struct Frustum final {
+	Vector4 planes[6];
+};
+
+namespace Math {
+	/// ===ビュープロジェクション行列から視錐台を作成（行ベクトル、クリップ空間の z は 0～1）=== ///
+	Frustum MakeFrustum(const Matrix4x4& viewProjection);
+	/// ===球が視錐台と重なっているか=== ///
+	bool IsSphereInFrustum(const Frustum& frustum, const Vector3& center, float radius);
+}
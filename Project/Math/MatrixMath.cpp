@@ -357,6 +357,51 @@ Matrix4x4 Math::Inverse4x4(const Matrix4x4& matrix) {
 	return result;
 }
 
+///=====================================================///
+/// アフィン行列の逆転置行列
+///=====================================================///
+// 左上3x3の余因子だけで計算する（最後の列が (0, 0, 0, 1) のアフィン行列のみ。結果は TransposeMatrix(Inverse4x4(matrix)) と同じ）
+Matrix4x4 Math::InverseTransposeAffine(const Matrix4x4& matrix) {
+	// 余因子を計算
+	float c00 = matrix.m[1][1] * matrix.m[2][2] - matrix.m[1][2] * matrix.m[2][1];
+	float c01 = matrix.m[1][2] * matrix.m[2][0] - matrix.m[1][0] * matrix.m[2][2];
+	float c02 = matrix.m[1][0] * matrix.m[2][1] - matrix.m[1][1] * matrix.m[2][0];
+
+	// 行列式を計算
+	float det = matrix.m[0][0] * c00 + matrix.m[0][1] * c01 + matrix.m[0][2] * c02;
+
+	// 行列式がゼロならば逆行列は存在しない
+	if (det == 0.0f) {
+		return MakeIdentity4x4(); // 単位行列を返す（Inverse4x4 と同じ）
+	}
+
+	float invDet = 1.0f / det;
+
+	// 逆行列の転置は余因子行列 / 行列式
+	float r00 = invDet * c00;
+	float r01 = invDet * c01;
+	float r02 = invDet * c02;
+
+	float r10 = invDet * (matrix.m[0][2] * matrix.m[2][1] - matrix.m[0][1] * matrix.m[2][2]);
+	float r11 = invDet * (matrix.m[0][0] * matrix.m[2][2] - matrix.m[0][2] * matrix.m[2][0]);
+	float r12 = invDet * (matrix.m[0][1] * matrix.m[2][0] - matrix.m[0][0] * matrix.m[2][1]);
+
+	float r20 = invDet * (matrix.m[0][1] * matrix.m[1][2] - matrix.m[0][2] * matrix.m[1][1]);
+	float r21 = invDet * (matrix.m[0][2] * matrix.m[1][0] - matrix.m[0][0] * matrix.m[1][2]);
+	float r22 = invDet * (matrix.m[0][0] * matrix.m[1][1] - matrix.m[0][1] * matrix.m[1][0]);
+
+	// 平行移動は逆行列では -t * A^-1 になり、転置で4列目に移る
+	float tx = matrix.m[3][0], ty = matrix.m[3][1], tz = matrix.m[3][2];
+
+	// 4行目は常に (0, 0, 0, 1)
+	return Matrix4x4{ {
+		{ r00, r01, r02, -(tx * r00 + ty * r01 + tz * r02) },
+		{ r10, r11, r12, -(tx * r10 + ty * r11 + tz * r12) },
+		{ r20, r21, r22, -(tx * r20 + ty * r21 + tz * r22) },
+		{ 0.0f, 0.0f, 0.0f, 1.0f },
+	} };
+}
+
 ///=====================================================///
 /// 座標変換
 ///=====================================================///
@@ -37,6 +37,8 @@ namespace Math {
 	/// ===逆行列=== ///
 	Matrix3x3 Inverse3x3(const Matrix3x3& matrix);
 	Matrix4x4 Inverse4x4(const Matrix4x4& matrix);
+	/// ===アフィン行列の逆転置行列（法線用。左上3x3のみで計算）=== ///
+	Matrix4x4 InverseTransposeAffine(const Matrix4x4& matrix);
 
 
 	/// ===座標変換=== ///
@@ -0,0 +1,128 @@
+#pragma once
+/// ===Include=== ///
+// SIMD
+#include <immintrin.h>
+// CPUID
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif // _MSC_VER
+// c++
+#include <cmath>
+#include <cstdint>
+
+///=====================================================///
+/// SimdFloat
+/// 判定関数を スカラー / SSE(4レーン) / AVX2(8レーン) で共通に書くための薄いラッパー
+/// Mask は比較結果で、レーンごとの真偽を表す（論理演算は V::And / V::Or / V::Not）
+/// Load / Store はアラインメントを要求しない
+///=====================================================///
+namespace MiiEngine::Simd {
+
+	///-------------------------------------------///
+	/// スカラー（1レーン）
+	///-------------------------------------------///
+	struct Float1 {
+		static constexpr int kWidth = 1;
+		using Mask = bool;
+		float v;
+
+		static Float1 Set1(float f) { return { f }; }
+		static Float1 Load(const float* p) { return { *p }; }
+		void Store(float* p) const { *p = v; }
+		static uint32_t MoveMask(Mask m) { return m ? 1u : 0u; }
+
+		friend Float1 operator+(Float1 a, Float1 b) { return { a.v + b.v }; }
+		friend Float1 operator-(Float1 a, Float1 b) { return { a.v - b.v }; }
+		friend Float1 operator*(Float1 a, Float1 b) { return { a.v * b.v }; }
+		friend Float1 operator/(Float1 a, Float1 b) { return { a.v / b.v }; }
+		friend Float1 Min(Float1 a, Float1 b) { return { a.v < b.v ? a.v : b.v }; }
+		friend Float1 Max(Float1 a, Float1 b) { return { a.v > b.v ? a.v : b.v }; }
+		friend Float1 Abs(Float1 a) { return { std::fabs(a.v) }; }
+		friend Mask CmpLE(Float1 a, Float1 b) { return a.v <= b.v; }
+		friend Mask CmpGT(Float1 a, Float1 b) { return a.v > b.v; }
+		static Mask And(Mask a, Mask b) { return a && b; }
+		static Mask Or(Mask a, Mask b) { return a || b; }
+		static Mask Not(Mask a) { return !a; }
+	};
+
+	///-------------------------------------------///
+	/// SSE（4レーン）
+	///-------------------------------------------///
+	struct Float4 {
+		static constexpr int kWidth = 4;
+		struct Mask { __m128 v; };
+		__m128 v;
+
+		static Float4 Set1(float f) { return { _mm_set1_ps(f) }; }
+		static Float4 Load(const float* p) { return { _mm_loadu_ps(p) }; }
+		void Store(float* p) const { _mm_storeu_ps(p, v); }
+		static uint32_t MoveMask(Mask m) { return static_cast<uint32_t>(_mm_movemask_ps(m.v)); }
+
+		friend Float4 operator+(Float4 a, Float4 b) { return { _mm_add_ps(a.v, b.v) }; }
+		friend Float4 operator-(Float4 a, Float4 b) { return { _mm_sub_ps(a.v, b.v) }; }
+		friend Float4 operator*(Float4 a, Float4 b) { return { _mm_mul_ps(a.v, b.v) }; }
+		friend Float4 operator/(Float4 a, Float4 b) { return { _mm_div_ps(a.v, b.v) }; }
+		friend Float4 Min(Float4 a, Float4 b) { return { _mm_min_ps(a.v, b.v) }; }
+		friend Float4 Max(Float4 a, Float4 b) { return { _mm_max_ps(a.v, b.v) }; }
+		friend Float4 Abs(Float4 a) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v) }; }
+		friend Mask CmpLE(Float4 a, Float4 b) { return { _mm_cmple_ps(a.v, b.v) }; }
+		friend Mask CmpGT(Float4 a, Float4 b) { return { _mm_cmpgt_ps(a.v, b.v) }; }
+		static Mask And(Mask a, Mask b) { return { _mm_and_ps(a.v, b.v) }; }
+		static Mask Or(Mask a, Mask b) { return { _mm_or_ps(a.v, b.v) }; }
+		static Mask Not(Mask a) { return { _mm_xor_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(-1))) }; }
+	};
+
+	///-------------------------------------------///
+	/// AVX2（8レーン）
+	/// 呼び出し前に CPU が AVX2 に対応しているか確認すること
+	///-------------------------------------------///
+	struct Float8 {
+		static constexpr int kWidth = 8;
+		struct Mask { __m256 v; };
+		__m256 v;
+
+		static Float8 Set1(float f) { return { _mm256_set1_ps(f) }; }
+		static Float8 Load(const float* p) { return { _mm256_loadu_ps(p) }; }
+		void Store(float* p) const { _mm256_storeu_ps(p, v); }
+		static uint32_t MoveMask(Mask m) { return static_cast<uint32_t>(_mm256_movemask_ps(m.v)); }
+
+		friend Float8 operator+(Float8 a, Float8 b) { return { _mm256_add_ps(a.v, b.v) }; }
+		friend Float8 operator-(Float8 a, Float8 b) { return { _mm256_sub_ps(a.v, b.v) }; }
+		friend Float8 operator*(Float8 a, Float8 b) { return { _mm256_mul_ps(a.v, b.v) }; }
+		friend Float8 operator/(Float8 a, Float8 b) { return { _mm256_div_ps(a.v, b.v) }; }
+		friend Float8 Min(Float8 a, Float8 b) { return { _mm256_min_ps(a.v, b.v) }; }
+		friend Float8 Max(Float8 a, Float8 b) { return { _mm256_max_ps(a.v, b.v) }; }
+		friend Float8 Abs(Float8 a) { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v) }; }
+		friend Mask CmpLE(Float8 a, Float8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+		friend Mask CmpGT(Float8 a, Float8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+		static Mask And(Mask a, Mask b) { return { _mm256_and_ps(a.v, b.v) }; }
+		static Mask Or(Mask a, Mask b) { return { _mm256_or_ps(a.v, b.v) }; }
+		static Mask Not(Mask a) { return { _mm256_xor_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(-1))) }; }
+	};
+
+	///-------------------------------------------///
+	/// AVX2に対応しているか（OSのYMM保存も含めて確認）
+	///-------------------------------------------///
+	inline bool DetectAVX2() {
+	#ifdef _MSC_VER
+		int info[4] = {};
+		__cpuid(info, 0);
+		if (info[0] < 7) {
+			return false;
+		}
+		__cpuid(info, 1);
+		const bool hasOSXSAVE = (info[2] & (1 << 27)) != 0;
+		const bool hasAVX = (info[2] & (1 << 28)) != 0;
+		if (!hasOSXSAVE || !hasAVX) {
+			return false;
+		}
+		if ((_xgetbv(0) & 0x6) != 0x6) {
+			return false;
+		}
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+	#else
+		return __builtin_cpu_supports("avx2");
+	#endif // _MSC_VER
+	}
+}
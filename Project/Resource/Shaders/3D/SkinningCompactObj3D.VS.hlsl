@@ -0,0 +1,89 @@
+#include "SkinningObj3D.hlsli"
+
+struct TransformationMatrix
+{
+    float4x4 WVP;
+    float4x4 World;
+    float4x4 WorldInverseTranspose;
+};
+
+// skeletonSpaceMatrixを転置した上3行（4列目は常に(0, 0, 0, 1)なので送らない）
+struct WellCompact
+{
+    float4 row0;
+    float4 row1;
+    float4 row2;
+};
+
+ConstantBuffer<TransformationMatrix> gTransformationMatrix : register(b0);
+StructuredBuffer<WellCompact> gMatrixPalette : register(t0);
+
+struct VertexShaderInput
+{
+    float4 position : POSITION0; // float4
+    float2 texcoord : TEXCOORD0; // float2
+    float3 normal : NORMAL0; // float3
+    float4 weight : WEIGHT0; // float4
+    int4 index : INDEX0; // int4
+};
+
+struct Skinned
+{
+    float4 position;
+    float3 normal;
+};
+
+// 位置の変換
+float3 TransformPosition(float4 position, WellCompact well)
+{
+    return float3(dot(position, well.row0), dot(position, well.row1), dot(position, well.row2));
+}
+
+// 法線の変換（左上3x3の余因子行列 / 行列式 = 逆行列の転置）
+float3 TransformNormal(float3 normal, WellCompact well)
+{
+    float3x3 m = transpose(float3x3(well.row0.xyz, well.row1.xyz, well.row2.xyz));
+    float3 cofactor0 = cross(m[1], m[2]);
+    float3 cofactor1 = cross(m[2], m[0]);
+    float3 cofactor2 = cross(m[0], m[1]);
+    float det = dot(m[0], cofactor0);
+    // 行列式が0（スケール0のJoint）の場合は、CPU側の InverseTransposeAffine と同じく単位行列として扱う
+    if (det == 0.0f)
+    {
+        return normal;
+    }
+    return (normal.x * cofactor0 + normal.y * cofactor1 + normal.z * cofactor2) / det;
+}
+
+Skinned Skinning(VertexShaderInput input)
+{
+    Skinned skinned;
+    /*Skinningの計算*/
+    // 位置の変換
+    skinned.position.xyz = TransformPosition(input.position, gMatrixPalette[input.index.x]) * input.weight.x;
+    skinned.position.xyz += TransformPosition(input.position, gMatrixPalette[input.index.y]) * input.weight.y;
+    skinned.position.xyz += TransformPosition(input.position, gMatrixPalette[input.index.z]) * input.weight.z;
+    skinned.position.xyz += TransformPosition(input.position, gMatrixPalette[input.index.w]) * input.weight.w;
+    skinned.position.w = 1.0f; // 確実に1を入れる
+    
+    // 法線の変換
+    skinned.normal = TransformNormal(input.normal, gMatrixPalette[input.index.x]) * input.weight.x;
+    skinned.normal += TransformNormal(input.normal, gMatrixPalette[input.index.y]) * input.weight.y;
+    skinned.normal += TransformNormal(input.normal, gMatrixPalette[input.index.z]) * input.weight.z;
+    skinned.normal += TransformNormal(input.normal, gMatrixPalette[input.index.w]) * input.weight.w;
+    skinned.normal = normalize(skinned.normal); // 正規化して戻してあげる
+    return skinned;
+}
+
+VertexShaderOutput main(VertexShaderInput input)
+{ // 入力頂点は当然SkeletonSpace
+    VertexShaderOutput output;
+    Skinned skinned = Skinning(input); // まずSkinning計算を行って、Skinning後の頂点情報を手に入れる。ここでの頂点もSkeletonSpace
+    // Skinning結果を使って変換
+    output.position = mul(skinned.position, gTransformationMatrix.WVP);
+    output.worldPosition = mul(skinned.position, gTransformationMatrix.World).xyz;
+    output.texcoord = input.texcoord;
+    output.normal = normalize(mul(skinned.normal, (float3x3) gTransformationMatrix.WorldInverseTranspose));
+    
+    return output;
+}
\ No newline at end of file
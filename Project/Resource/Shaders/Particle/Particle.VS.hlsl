@@ -2,12 +2,19 @@
 
 struct ParticleForGPU
 {
-    float4x4 WVP;
-    float4x4 World;
+    float4 translate; // xyz
+    float4 rotate; // xyz (euler)
+    float4 scale; // xyz
     float4 color;
 };
 
+struct Camera
+{
+    float4x4 viewProjection;
+};
+
 StructuredBuffer<ParticleForGPU> gParticle : register(t0);
+ConstantBuffer<Camera> gCamera : register(b0);
 
 struct VertexShaderInput
 {
@@ -16,11 +23,26 @@ struct VertexShaderInput
     float3 normal : NORMAL0; // float3
 };
 
+// X -> Y -> Z の順の回転行列（CPU側の MakeAffineEulerMatrix と同じ並び）
+float3x3 MakeRotateEuler(float3 rotate)
+{
+    float3 s = sin(rotate);
+    float3 c = cos(rotate);
+    float3x3 rotateX = float3x3(1.0f, 0.0f, 0.0f, 0.0f, c.x, s.x, 0.0f, -s.x, c.x);
+    float3x3 rotateY = float3x3(c.y, 0.0f, -s.y, 0.0f, 1.0f, 0.0f, s.y, 0.0f, c.y);
+    float3x3 rotateZ = float3x3(c.z, s.z, 0.0f, -s.z, c.z, 0.0f, 0.0f, 0.0f, 1.0f);
+    return mul(rotateX, mul(rotateY, rotateZ));
+}
+
 VertexShaderOutput main(VertexShaderInput input, uint instanceId : SV_InstanceID) //
 {
     VertexShaderOutput output;
-    output.position = mul(input.position, gParticle[instanceId].WVP);
+    ParticleForGPU particle = gParticle[instanceId];
+
+    // スケール -> 回転 -> 平行移動
+    float3 world = mul(input.position.xyz * particle.scale.xyz, MakeRotateEuler(particle.rotate.xyz)) + particle.translate.xyz;
+    output.position = mul(float4(world, 1.0f), gCamera.viewProjection);
     output.texcoord = input.texcoord;
-    output.color = gParticle[instanceId].color;
+    output.color = particle.color;
     return output;
-}
\ No newline at end of file
+}
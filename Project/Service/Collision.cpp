@@ -11,6 +11,68 @@ namespace Service {
 	///-------------------------------------------///
 	void Collision::AddCollider(Collider* collider) { Locator::GetColliderManager()->AddCollider(collider); }
 
+	///-------------------------------------------/// 
+	/// ハンドルの確認
+	///-------------------------------------------///
+	bool Collision::IsColliderAlive(ColliderHandle handle) { return Locator::GetColliderManager()->IsColliderAlive(handle); }
+	Collider* Collision::GetCollider(ColliderHandle handle) { return Locator::GetColliderManager()->GetCollider(handle); }
+
+	///-------------------------------------------/// 
+	/// 静的コライダーの構築
+	///-------------------------------------------///
+	void Collision::BuildStaticColliders() { Locator::GetColliderManager()->BuildStaticColliders(); }
+
+	///-------------------------------------------/// 
+	/// レイヤーマトリクスの読み込み
+	///-------------------------------------------///
+	void Collision::LoadLayerMatrix(const std::string& jsonPath) {
+		// ベースのディレクトリパス
+		const std::string& baseDirectoryPath = "./Resource/Json/Collision";
+		Locator::GetColliderManager()->LoadLayerMatrix(baseDirectoryPath + "/" + jsonPath);
+	}
+
+	///-------------------------------------------/// 
+	/// 押し戻しを行うペアの追加
+	///-------------------------------------------///
+	void Collision::AddSolverContact(Collider* colliderA, Collider* colliderB) { Locator::GetColliderManager()->AddSolverContact(colliderA, colliderB); }
+
+	///-------------------------------------------/// 
+	/// ImGui
+	///-------------------------------------------///
+	void Collision::Information() { Locator::GetColliderManager()->Information(); }
+
+	///-------------------------------------------/// 
+	/// シーンクエリ
+	///-------------------------------------------///
+	// レイキャスト
+	bool Collision::Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, RaycastHit& outHit, LayerMask layerMask) {
+		return Locator::GetColliderManager()->Raycast(origin, direction, maxDistance, outHit, layerMask);
+	}
+	void Collision::RaycastAll(const Vector3& origin, const Vector3& direction, float maxDistance, std::vector<RaycastHit>& outHits, LayerMask layerMask) {
+		Locator::GetColliderManager()->RaycastAll(origin, direction, maxDistance, outHits, layerMask);
+	}
+	// スフィアキャスト
+	bool Collision::SphereCast(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, RaycastHit& outHit, LayerMask layerMask) {
+		return Locator::GetColliderManager()->SphereCast(origin, radius, direction, maxDistance, outHit, layerMask);
+	}
+	void Collision::SphereCastAll(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, std::vector<RaycastHit>& outHits, LayerMask layerMask) {
+		Locator::GetColliderManager()->SphereCastAll(origin, radius, direction, maxDistance, outHits, layerMask);
+	}
+	// オーバーラップ
+	void Collision::OverlapSphere(const Sphere& sphere, std::vector<Collider*>& outColliders, LayerMask layerMask) {
+		Locator::GetColliderManager()->OverlapSphere(sphere, outColliders, layerMask);
+	}
+	void Collision::OverlapOBB(const OBB& obb, std::vector<Collider*>& outColliders, LayerMask layerMask) {
+		Locator::GetColliderManager()->OverlapOBB(obb, outColliders, layerMask);
+	}
+	// まとめて処理
+	void Collision::RaycastBatch(const std::vector<Ray>& rays, std::vector<RaycastHit>& outHits, LayerMask layerMask) {
+		Locator::GetColliderManager()->RaycastBatch(rays, outHits, layerMask);
+	}
+	void Collision::SphereCastBatch(const std::vector<Ray>& rays, float radius, std::vector<RaycastHit>& outHits, LayerMask layerMask) {
+		Locator::GetColliderManager()->SphereCastBatch(rays, radius, outHits, layerMask);
+	}
+
 	///-------------------------------------------/// 
 	/// 削除
 	///-------------------------------------------///
@@ -2,6 +2,11 @@
 /// ===Include=== ///
 // Data
 #include "Engine/DataInfo/LightData.h"
+// Query
+#include "Engine/Collider/Query/SceneQuery.h"
+// c++
+#include <string>
+#include <vector>
 
 /// ===前方宣言=== ///
 namespace MiiEngine {
@@ -32,6 +37,96 @@ namespace Service {
 		/// <param name="collider">追加するコライダーへのポインタ。</param>
 		static void AddCollider(MiiEngine::Collider* collider);
 
+		/// <summary>
+		/// ハンドルのコライダーがまだ登録されているかを確認します。Collider* を保持し続ける場合はハンドルも保持し、使う前に確認してください。
+		/// </summary>
+		/// <param name="handle">Collider::GetColliderHandle で取得したハンドル。</param>
+		/// <returns>削除済み・リセット済みの場合は false。</returns>
+		static bool IsColliderAlive(MiiEngine::ColliderHandle handle);
+
+		/// <summary>
+		/// ハンドルからコライダーを取得します。
+		/// </summary>
+		/// <param name="handle">Collider::GetColliderHandle で取得したハンドル。</param>
+		/// <returns>登録されていない場合は nullptr。</returns>
+		static MiiEngine::Collider* GetCollider(MiiEngine::ColliderHandle handle);
+
+		/// <summary>
+		/// 登録済みの静的コライダーから加速構造を構築します。レベル読み込みの最後に呼び出してください。
+		/// </summary>
+		static void BuildStaticColliders();
+
+		/// <summary>
+		/// レイヤーマトリクスをJSONから読み込みます。
+		/// </summary>
+		/// <param name="jsonPath">Resource/Json/Collision からの相対パス。</param>
+		static void LoadLayerMatrix(const std::string& jsonPath);
+
+		/// <summary>
+		/// 押し戻しを行うペアを追加します。同じフレームの要求はまとめて解消され、移動量は質量の逆数の比で配分されます。
+		/// </summary>
+		/// <param name="colliderA">1番目のコライダー。</param>
+		/// <param name="colliderB">2番目のコライダー。</param>
+		static void AddSolverContact(MiiEngine::Collider* colliderA, MiiEngine::Collider* colliderB);
+
+		/// <summary>
+		/// ImGui情報を更新します。
+		/// </summary>
+		static void Information();
+
+		/// <summary>
+		/// レイを飛ばして最も近い衝突を取得します。
+		/// </summary>
+		/// <param name="origin">始点。</param>
+		/// <param name="direction">方向（正規化は不要）。</param>
+		/// <param name="maxDistance">最大距離。</param>
+		/// <param name="outHit">最も近い衝突の出力先。</param>
+		/// <param name="layerMask">対象にするレイヤー。ToLayerMask を | で組み合わせて指定します。</param>
+		/// <returns>当たった場合は true。</returns>
+		static bool Raycast(const Vector3& origin, const Vector3& direction, float maxDistance, MiiEngine::RaycastHit& outHit, MiiEngine::LayerMask layerMask = MiiEngine::kLayerMaskAll);
+
+		/// <summary>
+		/// レイを飛ばして全ての衝突を近い順に取得します。
+		/// </summary>
+		static void RaycastAll(const Vector3& origin, const Vector3& direction, float maxDistance, std::vector<MiiEngine::RaycastHit>& outHits, MiiEngine::LayerMask layerMask = MiiEngine::kLayerMaskAll);
+
+		/// <summary>
+		/// 球を移動させて最初に接触する衝突を取得します。
+		/// </summary>
+		/// <param name="origin">球の中心の始点。</param>
+		/// <param name="radius">球の半径。</param>
+		/// <param name="direction">方向（正規化は不要）。</param>
+		/// <param name="maxDistance">最大距離。</param>
+		/// <param name="outHit">最も近い衝突の出力先。</param>
+		/// <param name="layerMask">対象にするレイヤー。</param>
+		/// <returns>接触した場合は true。</returns>
+		static bool SphereCast(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, MiiEngine::RaycastHit& outHit, MiiEngine::LayerMask layerMask = MiiEngine::kLayerMaskAll);
+
+		/// <summary>
+		/// 球を移動させて接触する全ての衝突を近い順に取得します。
+		/// </summary>
+		static void SphereCastAll(const Vector3& origin, float radius, const Vector3& direction, float maxDistance, std::vector<MiiEngine::RaycastHit>& outHits, MiiEngine::LayerMask layerMask = MiiEngine::kLayerMaskAll);
+
+		/// <summary>
+		/// 球と重なっているコライダーを取得します。
+		/// </summary>
+		static void OverlapSphere(const MiiEngine::Sphere& sphere, std::vector<MiiEngine::Collider*>& outColliders, MiiEngine::LayerMask layerMask = MiiEngine::kLayerMaskAll);
+
+		/// <summary>
+		/// OBBと重なっているコライダーを取得します。
+		/// </summary>
+		static void OverlapOBB(const MiiEngine::OBB& obb, std::vector<MiiEngine::Collider*>& outColliders, MiiEngine::LayerMask layerMask = MiiEngine::kLayerMaskAll);
+
+		/// <summary>
+		/// 複数のレイをまとめて飛ばします。結果はレイと同じ順に格納されます。
+		/// </summary>
+		static void RaycastBatch(const std::vector<MiiEngine::Ray>& rays, std::vector<MiiEngine::RaycastHit>& outHits, MiiEngine::LayerMask layerMask = MiiEngine::kLayerMaskAll);
+
+		/// <summary>
+		/// 複数のスフィアキャストをまとめて行います。結果は入力と同じ順に格納されます。
+		/// </summary>
+		static void SphereCastBatch(const std::vector<MiiEngine::Ray>& rays, float radius, std::vector<MiiEngine::RaycastHit>& outHits, MiiEngine::LayerMask layerMask = MiiEngine::kLayerMaskAll);
+
 		/// <summary>
 		/// ライトの種類を設定します。
 		/// </summary>
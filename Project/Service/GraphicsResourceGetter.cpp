@@ -60,13 +60,17 @@ namespace Service {
 		return Locator::GetTextureManager()->GetMetaData(key);
 	}
 	// モデルデータの取得
-	ModelData GraphicsResourceGetter::GetModelData(const std::string& directorPath) {
+	std::shared_ptr<const ModelData> GraphicsResourceGetter::GetModelData(const std::string& directorPath) {
 		return Locator::GetModelManager()->GetModelData(directorPath);
 	}
 	// アニメーションの取得
-	std::map<std::string, Animation> GraphicsResourceGetter::GetAnimationData(const std::string& directorPath) {
+	std::shared_ptr<const std::map<std::string, Animation>> GraphicsResourceGetter::GetAnimationData(const std::string& directorPath) {
 		return Locator::GetAnimationManager()->GetAnimation(directorPath);
 	}
+	// アニメーションクリップの取得
+	std::shared_ptr<const AnimationClip> GraphicsResourceGetter::GetAnimationClip(const std::string& directorPath, const std::string& animationName, const Skeleton& skeleton) {
+		return Locator::GetAnimationManager()->GetAnimationClip(directorPath, animationName, skeleton);
+	}
 	// LevelDataの取得
 	LevelData* GraphicsResourceGetter::GetLevelData(const std::string& file_name) {
 		return Locator::GetLevelManager()->GetLevelData(file_name);
@@ -2,6 +2,7 @@
 /// ===Include=== ///
 // C++
 #include <string>
+#include <memory>
 #include <d3d12.h>
 // DirectXTex
 #include "DirectXTex.h"
@@ -85,15 +86,24 @@ namespace Service {
 		/// ModelDataの取得
 		/// </summary>
 		/// <param name="directorPath">モデル データを読み込むディレクトリのパス。</param>
-		/// <returns>取得した ModelData オブジェクト。指定したディレクトリに基づくモデル情報を含みます。</returns>
-		static MiiEngine::ModelData GetModelData(const std::string& directorPath);
+		/// <returns>取得した ModelData への共有ポインタ。全てのインスタンスで同じデータを共有します（変更不可）。</returns>
+		static std::shared_ptr<const MiiEngine::ModelData> GetModelData(const std::string& directorPath);
 
 		/// <summary>
 		/// AnimationDataの取得
 		/// </summary>
 		/// <param name="directorPath">アニメーションデータが格納されているディレクトリまたはリソースへのパス。データの探索／読み込みに使用されます。</param>
-		/// <returns>キーが文字列、値が Animation の std::map。各エントリは識別子（例: アニメーション名）と対応する Animation オブジェクトを表します。</returns>
-		static std::map<std::string, MiiEngine::Animation> GetAnimationData(const std::string& directorPath);
+		/// <returns>キーが文字列、値が Animation の std::map への共有ポインタ。全てのインスタンスで同じデータを共有します（変更不可）。</returns>
+		static std::shared_ptr<const std::map<std::string, MiiEngine::Animation>> GetAnimationData(const std::string& directorPath);
+
+		/// <summary>
+		/// Skeletonに対応付けたアニメーションクリップの取得
+		/// </summary>
+		/// <param name="directorPath">アニメーションデータを読み込んだ時のキー。</param>
+		/// <param name="animationName">ファイル内のアニメーションの名前。</param>
+		/// <param name="skeleton">対応付けるSkeleton（同じファイルのモデルから作成したもの）。</param>
+		/// <returns>共有のクリップ。アニメーションが見つからない場合は nullptr。</returns>
+		static std::shared_ptr<const MiiEngine::AnimationClip> GetAnimationClip(const std::string& directorPath, const std::string& animationName, const MiiEngine::Skeleton& skeleton);
 
 		/// <summary>
 		/// LevelDataの取得
@@ -48,6 +48,8 @@ namespace Service {
 		assert(registry.spriteManager);
 		// DeltaTime
 		assert(registry.gameTime);
+		// JobSystem
+		assert(registry.jobSystem);
 
 		/// ===代入=== ///
 		// WinApp
@@ -90,6 +92,8 @@ namespace Service {
 		spriteManager_ = registry.spriteManager;
 		// DeltaTime
 		gameTime_ = registry.gameTime;
+		// JobSystem
+		jobSystem_ = registry.jobSystem;
 	}
 
 	///-------------------------------------------/// 
@@ -116,6 +120,7 @@ namespace Service {
 		rtvManager_ = nullptr;
 		srvManager_ = nullptr;
 		gameTime_ = nullptr;
+		jobSystem_ = nullptr;
 		winApp_ = nullptr;
 		dxCommon_ = nullptr;
 	}
@@ -221,4 +226,9 @@ namespace Service {
 	/// GameTime
 	///-------------------------------------------///
 	MiiEngine::GameTime* Locator::GetGameTime() { return gameTime_; }
+
+	///-------------------------------------------/// 
+	/// JobSystem
+	///-------------------------------------------///
+	MiiEngine::JobSystem* Locator::GetJobSystem() { return jobSystem_; }
 }
\ No newline at end of file
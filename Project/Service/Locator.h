@@ -39,6 +39,8 @@ namespace MiiEngine {
 	class SpriteManager;
 	// GameTime
 	class GameTime;
+	// JobSystem
+	class JobSystem;
 }
 
 namespace Service {
@@ -66,6 +68,7 @@ namespace Service {
 		MiiEngine::ColliderManager* colliderManager = nullptr;
 		MiiEngine::SpriteManager* spriteManager = nullptr;
 		MiiEngine::GameTime* gameTime = nullptr;
+		MiiEngine::JobSystem* jobSystem = nullptr;
 	};
 
 	///=====================================================/// 
@@ -120,6 +123,8 @@ namespace Service {
 		static MiiEngine::SpriteManager* GetSpriteManager();
 		// GameTime
 		static MiiEngine::GameTime* GetGameTime();
+		// JobSystem
+		static MiiEngine::JobSystem* GetJobSystem();
 
 	private:
 		// Core
@@ -149,5 +154,6 @@ namespace Service {
 		static inline MiiEngine::ColliderManager* colliderManager_ = nullptr;
 		static inline MiiEngine::SpriteManager* spriteManager_ = nullptr;
 		static inline MiiEngine::GameTime* gameTime_ = nullptr;
+		static inline MiiEngine::JobSystem* jobSystem_ = nullptr;
 	};
 }
\ No newline at end of file
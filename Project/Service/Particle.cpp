@@ -34,10 +34,35 @@ namespace Service {
 	/// パーティクルの操作
 	///-------------------------------------------///
 	// パーティクルを発生
-	ParticleGroup* Particle::Emit(const std::string& name, const Vector3& translate) {
+	ParticleHandle Particle::Emit(const std::string& name, const Vector3& translate) {
 		return Locator::GetParticleManager()->Emit(name, translate);
 	}
 
+	// シードを指定してパーティクルを発生
+	ParticleHandle Particle::Emit(const std::string& name, const Vector3& translate, uint64_t seed) {
+		return Locator::GetParticleManager()->Emit(name, translate, seed);
+	}
+
+	// 番号を指定してパーティクルを発生
+	ParticleHandle Particle::Emit(ParticleDefinitionId id, const Vector3& translate) {
+		return Locator::GetParticleManager()->Emit(id, translate);
+	}
+
+	// グループプールを事前確保
+	void Particle::PrewarmGroups(const std::string& name, uint32_t count) {
+		Locator::GetParticleManager()->PrewarmGroups(name, count);
+	}
+
+	// シード列を設定
+	void Particle::SetSeed(uint64_t seed) {
+		Locator::GetParticleManager()->SetSeed(seed);
+	}
+
+	// 粒子数の予算を設定
+	void Particle::SetParticleBudget(uint32_t budget) {
+		Locator::GetParticleManager()->SetParticleBudget(budget);
+	}
+
 	// テクスチャを設定
 	void Particle::SetTexture(const std::string& name, const std::string& textureName) {
 		Locator::GetParticleManager()->SetTexture(name, textureName);
@@ -47,17 +72,36 @@ namespace Service {
 	void Particle::SetParameter(const std::string& name, MiiEngine::ParticleParameter param, float value) {
 		Locator::GetParticleManager()->SetParameter(name, param, value);
 	}
+	void Particle::SetParameter(ParticleDefinitionId id, MiiEngine::ParticleParameter param, float value) {
+		Locator::GetParticleManager()->SetParameter(id, param, value);
+	}
+	void Particle::SetParameter(ParticleHandle handle, MiiEngine::ParticleParameter param, float value) {
+		Locator::GetParticleManager()->SetParameter(handle, param, value);
+	}
 
 	// パーティクルを停止
 	void Particle::StopParticle(const std::string& name) {
 		Locator::GetParticleManager()->StopParticle(name);
 	}
+	void Particle::StopParticle(ParticleDefinitionId id) {
+		Locator::GetParticleManager()->StopParticle(id);
+	}
+
+	// ハンドルのグループを停止
+	void Particle::Stop(ParticleHandle handle) {
+		Locator::GetParticleManager()->Stop(handle);
+	}
 
 	// 全パーティクルを削除
 	void Particle::RemoveAllParticles() {
 		Locator::GetParticleManager()->RemoveAllParticles();
 	}
 
+	// ImGui情報を更新
+	void Particle::Information() {
+		Locator::GetParticleManager()->Information();
+	}
+
 	///-------------------------------------------/// 
 	/// 情報取得
 	///-------------------------------------------///
@@ -76,6 +120,16 @@ namespace Service {
 		return Locator::GetParticleManager()->GetActiveParticleCount(name);
 	}
 
+	// 名前から定義の番号を取得
+	ParticleDefinitionId Particle::GetDefinitionId(const std::string& name) {
+		return Locator::GetParticleManager()->GetDefinitionId(name);
+	}
+
+	// ハンドルからグループを取得
+	ParticleGroup* Particle::GetGroup(ParticleHandle handle) {
+		return Locator::GetParticleManager()->GetGroup(handle);
+	}
+
 	// 定義名の一覧を取得
 	std::vector<std::string> Particle::GetDefinitionNames() {
 		return Locator::GetParticleManager()->GetDefinitionNames();
@@ -85,4 +139,14 @@ namespace Service {
 	size_t Particle::GetActiveGroupCount(const std::string& name) {
 		return Locator::GetParticleManager()->GetActiveGroupCount(name);
 	}
+
+	// 全体の粒子数を取得
+	uint32_t Particle::GetTotalParticleCount() {
+		return Locator::GetParticleManager()->GetTotalParticleCount();
+	}
+
+	// 発生を見送った粒子数を取得
+	uint32_t Particle::GetSuppressedParticleCount() {
+		return Locator::GetParticleManager()->GetSuppressedParticleCount();
+	}
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 /// ===include=== ///
 // ParticleGroup
 #include "Engine/Graphics/Particle/ParticleGroup.h"
+#include "Engine/Graphics/Particle/ParticleHandle.h"
 // c++
 #include <string>
 #include <vector>
@@ -42,14 +43,45 @@ namespace Service {
 		/// </summary>
 		/// <param name="name">発生させるパーティクルの名前</param>
 		/// <param name="translate">発生させる場所</param>
-		/// <returns>生成されたParticleGroupへのポインタ（nullptrの場合は失敗）</returns>
-		static MiiEngine::ParticleGroup* Emit(const std::string& name, const Vector3& translate);
+		/// <returns>発生させたグループのハンドル（失敗した場合は無効なハンドル）</returns>
+		static MiiEngine::ParticleHandle Emit(const std::string& name, const Vector3& translate);
+
+		/// <summary>
+		/// シードを指定したパーティクルの発生処理（同じシードなら同じ発生を再現できる）
+		/// </summary>
+		/// <param name="name">発生させるパーティクルの名前</param>
+		/// <param name="translate">発生させる場所</param>
+		/// <param name="seed">グループの乱数のシード</param>
+		/// <returns>発生させたグループのハンドル（失敗した場合は無効なハンドル）</returns>
+		static MiiEngine::ParticleHandle Emit(const std::string& name, const Vector3& translate, uint64_t seed);
+
+		/// <summary>
+		/// 番号を指定したパーティクルの発生処理（毎回発生させる箇所では、番号を1回だけ取得してこちらを使う）
+		/// </summary>
+		/// <param name="id">GetDefinitionId で取得した定義の番号</param>
+		/// <param name="translate">発生させる場所</param>
+		/// <returns>発生させたグループのハンドル（失敗した場合は無効なハンドル）</returns>
+		static MiiEngine::ParticleHandle Emit(MiiEngine::ParticleDefinitionId id, const Vector3& translate);
+
+		/// <summary>
+		/// グループプールの事前確保（シーンの読み込み時に、よく発生させる定義のバッファを先に作っておく）
+		/// </summary>
+		/// <param name="name">パーティクルの名前</param>
+		/// <param name="count">プールに用意しておくグループ数</param>
+		static void PrewarmGroups(const std::string& name, uint32_t count);
 
 		/// <summary>
 		/// 指定した名前のアクティブなパーティクルをすべて停止
 		/// </summary>
 		/// <param name="name">停止するパーティクルの名前</param>
 		static void StopParticle(const std::string& name);
+		static void StopParticle(MiiEngine::ParticleDefinitionId id);
+
+		/// <summary>
+		/// ハンドルで指定したグループを停止（終了済みの場合は何もしない）
+		/// </summary>
+		/// <param name="handle">停止するグループのハンドル</param>
+		static void Stop(MiiEngine::ParticleHandle handle);
 
 		/// <summary>
 		/// パーティクル定義の削除
@@ -62,7 +94,24 @@ namespace Service {
 		/// </summary>
 		static void RemoveAllParticles();
 
+		/// <summary>
+		/// ImGui情報を更新（グループ数とスレッドごとの更新時間）
+		/// </summary>
+		static void Information();
+
 	public: /// ===設定=== ///
+		/// <summary>
+		/// シード未指定の Emit で使うシード列を設定（リプレイで全体の発生を再現する用）
+		/// </summary>
+		/// <param name="seed">シード列のシード</param>
+		static void SetSeed(uint64_t seed);
+
+		/// <summary>
+		/// 全グループ合計の粒子数の予算を設定（超える場合は優先度の低いグループから発生数を絞る）
+		/// </summary>
+		/// <param name="budget">粒子数の上限（0 の場合は制限しない）</param>
+		static void SetParticleBudget(uint32_t budget);
+
 		/// <summary>
 		/// パーティクルのテクスチャを設定
 		/// </summary>
@@ -77,8 +126,31 @@ namespace Service {
 		/// <param name="param">変更するパラメータ</param>
 		/// <param name="value">設定する値</param>
 		static void SetParameter(const std::string& name, MiiEngine::ParticleParameter param, float value);
+		static void SetParameter(MiiEngine::ParticleDefinitionId id, MiiEngine::ParticleParameter param, float value);
+
+		/// <summary>
+		/// ハンドルで指定したグループだけパラメータを変更（定義は変更しない）
+		/// </summary>
+		/// <param name="handle">対象グループのハンドル</param>
+		/// <param name="param">変更するパラメータ</param>
+		/// <param name="value">設定する値</param>
+		static void SetParameter(MiiEngine::ParticleHandle handle, MiiEngine::ParticleParameter param, float value);
 
 	public: /// ===取得=== ///
+		/// <summary>
+		/// 名前から定義の番号を取得（定義の読み込み前に取得してよい）
+		/// </summary>
+		/// <param name="name">パーティクルの名前</param>
+		/// <returns>定義の番号</returns>
+		static MiiEngine::ParticleDefinitionId GetDefinitionId(const std::string& name);
+
+		/// <summary>
+		/// ハンドルからグループを取得
+		/// </summary>
+		/// <param name="handle">グループのハンドル</param>
+		/// <returns>グループへのポインタ（終了済み、または無効なハンドルの場合はnullptr）</returns>
+		static MiiEngine::ParticleGroup* GetGroup(MiiEngine::ParticleHandle handle);
+
 		/// <summary>
 		/// パーティクル定義を取得
 		/// </summary>
@@ -112,5 +184,15 @@ namespace Service {
 		/// <param name="name">対象パーティクルの名前</param>
 		/// <returns>アクティブなグループ数</returns>
 		static size_t GetActiveGroupCount(const std::string& name);
+
+		/// <summary>
+		/// 全グループ合計の生きている粒子数を取得
+		/// </summary>
+		static uint32_t GetTotalParticleCount();
+
+		/// <summary>
+		/// 直前の更新で LOD と予算により発生を見送った粒子数を取得
+		/// </summary>
+		static uint32_t GetSuppressedParticleCount();
 	};
 }
\ No newline at end of file
@@ -41,6 +41,9 @@ void BossEnemy::Initialize() {
 	/// ===BaseEnemyの初期化=== ///
 	BaseEnemy::Initialize();
 
+	// パーティクルの番号を取得
+	deathParticleId_ = Service::Particle::GetDefinitionId("nakagawa");
+
 	// Stateの設定
 	//ChangeState(std::make_unique<EnemyMoveState>());
 	
@@ -117,12 +120,10 @@ void BossEnemy::OnCollision(MiiEngine::Collider* collider) {
 void BossEnemy::advanceTimer() {
 	if (baseInfo_.isDead) {
 		// パーティクルの発生
-		deathParticle_ = Service::Particle::Emit("nakagawa", transform_.translate);
+		deathParticle_ = Service::Particle::Emit(deathParticleId_, transform_.translate);
 		isTentativeDeath_ = true;
-		if (hitParticle_ != nullptr) {
-			hitParticle_->Stop();
-			hitParticle_ = nullptr;
-		}
+		Service::Particle::Stop(hitParticle_);
+		hitParticle_ = {};
 	} else {
 		// 無敵タイマーを進める
 		if (invincibleInfo_.timer > 0.0f) {
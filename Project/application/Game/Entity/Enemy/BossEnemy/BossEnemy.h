@@ -7,6 +7,8 @@
 // Component
 #include "Component/Move/BossMoveComponent.h"
 #include "Component/Attack/BossAttackComponent.h"
+// Particle
+#include "Engine/Graphics/Particle/ParticleHandle.h"
 //C++
 #include <random>
 
@@ -82,9 +84,10 @@ private:
 	std::unique_ptr<BossMoveComponent> moveComponent_;		// 移動コンポーネント
 	std::unique_ptr<BossAttackComponent> attackComponent_;	// 攻撃コンポーネント
 
-	/// ===Particle=== ///
-	MiiEngine::ParticleGroup* hitParticle_ = nullptr;
-	MiiEngine::ParticleGroup* deathParticle_ = nullptr;
+	/// ===Particle（番号は初期化時に1回だけ取得）=== ///
+	MiiEngine::ParticleDefinitionId deathParticleId_ = MiiEngine::ParticleDefinitionId::kInvalid;
+	MiiEngine::ParticleHandle hitParticle_;
+	MiiEngine::ParticleHandle deathParticle_;
 
 private:
 
@@ -46,6 +46,12 @@ void MobEnemy::InitGameScene(const Vector3& translate) {
 void MobEnemy::Initialize() {
 	/// ===BaseEnemyの初期化=== ///
 	BaseEnemy::Initialize();
+
+	/// ===パーティクルの番号を取得=== ///
+	hitParticleId_ = Service::Particle::GetDefinitionId("Game");
+	deathParticleId_ = Service::Particle::GetDefinitionId("nakagawa");
+	prePareAttackParticleId_ = Service::Particle::GetDefinitionId("EnemyPrePareAttack");
+	prePareAttackChargeParticleId_ = Service::Particle::GetDefinitionId("EnemyPrePareAttackCharge");
 }
 
 ///-------------------------------------------/// 
@@ -129,7 +135,7 @@ void MobEnemy::OnCollision(Collider* collider) {
 
 				// HPを減少
 				baseInfo_.HP--;
-				hitParticle_ = Service::Particle::Emit("Game", transform_.translate);
+				hitParticle_ = Service::Particle::Emit(hitParticleId_, transform_.translate);
 
 				// 無敵時間のセット
 				SetInvincibleTime();
@@ -237,12 +243,10 @@ void MobEnemy::advanceTimer() {
 		// 消えるまでの時間を進める
 		disappearTimer_ -= baseInfo_.deltaTime;
 		if (disappearTimer_ <= 0) {
-			deathParticle_ = Service::Particle::Emit("nakagawa", transform_.translate);
+			deathParticle_ = Service::Particle::Emit(deathParticleId_, transform_.translate);
 			isTentativeDeath_ = true;
-			if (hitParticle_ != nullptr) {
-				hitParticle_->Stop();
-				hitParticle_ = nullptr;
-			}
+			Service::Particle::Stop(hitParticle_);
+			hitParticle_ = {};
 		}
 	} else {
 		// 攻撃用のタイマーを進める
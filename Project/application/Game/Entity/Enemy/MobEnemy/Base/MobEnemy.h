@@ -7,6 +7,8 @@
 // Component
 #include "application/Game/Entity/Enemy/MobEnemy/Component/EnemyMoveComponent.h"
 #include "application/Game/Entity/Enemy/MobEnemy/Component/EnemyHitReactionComponent.h"
+// Particle
+#include "Engine/Graphics/Particle/ParticleHandle.h"
 // C++
 #include <random>
 
@@ -103,6 +105,9 @@ public: /// ===Getter=== ///
 	AttackInfo GetAttackInfo()const { return attackInfo_; };
 	// tentativeDeath
 	bool GetTentativeDeath() const { return isTentativeDeath_; };
+	// Particle
+	MiiEngine::ParticleDefinitionId GetPrePareAttackParticleId() const { return prePareAttackParticleId_; };
+	MiiEngine::ParticleDefinitionId GetPrePareAttackChargeParticleId() const { return prePareAttackChargeParticleId_; };
 
 public: /// ===Setter=== ///
 	
@@ -126,9 +131,13 @@ private:
 	std::unique_ptr<EnemyMoveComponent> moveComponent_;
 	std::unique_ptr<EnemyHitReactionComponent> hitReactionComponent_;
 
-	/// ===Particle=== ///
-	MiiEngine::ParticleGroup* hitParticle_ = nullptr;
-	MiiEngine::ParticleGroup* deathParticle_ = nullptr;
+	/// ===Particle（番号は初期化時に1回だけ取得）=== ///
+	MiiEngine::ParticleDefinitionId hitParticleId_ = MiiEngine::ParticleDefinitionId::kInvalid;
+	MiiEngine::ParticleDefinitionId deathParticleId_ = MiiEngine::ParticleDefinitionId::kInvalid;
+	MiiEngine::ParticleDefinitionId prePareAttackParticleId_ = MiiEngine::ParticleDefinitionId::kInvalid;
+	MiiEngine::ParticleDefinitionId prePareAttackChargeParticleId_ = MiiEngine::ParticleDefinitionId::kInvalid;
+	MiiEngine::ParticleHandle hitParticle_;
+	MiiEngine::ParticleHandle deathParticle_;
 
 	// 消えるまでの時間
 	float disappearTimer_ = 2.0f;
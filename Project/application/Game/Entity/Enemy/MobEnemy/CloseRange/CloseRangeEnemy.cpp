@@ -53,6 +53,9 @@ void CloseRangeEnemy::Initialize() {
 
 	/// ===OBBのサイズを設定=== ///
 	SetHalfSize({ 3.0f, 3.0f, 3.0f });
+
+	/// ===パーティクルの番号を取得=== ///
+	attackParticleId_ = Service::Particle::GetDefinitionId("CloseEnemyAttack");
 }
 
 ///-------------------------------------------/// 
@@ -104,13 +107,12 @@ void CloseRangeEnemy::StartAttack() {
 	// 移動ベクトルを設定
 	baseInfo_.velocity = attackInfo_.direction * chargeInfo_.moveSpeed;
 	// パーティクル停止
-	if (attackParticle_) {
-		attackParticle_->Stop();
-		attackParticle_ = nullptr;
-	}
+	Service::Particle::Stop(attackParticle_);
 	// パーティクルの再生
-	attackParticle_ = Service::Particle::Emit("CloseEnemyAttack", transform_.translate);
-	attackParticle_->SetEmitterPosition(transform_.translate);
+	attackParticle_ = Service::Particle::Emit(attackParticleId_, transform_.translate);
+	if (MiiEngine::ParticleGroup* particle = Service::Particle::GetGroup(attackParticle_)) {
+		particle->SetEmitterPosition(transform_.translate);
+	}
 }
 
 ///-------------------------------------------/// 
@@ -123,8 +125,8 @@ void CloseRangeEnemy::Attack() {
 	float length = Length(toTarget);
 
 	// パーティクルの位置更新
-	if (attackParticle_) {
-		attackParticle_->SetEmitterPosition(transform_.translate);
+	if (MiiEngine::ParticleGroup* particle = Service::Particle::GetGroup(attackParticle_)) {
+		particle->SetEmitterPosition(transform_.translate);
 	}
 
 	// 攻撃終了判定
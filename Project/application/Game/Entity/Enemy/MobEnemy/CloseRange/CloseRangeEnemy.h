@@ -56,8 +56,9 @@ public: /// ===衝突判定=== ///
 
 private: /// ===変数=== ///
 
-	// ParticleGroup
-	MiiEngine::ParticleGroup* attackParticle_ = nullptr;
+	// Particle（番号は初期化時に1回だけ取得し、終了したグループは再利用されるため、ハンドルで保持する）
+	MiiEngine::ParticleDefinitionId attackParticleId_ = MiiEngine::ParticleDefinitionId::kInvalid;
+	MiiEngine::ParticleHandle attackParticle_;
 
 	/// ===突進情報=== ///
 	struct ChargeInfo {
@@ -24,10 +24,15 @@ void LongRangeEnemyBullet::Initialize() {
 	SphereCollider::Initialize();
 	name_ = MiiEngine::ColliderName::EnemyBullet;
 	SphereCollider::SetRadius(0.5f);
+	// 半径に対して移動量が大きいため連続判定を行う
+	SetIsContinuous(true);
 
 	// コライダーに追加
 	Service::Collision::AddCollider(this);
 
+	// パーティクルの番号を取得
+	bulletParticleId_ = Service::Particle::GetDefinitionId("LongEnemyAttack");
+
 	object3d_->Update();
 }
 
@@ -46,8 +51,8 @@ void LongRangeEnemyBullet::Update() {
 		transform_.translate += info_.velocity;
 		
 		// Particleの位置更新
-		if (bulletParticle_) {
-			bulletParticle_->SetEmitterPosition(transform_.translate);
+		if (MiiEngine::ParticleGroup* particle = Service::Particle::GetGroup(bulletParticle_)) {
+			particle->SetEmitterPosition(transform_.translate);
 		}
 
 		// コライダーの更新
@@ -81,20 +86,31 @@ void LongRangeEnemyBullet::Create(const Vector3& pos, const Vector3& vel) {
 	lifeTimer_ = lifeTime_;
 
 	// パーティクル停止
-	if (bulletParticle_) {
-		bulletParticle_->Stop();
-		bulletParticle_ = nullptr;
-	}
+	Service::Particle::Stop(bulletParticle_);
 	// パーティクルの再生
-	bulletParticle_ = Service::Particle::Emit("LongEnemyAttack", transform_.translate);
-	bulletParticle_->SetEmitterPosition(transform_.translate);
+	bulletParticle_ = Service::Particle::Emit(bulletParticleId_, transform_.translate);
+	if (MiiEngine::ParticleGroup* particle = Service::Particle::GetGroup(bulletParticle_)) {
+		particle->SetEmitterPosition(transform_.translate);
+	}
 }
 
 ///-------------------------------------------///  
 /// 衝突判定
 ///-------------------------------------------///
 void LongRangeEnemyBullet::OnCollision(Collider* collider) {
-	collider;
+	// 壁などのオブジェクトに当たったら消える
+	if (collider->GetColliderName() == MiiEngine::ColliderName::Object) {
+		// すり抜けていた場合は当たった位置まで戻す
+		if (GetTimeOfImpact() < 1.0f) {
+			transform_.translate = GetImpactPosition();
+			if (MiiEngine::ParticleGroup* particle = Service::Particle::GetGroup(bulletParticle_)) {
+				particle->SetEmitterPosition(transform_.translate);
+			}
+		}
+		isAlive_ = false;
+		// 同じフレームで壁の奥にいる相手に当たらないよう、判定から外す（当たった時刻順に通知されるので奥の相手はこの後）
+		Service::Collision::RemoveCollider(this);
+	}
 }
 
 ///-------------------------------------------/// 
@@ -1,11 +1,8 @@
 #pragma once
 /// ===Include=== ///
 #include "Engine/Collider/SphereCollider.h"
-
-/// ===前方宣言=== ///
-namespace MiiEngine {
-	class ParticleGroup;
-}
+// Particle
+#include "Engine/Graphics/Particle/ParticleHandle.h"
 
 ///=====================================================/// 
 /// 遠距離攻撃Enemyの弾
@@ -64,8 +61,9 @@ private: /// ===変数=== ///
 	};
 	BaseInfo info_;
 
-	// ParticleGroup
-	MiiEngine::ParticleGroup* bulletParticle_ = nullptr;
+	// Particle（番号は初期化時に1回だけ取得）
+	MiiEngine::ParticleDefinitionId bulletParticleId_ = MiiEngine::ParticleDefinitionId::kInvalid;
+	MiiEngine::ParticleHandle bulletParticle_;
 
 	// 速度
 	float speed_ = 1.5f;
@@ -27,8 +27,8 @@ void EnemyPrePareAttackState::Enter(MobEnemy* enemy) {
 	// フラグをリセット
 	enemy_->SetIsRotationComplete(false);
 	// パーティクルの再生
-	activeParticle_ = Service::Particle::Emit("EnemyPrePareAttack", enemy_->GetTransform().translate);
-	prePareAttackParticle_ = Service::Particle::Emit("EnemyPrePareAttackCharge", enemy_->GetTransform().translate);
+	activeParticle_ = Service::Particle::Emit(enemy_->GetPrePareAttackParticleId(), enemy_->GetTransform().translate);
+	prePareAttackParticle_ = Service::Particle::Emit(enemy_->GetPrePareAttackChargeParticleId(), enemy_->GetTransform().translate);
 }
 
 ///-------------------------------------------/// 
@@ -51,10 +51,10 @@ void EnemyPrePareAttackState::Update() {
 		/// ===Stateの変更=== ///
 		if (enemy_->GetIsRotationComplete()) {
 			// Particleの停止
-			activeParticle_->Stop();
-			activeParticle_ = nullptr;
-			prePareAttackParticle_->Stop();
-			prePareAttackParticle_ = nullptr;
+			Service::Particle::Stop(activeParticle_);
+			activeParticle_ = {};
+			Service::Particle::Stop(prePareAttackParticle_);
+			prePareAttackParticle_ = {};
 			// 回転完了フラグをリセット
 			enemy_->SetIsRotationComplete(false);
 			// 攻撃方向を設定
@@ -82,13 +82,8 @@ void EnemyPrePareAttackState::Update() {
 ///-------------------------------------------///
 void EnemyPrePareAttackState::Finalize() {
 	EnemyState::Finalize();
-	if (activeParticle_) {
-		activeParticle_->Stop();
-		activeParticle_ = nullptr;
-	}
-
-	if (prePareAttackParticle_) {
-		prePareAttackParticle_->Stop();
-		prePareAttackParticle_ = nullptr;
-	}
+	Service::Particle::Stop(activeParticle_);
+	activeParticle_ = {};
+	Service::Particle::Stop(prePareAttackParticle_);
+	prePareAttackParticle_ = {};
 }
@@ -2,11 +2,8 @@
 /// ===Include=== ///
 #include "Base/EnemyState.h"
 #include "Math/Vector3.h"
-
-/// ===前方宣言=== ///
-namespace MiiEngine {
-	class ParticleGroup;
-}
+// Particle
+#include "Engine/Graphics/Particle/ParticleHandle.h"
 
 ///-------------------------------------------/// 
 /// PrePareAttackState
@@ -33,8 +30,8 @@ public:
 	void Finalize() override;
 
 private:
-	MiiEngine::ParticleGroup* activeParticle_ = nullptr;
-	MiiEngine::ParticleGroup* prePareAttackParticle_ = nullptr;
+	MiiEngine::ParticleHandle activeParticle_;
+	MiiEngine::ParticleHandle prePareAttackParticle_;
 
 	/// ===タイマー=== ///
 	float activeTimer_ = 0.0f;	// アクティブタイマー
@@ -1,6 +1,7 @@
 #include "GameCharacter.h"
-// DeltaTime
+// Service
 #include "Service/DeltaTime.h"
+#include "Service/Collision.h"
 // Collider
 #include "Engine/Collider/AABBCollider.h"
 // C++
@@ -36,10 +37,6 @@ GameCharacter<TCollider>::~GameCharacter() {
 ///-------------------------------------------///
 template<typename TCollider> requires IsCollider<TCollider>
 void GameCharacter<TCollider>::Initialize() {
-	/// ===ColliderCollision=== ///
-	collision_ = std::make_unique<ColliderCollision>();
-	gCollision_ = std::make_unique<GameCharacterCollision>();
-
 	/// ===BaseInfoの初期化設定=== ///
 	baseInfo_.velocity = { 0.0f, 0.0f, 0.0f };
 	baseInfo_.deltaTime = Service::DeltaTime::GetDeltaTime();
@@ -108,6 +105,7 @@ void GameCharacter<TCollider>::Information() {
 	ImGui::DragFloat("デルタタイム", &baseInfo_.deltaTime, 0.01f, 0.0f, 1.0f);
 	ImGui::DragFloat3("速度", &baseInfo_.velocity.x, 0.1f);
 	ImGui::DragFloat("重力", &baseInfo_.gravity, 0.1f, -20.0f, 0.0f);
+	ImGui::DragFloat("質量", &this->mass_, 0.1f, 0.0f, 100.0f);
 	ImGui::Checkbox("死亡フラグ", &baseInfo_.isDead);
 	ImGui::Checkbox("接地フラグ", &groundInfo_.isGrounded);
 #endif // USE_IMGUI
@@ -132,14 +130,15 @@ void GameCharacter<TCollider>::OnCollision(Collider* collider) {
 
 	} else if (collider->GetColliderName() == ColliderName::Object) {
 		// Objectとの衝突処理
-		//NOTE:thisを100%押し戻し
-		collision_->ProcessCollision(this, collider, 0.0f);
+		//NOTE:Objectは静的コライダーなのでthisだけが押し戻される
+		Service::Collision::AddSolverContact(this, collider);
 
-	} else if (auto otherCharacter = dynamic_cast<GameCharacter<TCollider>*>(collider)) { //　これだと当たり判定が通った時に全て通ってしまう。
+	} else if (dynamic_cast<GameCharacter<TCollider>*>(collider)) {
 
 		// GameCharacterの場合の衝突処理
-		//NOTE: OBBだけどSphereの押し戻しと同じ処理
-		gCollision_->ProcessCollision(this, otherCharacter, 0.0f);
+		//NOTE:相手側の OnCollision からも追加されるが、ソルバーで1ペアにまとめられる
+		//NOTE:移動量は互いの質量（SetMass）の逆数の比で配分される
+		Service::Collision::AddSolverContact(this, collider);
 	}
 }
 
@@ -4,8 +4,9 @@
 #include "Engine/Collider/OBBCollider.h"
 #include "Engine/Collider/SphereCollider.h"
 #include "Engine/Collider/ColliderConcept.h"
-// GameCharacterCollision
-#include "Collision/GameCharacterCollision.h"
+
+/// ===using宣言=== ///
+using MiiEngine::IsCollider;
 
 ///-------------------------------------------/// 
 /// GameCharacterBase
@@ -67,10 +68,6 @@ public: /// ===Setter=== ///
     // isDead
     void SetIsDead(const bool isDead) { baseInfo_.isDead = isDead; };
 protected:
-    // Collisionクラス
-    std::unique_ptr<MiiEngine::ColliderCollision> collision_;
-    std::unique_ptr<GameCharacterCollision> gCollision_;
-
     /// ===基本情報=== ///
     struct BaseInfo {
         Vector3 velocity{};     // 速度
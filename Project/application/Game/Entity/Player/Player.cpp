@@ -7,6 +7,7 @@
 #include "Service/Input.h"
 #include "Service/Camera.h"
 #include "Service/Collision.h"
+#include "Service/Particle.h"
 // Math
 #include "Math/sMath.h"
 // ImGui
@@ -70,6 +71,9 @@ void Player::Initialize() {
 	Service::Collision::AddCollider(this);
 	// OBBの設定
 	SetHalfSize({ 2.0f, 2.0f, 2.5f });
+
+	// パーティクルの番号を取得
+	moveParticleId_ = Service::Particle::GetDefinitionId("PlayerWarke");
 }
 
 
@@ -12,6 +12,8 @@
 #include "Hand/PlayerHand.h"
 // Weapon
 #include "Weapon/PlayerWeapon.h"
+// Particle
+#include "Engine/Graphics/Particle/ParticleHandle.h"
 
 /// ===前方宣言=== ///
 class Enemy;
@@ -83,6 +85,9 @@ public: /// ===Getter=== ///
 	Vector2 GetLeftStickState() const { return stickState_.leftStick; };
 	Vector2 GetRightStickState() const { return stickState_.rightStick; };
 
+	// Particle
+	MiiEngine::ParticleDefinitionId GetMoveParticleId() const { return moveParticleId_; };
+
 public: /// ===Setter=== ///
 	// Camera
 	void SetCameraTargetPlayer();
@@ -124,6 +129,9 @@ private: /// ===変数の宣言=== ///
 	/// ===State=== ///
 	std::unique_ptr<PlayerState> currentState_;
 
+	/// ===Particle（番号は初期化時に1回だけ取得）=== ///
+	MiiEngine::ParticleDefinitionId moveParticleId_ = MiiEngine::ParticleDefinitionId::kInvalid;
+
 	/// ===無敵時間の情報=== ///
 	struct InvincibleInfo {
 		float time = 1.0f;   // 無敵時間
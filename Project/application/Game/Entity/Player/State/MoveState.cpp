@@ -23,13 +23,12 @@ void MoveState::Enter(Player* player, MiiEngine::CameraCommon* camera) {
 	camera_ = camera;
 
 	// 移動パーティクルの強制停止
-	if (moveParticle_) {
-		moveParticle_->Stop();
-		moveParticle_ = nullptr;
-	}
+	Service::Particle::Stop(moveParticle_);
 	// 移動パーティクルの再生
-	moveParticle_ = Service::Particle::Emit("PlayerWarke", player_->GetTransform().translate);
-	moveParticle_->SetEmitterPosition(player_->GetTransform().translate);
+	moveParticle_ = Service::Particle::Emit(player_->GetMoveParticleId(), player_->GetTransform().translate);
+	if (MiiEngine::ParticleGroup* particle = Service::Particle::GetGroup(moveParticle_)) {
+		particle->SetEmitterPosition(player_->GetTransform().translate);
+	}
 }
 
 ///-------------------------------------------/// 
@@ -59,8 +58,8 @@ void MoveState::Update(Player * player, MiiEngine::CameraCommon* camera) {
 	player_->SetRotate(result.targetRotation);
 
 	// パーティクルの位置更新
-	if (moveParticle_) {
-		moveParticle_->SetEmitterPosition(player_->GetTransform().translate);
+	if (MiiEngine::ParticleGroup* particle = Service::Particle::GetGroup(moveParticle_)) {
+		particle->SetEmitterPosition(player_->GetTransform().translate);
 	}
 
 	/// ===Stateの変更=== ///
@@ -105,8 +104,6 @@ void MoveState::Finalize() {
 /// パーティクルの停止
 ///-------------------------------------------///
 void MoveState::StopMoveParticle() {
-	if (moveParticle_) {
-		moveParticle_->Stop();
-		moveParticle_ = nullptr;
-	}
+	Service::Particle::Stop(moveParticle_);
+	moveParticle_ = {};
 }
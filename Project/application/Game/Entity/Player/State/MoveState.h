@@ -3,11 +3,8 @@
 #include "Base/PlayerState.h"
 // Math
 #include "Math/Vector3.h"
-
-/// ===前方宣言=== ///
-namespace MiiEngine {
-	class ParticleGroup;
-}
+// Particle
+#include "Engine/Graphics/Particle/ParticleHandle.h"
 
 ///=====================================================/// 
 /// MoveState
@@ -37,7 +34,7 @@ public:
 	void Finalize() override;	
 
 private:
-	MiiEngine::ParticleGroup* moveParticle_ = nullptr;
+	MiiEngine::ParticleHandle moveParticle_;
 
 private:
 
@@ -34,10 +34,15 @@ void PlayerWeapon::Initialize() {
 	OBBCollider::Initialize();
 	name_ = MiiEngine::ColliderName::PlayerWeapon;
 	OBBCollider::SetHalfSize({ 2.0f, 0.5f, 5.0f });
+	// 振りが速く1フレームで敵をすり抜けるため連続判定を行う
+	SetIsContinuous(true);
 
 	// DeltaTime初期化
 	baseInfo_.deltaTime = Service::DeltaTime::GetDeltaTime();
 
+	// パーティクルの番号を取得
+	attackParticleId_ = Service::Particle::GetDefinitionId("WeaponAttack");
+
 	// 初期状態では非アクティブ
 	SetActive(false);
 	attackInfo_.isAttacking = false;
@@ -72,8 +77,8 @@ void PlayerWeapon::Update() {
 		Service::Collision::RemoveCollider(this);
 		OBBCollider::Update();
 		// パーティクルの削除
-		attackParticle_->Stop();
-		attackParticle_ = nullptr;
+		Service::Particle::Stop(attackParticle_);
+		attackParticle_ = {};
 		return;
 	}
 
@@ -81,8 +86,8 @@ void PlayerWeapon::Update() {
 	UpdateBezierTrajectory();
 
 	// Particleの軌道更新
-	if (attackParticle_) {
-		attackParticle_->SetEmitterPosition(object3d_->GetWorldTranslate());
+	if (MiiEngine::ParticleGroup* particle = Service::Particle::GetGroup(attackParticle_)) {
+		particle->SetEmitterPosition(object3d_->GetWorldTranslate());
 	}
 	
 
@@ -188,12 +193,11 @@ void PlayerWeapon::StartAttack(
 	SetActive(true);
 
 	// Particleの開始
-	if (attackParticle_) {
-		attackParticle_->Stop();
-		attackParticle_ = nullptr;
+	Service::Particle::Stop(attackParticle_);
+	attackParticle_ = Service::Particle::Emit(attackParticleId_, trajectoryPoints.front().position);
+	if (MiiEngine::ParticleGroup* particle = Service::Particle::GetGroup(attackParticle_)) {
+		particle->SetEmitterPosition(object3d_->GetWorldTranslate());
 	}
-	attackParticle_ = Service::Particle::Emit("WeaponAttack", trajectoryPoints.front().position);
-	attackParticle_->SetEmitterPosition(object3d_->GetWorldTranslate());
 
 	// 初期位置と回転を設定
 	transform_.translate = trajectoryPoints.front().position;
@@ -5,11 +5,10 @@
 // AttackData
 #include "application/Game/Editor/Data/AttackData.h"
 #include "Engine/DataInfo/LineObjectData.h"
+// Particle
+#include "Engine/Graphics/Particle/ParticleHandle.h"
 
 /// ===前方宣言=== ///
-namespace MiiEngine {
-	class ParticleGroup;
-}
 class Player;
 
 ///=====================================================/// 
@@ -82,8 +81,9 @@ private:
 	// Player
 	Player* player_ = nullptr;
 
-	// Particle
-	MiiEngine::ParticleGroup* attackParticle_ = nullptr;
+	// Particle（番号は初期化時に1回だけ取得、ハンドルはグループの終了後に使っても安全）
+	MiiEngine::ParticleDefinitionId attackParticleId_ = MiiEngine::ParticleDefinitionId::kInvalid;
+	MiiEngine::ParticleHandle attackParticle_;
 
 	/// ===基本情報=== ///
 	struct BaseInfo {
@@ -20,6 +20,7 @@ void Ground::GameInit(const std::string& modelName) {
 	// 初期化処理
 	GameObject::Initialize();
 	name_ = MiiEngine::ColliderName::Ground; // コライダー名を設定
+	SetIsStatic(true); // 動かないので静的コライダーとして扱う
 	// コライダーサービスに登録
 	Service::Collision::AddCollider(this);
 }
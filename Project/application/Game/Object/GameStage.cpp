@@ -1,6 +1,7 @@
 #include "GameStage.h"
 // Service
 #include "Service/GraphicsResourceGetter.h"
+#include "Service/Collision.h"
 // Math
 #include "Math/sMath.h"
 // ImGui
@@ -143,4 +144,7 @@ void GameStage::LoadStageData(const std::string& stageData) {
 			continue;
 		}
 	}
+
+	// 静的コライダーの加速構造を構築
+	Service::Collision::BuildStaticColliders();
 }
@@ -96,6 +96,12 @@ void GameScene::Update() {
 	ImGui::Begin("GameScene");
 	ImGui::End();
 
+	// Collision
+	Service::Collision::Information();
+
+	// Particle
+	Service::Particle::Information();
+
 	// Camera
 	if (Service::Camera::GetActiveCamera() == camera_.get()) {
 		camera_->ImGuiUpdate();
@@ -242,4 +248,12 @@ void GameScene::LoadParticle() {
 	Service::Particle::LoadParticleDefinition("EnemyPrePareAttackCharge.json");
 	Service::Particle::LoadParticleDefinition("CloseEnemyAttack.json");
 	Service::Particle::LoadParticleDefinition("LongEnemyAttack.json");
+
+	// 戦闘中に何度も発生させるものは先にバッファを作っておく
+	Service::Particle::PrewarmGroups("Game", 8);
+	Service::Particle::PrewarmGroups("nakagawa", 4);
+	Service::Particle::PrewarmGroups("CloseEnemyAttack", 4);
+	Service::Particle::PrewarmGroups("LongEnemyAttack", 4);
+	Service::Particle::PrewarmGroups("EnemyPrePareAttack", 4);
+	Service::Particle::PrewarmGroups("EnemyPrePareAttackCharge", 4);
 }
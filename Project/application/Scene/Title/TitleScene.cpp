@@ -27,8 +27,8 @@ TitleScene::~TitleScene() {
 	// Animationのリセット
 	animation_.reset();
 	// Particleのリセット
-	particle_->Stop();
-	particle_ = nullptr;
+	Service::Particle::Stop(particle_);
+	particle_ = {};
 	// Cameraの解放
 	Service::Camera::Remove("Title");
 	camera_.reset();
@@ -43,7 +43,8 @@ void TitleScene::Initialize() {
 
 	/// ===Particle=== ///
 	Service::Particle::LoadParticleDefinition("Title.json");
-	particle_ = Service::Particle::Emit("Title", { 0.0f, 0.0f, 0.0f });
+	particleId_ = Service::Particle::GetDefinitionId("Title");
+	particle_ = Service::Particle::Emit(particleId_, { 0.0f, 0.0f, 0.0f });
 
 	/// ===Line=== ///
 	for (uint32_t i = 0; i < 2; ++i) {
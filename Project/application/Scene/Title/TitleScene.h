@@ -7,14 +7,11 @@
 #include "UI/TitleUI.h"
 // Animation
 #include "Animation/TitleSceneAnimation.h"
+// Particle
+#include "Engine/Graphics/Particle/ParticleHandle.h"
 // C++
 #include <random>
 
-/// ===前方宣言=== ///
-namespace MiiEngine {
-	class ParticleGroup;
-}
-
 ///=====================================================/// 
 /// タイトルシーン
 ///=====================================================///
@@ -41,9 +38,10 @@ public:/// ===メンバ関数=== ///
 
 private:/// ===メンバ変数=== ///
 	
-	/// ===ポインタ=== ///
-	// パーティクル
-	MiiEngine::ParticleGroup* particle_;
+	/// ===ハンドル=== ///
+	// パーティクル（番号は初期化時に1回だけ取得）
+	MiiEngine::ParticleDefinitionId particleId_ = MiiEngine::ParticleDefinitionId::kInvalid;
+	MiiEngine::ParticleHandle particle_;
 
 	/// ===Class=== ///
 	// Line
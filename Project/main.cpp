@@ -1,13 +1,31 @@
 /// ===include=== ///
 #include "Engine/Scene/Framework.h"
 #include "Engine/Scene/MyGame.h"
+#include "Engine/Graphics/Particle/ParticleBenchmark.h"
+#include "Engine/Graphics/3d/Model/AnimationBenchmark.h"
+#include "Engine/Collider/Benchmark/CollisionBenchmark.h"
 #include <windows.h>
+#include <string>
 
 /// ===ゲームタイトル=== ///
 const wchar_t kWindowTitle[] = L"Fallen Ascent";
 
 // Windowsアプリでのエントリーポイント(main関数)
-int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int) {
+int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR lpCmdLine, int) {
+	// パーティクルのベンチマーク（ウィンドウと D3D12 を作らずに計測して終了）
+	const std::string commandLine = lpCmdLine ? lpCmdLine : "";
+	if (commandLine.find("--particle-benchmark") != std::string::npos) {
+		return MiiEngine::ParticleBenchmark::RunFromCommandLine(commandLine);
+	}
+	// アニメーションのベンチマーク（同上）
+	if (commandLine.find("--animation-benchmark") != std::string::npos) {
+		return MiiEngine::AnimationBenchmark::RunFromCommandLine(commandLine);
+	}
+	// 当たり判定のベンチマーク（同上）
+	if (commandLine.find("--collision-benchmark") != std::string::npos) {
+		return MiiEngine::CollisionBenchmark::RunFromCommandLine(commandLine);
+	}
+
 	// 宣言
 	std::unique_ptr<MiiEngine::Framework> game = std::make_unique<MiiEngine::MyGame>();
 	// 実行